@@ -0,0 +1,160 @@
+/**
+ * \file drbg.h
+ *
+ * \brief ChaCha20-based deterministic random bit generator
+ *
+ *        The generator follows the "fast key erasure" construction: each
+ *        refill produces a buffer of ChaCha20 keystream under the current
+ *        key, the first 32 bytes of which immediately replace the key.
+ *        Earlier output therefore cannot be recovered from the state.
+ *        The key is seeded from getrandom(2), and reseeded periodically
+ *        and after fork().
+ *
+ *        For benchmarks and debugging, a generator can instead be keyed
+ *        with a fixed seed, after which its output is reproducible and
+ *        it never reseeds. Such output is not secret.
+ */
+#ifndef DRBG_H
+#define DRBG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define ERR_DRBG_ENTROPY_FAILED     -0x0034  /**< The kernel entropy source failed. */
+
+#define DRBG_BLOCKS         8                    /**< ChaCha20 blocks per refill. */
+#define DRBG_BUFFER_SIZE    (64 * DRBG_BLOCKS)   /**< Keystream bytes per refill. */
+#define DRBG_KEY_SIZE       32                   /**< Size of the ChaCha20 key. */
+
+/**
+ * \brief          DRBG state
+ */
+typedef struct {
+    uint32_t key[DRBG_KEY_SIZE / 4];  /*!<  current ChaCha20 key            */
+    uint8_t buffer[DRBG_BUFFER_SIZE]; /*!<  keystream not handed out yet    */
+    size_t available;                 /*!<  unused bytes at the buffer end  */
+    uint32_t refills;                 /*!<  refills since the last reseed   */
+    unsigned int generation;          /*!<  fork generation of the seed     */
+    int seeded;                       /*!<  nonzero once a key is set       */
+    int deterministic;                /*!<  keyed by drbg_seed_deterministic */
+} drbg_context;
+
+/**
+ * \brief          Initialize a DRBG; it is seeded on first use
+ *
+ * \param ctx      DRBG to initialize
+ */
+void drbg_init(drbg_context *ctx);
+
+/**
+ * \brief          Clear the DRBG state
+ *
+ * \param ctx      DRBG to clear
+ */
+void drbg_free(drbg_context *ctx);
+
+/**
+ * \brief          (Re)seed the DRBG with 32 bytes from getrandom(2)
+ *
+ * \param ctx      DRBG to seed
+ *
+ * \return         0 if successful,
+ *                 ERR_DRBG_ENTROPY_FAILED if getrandom failed
+ */
+int drbg_reseed(drbg_context *ctx);
+
+/**
+ * \brief          Key the DRBG with a fixed seed: its output becomes
+ *                 reproducible and it is never reseeded from the kernel
+ *
+ * \warning        For benchmarks and tests only; the output is as
+ *                 predictable as the seed.
+ *
+ * \param ctx      DRBG to seed
+ * \param seed     DRBG_KEY_SIZE bytes
+ */
+void drbg_seed_deterministic(drbg_context *ctx, const uint8_t *seed);
+
+/**
+ * \brief          Derive the seed of an independent deterministic stream
+ *                 number \p index from a base seed
+ *
+ * \param out      DRBG_KEY_SIZE bytes of derived seed
+ * \param seed     DRBG_KEY_SIZE bytes of base seed
+ * \param index    Stream number
+ */
+void drbg_derive_seed(uint8_t *out, const uint8_t *seed, uint64_t index);
+
+/**
+ * \brief          Fill a buffer with random bytes
+ *
+ * \param ctx      DRBG to draw from
+ * \param out      Destination buffer; limb arrays can be filled directly
+ * \param len      Number of bytes
+ *
+ * \return         0 if successful,
+ *                 ERR_DRBG_ENTROPY_FAILED if (re)seeding failed
+ */
+int drbg_random(drbg_context *ctx, void *out, size_t len);
+
+/**
+ * \brief          Fill a buffer from the calling thread's own DRBG
+ *
+ * \note           Every thread gets a separate generator, seeded on first
+ *                 use, so concurrent callers never contend or share
+ *                 output. It is wiped when its thread exits, except for
+ *                 the main thread's at exit().
+ *
+ * \param out      Destination buffer
+ * \param len      Number of bytes
+ *
+ * \return         0 if successful,
+ *                 ERR_DRBG_ENTROPY_FAILED if (re)seeding failed
+ */
+int drbg_thread_random(void *out, size_t len);
+
+/**
+ * \brief          Key the calling thread's DRBG with a fixed seed (see
+ *                 drbg_seed_deterministic), or with NULL return it to
+ *                 kernel seeding
+ *
+ * \param seed     DRBG_KEY_SIZE bytes, or NULL
+ */
+void drbg_thread_seed(const uint8_t *seed);
+
+/**
+ * \brief          Whether the calling thread's DRBG runs from a fixed seed
+ */
+int drbg_thread_is_deterministic(void);
+
+/**
+ * \brief          Seed for a helper thread that should continue the
+ *                 calling thread's deterministic stream
+ *
+ *                 Threads start with their own kernel-seeded DRBG. Work
+ *                 handed to another thread stays reproducible if that
+ *                 thread calls drbg_thread_seed with a seed obtained
+ *                 here.
+ *
+ * \param seed     DRBG_KEY_SIZE bytes, drawn from the calling thread's
+ *                 stream
+ *
+ * \return         1 if the calling thread is deterministic and seed was
+ *                 filled, 0 otherwise
+ */
+int drbg_thread_derive_seed(uint8_t *seed);
+
+/**
+ * \brief          ChaCha20 block function (RFC 8439 with DJB's 64-bit
+ *                 counter and 64-bit nonce): write DRBG_BLOCKS blocks of
+ *                 keystream for the given key, nonce and first counter.
+ *
+ * \param out      Destination, DRBG_BUFFER_SIZE bytes
+ * \param key      256-bit key as eight little-endian words
+ * \param nonce    Nonce
+ * \param counter  Block counter of the first block
+ */
+void chacha20_blocks(uint8_t *out, const uint32_t key[8], uint64_t nonce,
+                     uint64_t counter);
+
+#endif /* DRBG_H */
@@ -8,6 +8,10 @@
  * and <em>Public-Key Cryptography Standards (PKCS) #1 v2.1:
  * RSA Cryptography Specifications</em>.
  *
+ * Thread safety: all state lives in the rsa_context. Different contexts
+ * may be used concurrently; a single context must not be written by
+ * two threads at once, while a finished key may be read (and written to
+ * files) from several.
  */
 
 #ifndef RSA_H
@@ -18,13 +22,38 @@
 #include "bigint.h"
 
 #define RSA_KEY_WRITE_ERROR 1
+#define RSA_KEY_CHECK_ERROR 2  /**< A generated key failed its consistency check. */
+
+#define RSA_BLINDING_TRIES 10  /**< Blinding values drawn before giving up. */
+
+#define RSA_MAX_PRIMES 4       /**< Most prime factors of a multi-prime key. */
+
+/** Public key comment and private key preamble of deterministic keys. */
+#define RSA_DETERMINISTIC_COMMENT "INSECURE-deterministic-test-key"
+#define RSA_DETERMINISTIC_WARNING \
+    "WARNING: this key was generated from a fixed seed (keygen --seed).\n" \
+    "Anyone who knows the seed can recreate it. Never use it outside tests.\n"
+
+/**
+ * \brief   A prime factor after P and Q of a multi-prime key, as in the
+ *          OtherPrimeInfo of RFC 8017 Appendix A.1.2.
+ */
+typedef struct
+{
+    bigint R;              /*!<  The prime factor r_i. */
+    bigint D;              /*!<  <code>D % (r_i - 1)</code>. */
+    bigint T;              /*!<  <code>1 / (P * Q * ... * r_(i-1)) % r_i</code>. */
+
+    bigint RR;             /*!<  cached <code>R^2 mod r_i</code>. */
+}
+rsa_prime_info;
 
 /**
  * \brief   The RSA context structure.
  */
 typedef struct
 {
-    int ver;               /*!<  Always 0.*/
+    int ver;               /*!<  0 for two primes, 1 for a multi-prime key. */
     size_t len;            /*!<  The size of \p N in Bytes. */
 
     bigint N;              /*!<  The public modulus. */
@@ -43,17 +72,215 @@ typedef struct
     bigint RP;             /*!<  cached <code>R^2 mod P</code>. */
     bigint RQ;             /*!<  cached <code>R^2 mod Q</code>. */
 
+    size_t num_other;      /*!<  Number of prime factors after P and Q. */
+    rsa_prime_info other[RSA_MAX_PRIMES - 2]; /*!<  Those prime factors. */
+
+    int deterministic;     /*!<  Generated from a seeded test RNG, see drbg.h;
+                                 the key files then carry a warning. */
+
 }
 rsa_context;
 
+/**
+ * \brief          Initialize an RSA context with empty key fields
+ *
+ * \param ctx      Context to initialize, owned by the caller
+ */
 void rsa_init(rsa_context *ctx);
+
+/**
+ * \brief          Free the key material held by an RSA context. The
+ *                 context itself stays owned by the caller and can be
+ *                 initialized again.
+ *
+ * \param ctx      Context to clear
+ */
 void rsa_free(rsa_context *ctx);
 
+/**
+ * \brief                  Generate an RSA key pair of nbits bits with the
+ *                         public exponent \p exponent, filling N, E, D, P,
+ *                         Q, DP, DQ and QP.
+ *
+ * \note                   If the calling thread's DRBG runs from a fixed
+ *                         seed (drbg_thread_seed), the key is reproducible
+ *                         and marked as deterministic.
+ *
+ * \note                   P and Q are searched on two threads, with
+ *                         P - 1 and Q - 1 coprime to the exponent. A
+ *                         prime that fails a later check is regenerated
+ *                         on its own.
+ *
+ * \note                   The key is completed with rsa_precompute, and
+ *                         then passes a pairwise consistency check: a
+ *                         random message signed with rsa_private must
+ *                         verify under E.
+ *
+ * \return                 0 if successful,
+ *                         ERR_BIGINT_BAD_INPUT_DATA if nbits < 128 or the
+ *                         exponent is not an odd number >= 3,
+ *                         ERR_BIGINT_ALLOC_FAILED if memory allocation
+ *                         failed,
+ *                         ERR_BIGINT_RNG_FAILED if the random number
+ *                         generator failed,
+ *                         RSA_KEY_CHECK_ERROR if the consistency check
+ *                         failed.
+ */
 int rsa_gen_key(rsa_context *ctx, size_t nbits, big_uint exponent);
 
+/**
+ * \brief                  Generate a multi-prime RSA key pair (RFC 8017)
+ *                         with \p nprimes prime factors of about
+ *                         nbits / nprimes bits each. The first two are P
+ *                         and Q; the others go to \p ctx->other, and the
+ *                         key version becomes 1.
+ *
+ *                         The primes are smaller than those of a
+ *                         two-prime key of the same size, so they are
+ *                         found faster, and rsa_private works on
+ *                         smaller moduli.
+ *
+ * \note                   As rsa_gen_key, which is this function with
+ *                         two primes: every prime but the last is
+ *                         searched on its own thread, each pair of
+ *                         primes is at least 2^(nbits / nprimes - 100)
+ *                         apart, and the finished key is precomputed and
+ *                         checked.
+ *
+ * \return                 0 if successful,
+ *                         ERR_BIGINT_BAD_INPUT_DATA if nprimes is not in
+ *                         2 .. RSA_MAX_PRIMES, the primes would have
+ *                         fewer than 64 bits or the exponent is not an
+ *                         odd number >= 3,
+ *                         ERR_BIGINT_ALLOC_FAILED if memory allocation
+ *                         failed,
+ *                         ERR_BIGINT_RNG_FAILED if the random number
+ *                         generator failed,
+ *                         RSA_KEY_CHECK_ERROR if the consistency check
+ *                         failed.
+ */
+int rsa_gen_key_multi(rsa_context *ctx, size_t nbits, size_t nprimes,
+                      big_uint exponent);
+
+/**
+ * \brief                  Fill the cached RN, RP and RQ of a key, the
+ *                         R^2 constants of its Montgomery arithmetic mod
+ *                         N, P and Q, and the RR of its other primes.
+ *                         rsa_gen_key calls it; a key whose fields are
+ *                         set any other way should be passed here once
+ *                         they are all in place.
+ *
+ * \note                   Operations on a key without the caches fill
+ *                         them on first use, which is slower for that
+ *                         call and not safe while other threads use the
+ *                         key.
+ *
+ * \param ctx              Context holding at least N; P, Q and the
+ *                         other primes are cached when present
+ *
+ * \return                 0 if successful,
+ *                         ERR_BIGINT_BAD_INPUT_DATA if N or a prime is
+ *                         not odd and positive,
+ *                         ERR_BIGINT_ALLOC_FAILED if memory allocation
+ *                         failed.
+ */
+int rsa_precompute(rsa_context *ctx);
+
+/**
+ * \brief                  Public key operation: out = in^E mod N
+ *
+ *                         A one-limb E, such as 65537 or 3, skips the
+ *                         window table of big_exp_mod: 65537 costs 16
+ *                         squarings and one multiplication.
+ *
+ * \note                   An empty RN is filled on the first call; see
+ *                         rsa_precompute.
+ *
+ * \param ctx              Context holding N and E
+ * \param in               Input, 0 <= in < N
+ * \param out              Destination bigint; may be \p in
+ *
+ * \return                 0 if successful,
+ *                         ERR_BIGINT_BAD_INPUT_DATA if the key is incomplete
+ *                         or \p in is out of range,
+ *                         ERR_BIGINT_ALLOC_FAILED if memory allocation
+ *                         failed.
+ */
+int rsa_public(rsa_context *ctx, const bigint *in, bigint *out);
+
+/**
+ * \brief                  Private key operation: out = in^D mod N
+ *
+ *                         Computed with the CRT as two half-size
+ *                         exponentiations, in^DP mod P and in^DQ mod Q,
+ *                         joined by Garner's formula with QP. The other
+ *                         primes of a multi-prime key are joined in the
+ *                         same way, one after another. The input is
+ *                         blinded with a fresh random r (in * r^E, and
+ *                         the result times r^-1), so the timing of the
+ *                         exponentiations does not depend on \p in.
+ *
+ * \note                   Empty RN, RP and RQ are filled on the first
+ *                         call. A context whose caches are filled by
+ *                         rsa_precompute, such as one from rsa_gen_key,
+ *                         may be used by several threads at once.
+ *
+ * \param ctx              Context holding N, E, P, Q, DP, DQ and QP,
+ *                         and R, D and T of any other primes
+ * \param in               Input, 0 <= in < N
+ * \param out              Destination bigint; may be \p in
+ *
+ * \return                 0 if successful,
+ *                         ERR_BIGINT_BAD_INPUT_DATA if the key is incomplete
+ *                         or \p in is out of range,
+ *                         ERR_BIGINT_ALLOC_FAILED if memory allocation
+ *                         failed,
+ *                         ERR_BIGINT_RNG_FAILED if no blinding value
+ *                         could be drawn.
+ */
+int rsa_private(rsa_context *ctx, const bigint *in, bigint *out);
+
+/**
+ * \brief                  Batch private key operation (Fiat's batch RSA)
+ *                         for keys that share the modulus N but have
+ *                         different small public exponents:
+ *                         out[i] = in[i]^(1 / exponents[i]) mod N
+ *
+ *                         The inputs are joined in a product tree, whose
+ *                         root takes a single blinded CRT exponentiation;
+ *                         the roots of the inputs are then split off
+ *                         with short exponentiations and one inversion
+ *                         per tree level. For small exponents (3, 5, 7,
+ *                         ...) a batch of 8 costs about as much as two
+ *                         rsa_private calls. ctx->E is not used.
+ *
+ * \param ctx              Context holding N, P, Q and QP, and R and T of
+ *                         any other primes
+ * \param exponents        Public exponents, odd, >= 3, pairwise coprime
+ *                         and coprime to r - 1 for every prime r
+ * \param in               Inputs, 0 < in[i] < N
+ * \param out              Destination bigints; may be \p in
+ * \param count            Number of inputs, at least 1
+ *
+ * \return                 0 if successful,
+ *                         ERR_BIGINT_BAD_INPUT_DATA if the key is
+ *                         incomplete or an exponent or input is not
+ *                         acceptable,
+ *                         ERR_BIGINT_ALLOC_FAILED if memory allocation
+ *                         failed,
+ *                         ERR_BIGINT_RNG_FAILED if no blinding value
+ *                         could be drawn.
+ */
+int rsa_private_batch(rsa_context *ctx, const big_uint *exponents,
+                      const bigint *in, bigint *out, size_t count);
+
 /**
  * \brief                  Write the private key to the given file
  *                         in the DER ASN.1 format
+ *
+ * \note                   The other primes of a multi-prime key are
+ *                         written as its otherPrimeInfos (RFC 8017
+ *                         Appendix A.1.2).
  * 
  * \return                 0 if successful, RSA_KEY_WRITE_ERROR otherwise.
  */
@@ -0,0 +1,50 @@
+/**
+ * \file small_primes.h
+ *
+ * \brief Precomputed tables of the odd primes below 2^16 and their
+ *        products, used to reject prime candidates with small factors.
+ *        The tables are generated by tests/generate_small_primes.py.
+ */
+#ifndef SMALL_PRIMES_H
+#define SMALL_PRIMES_H
+
+#include <stdint.h>
+
+#include "bigint.h"
+
+#define NUM_SMALL_PRIMES     6541  /**< Odd primes 3 <= p < 2^16. */
+#define NUM_PRIMORIALS       1577  /**< Single-limb products of those primes. */
+#define NUM_PRIMORIAL_BLOCKS 198   /**< Multi-limb products of primorials. */
+#define PRIMORIAL_BLOCK_LIMBS 8    /**< Single-limb primorials per block. */
+
+/**
+ * \brief          The odd primes below 2^16, in increasing order.
+ */
+extern const uint16_t SMALL_PRIMES[NUM_SMALL_PRIMES];
+
+/**
+ * \brief          Barrett constants floor(2^32 / p) for SMALL_PRIMES. For
+ *                 x < 2^32, q = (x * SMALL_PRIME_BARRETT[i]) >> 32 is
+ *                 floor(x / p) or one less.
+ */
+extern const uint32_t SMALL_PRIME_BARRETT[NUM_SMALL_PRIMES];
+
+/**
+ * \brief          PRIMORIALS[j] is the product of the primes
+ *                 SMALL_PRIMES[PRIMORIAL_END[j - 1]] up to (but not
+ *                 including) SMALL_PRIMES[PRIMORIAL_END[j]]; each run is as
+ *                 long as possible while the product still fits in a limb.
+ */
+extern const big_uint PRIMORIALS[NUM_PRIMORIALS];
+extern const uint16_t PRIMORIAL_END[NUM_PRIMORIALS];
+
+/**
+ * \brief          Block k is the product of PRIMORIALS[8k] .. PRIMORIALS[8k + 7]
+ *                 stored least significant limb first (unlike bigint data) at
+ *                 PRIMORIAL_BLOCK_DATA[PRIMORIAL_BLOCK_OFFSET[k]] up to
+ *                 PRIMORIAL_BLOCK_DATA[PRIMORIAL_BLOCK_OFFSET[k + 1]].
+ */
+extern const big_uint PRIMORIAL_BLOCK_DATA[];
+extern const uint16_t PRIMORIAL_BLOCK_OFFSET[NUM_PRIMORIAL_BLOCKS + 1];
+
+#endif /* SMALL_PRIMES_H */
@@ -1,7 +1,16 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
+#include <unistd.h>
 
+#include "drbg.h"
 #include "rsa.h"
 
 #define STRLEN(s) (sizeof(s) / sizeof(*s) - 1)
@@ -10,30 +19,87 @@
 #define EXPONENT 65537
 
 #define PUB_SUFFIX ".pub"
+#define KEY_PREFIX "key_"
 
-int main(int argc, char **argv) {
-    if (argc != 2) {
-        fprintf(stderr, "Usage: %s RSA_FILE\n", argv[0]);
-        return 1;
+/*
+ * Batch generation: a fixed pool of worker threads claims key indices from
+ * a shared counter and generates each key in its own rsa_context. Finished
+ * keys are queued to the main thread, which writes them out in completion
+ * order while the workers go on with the next ones.
+ */
+typedef struct finished_key {
+    size_t index;
+    rsa_context rsa;
+    int err;               /*!<  nonzero if key generation failed */
+    struct finished_key *next;
+} finished_key;
+
+typedef struct {
+    size_t count;
+    size_t bits;
+    size_t primes;         /*!<  prime factors per key, see rsa_gen_key_multi */
+    big_uint exponent;
+    bool seeded;           /*!<  --seed: key i uses stream i of seed */
+    uint8_t seed[DRBG_KEY_SIZE];
+    atomic_size_t next_index;
+
+    pthread_mutex_t lock;
+    pthread_cond_t ready;
+    finished_key *head;    /*!<  queue of keys to write, oldest first */
+    finished_key *tail;
+} keygen_pool;
+
+static void *keygen_worker(void *arg) {
+    keygen_pool *pool = arg;
+    size_t index;
+    while ((index = atomic_fetch_add(&pool->next_index, 1)) < pool->count) {
+        finished_key *key = calloc(1, sizeof(finished_key));
+        if (key == NULL) {
+            fprintf(stderr, "Out of memory\n");
+            exit(2);
+        }
+        key->index = index;
+        if (pool->seeded) {
+            uint8_t key_seed[DRBG_KEY_SIZE];
+            drbg_derive_seed(key_seed, pool->seed, index);
+            drbg_thread_seed(key_seed);
+        }
+        rsa_init(&key->rsa);
+        key->err = rsa_gen_key_multi(&key->rsa, pool->bits, pool->primes,
+                                     pool->exponent);
+
+        pthread_mutex_lock(&pool->lock);
+        if (pool->tail == NULL) {
+            pool->head = key;
+        } else {
+            pool->tail->next = key;
+        }
+        pool->tail = key;
+        pthread_cond_signal(&pool->ready);
+        pthread_mutex_unlock(&pool->lock);
     }
+    return NULL;
+}
 
-    rsa_context rsa;
-    rsa_init(&rsa);
-    int result = rsa_gen_key(&rsa, BITS, EXPONENT);
-    if (result != 0) {
-        fprintf(stderr, "Key generation failed with error code: %d\n", result);
-        rsa_free(&rsa);
+// The private key is created with owner-only permissions, so it is never
+// readable by others, even while it is being written
+static int write_key_pair(const rsa_context *rsa, const char *private_filename) {
+    int fd = open(private_filename, O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+    FILE *private_file = fd < 0 ? NULL : fdopen(fd, "w");
+    if (private_file == NULL || rsa_write_private_key(rsa, private_file)) {
+        perror("Failed to write private key");
+        if (private_file != NULL) {
+            fclose(private_file);
+        } else if (fd >= 0) {
+            close(fd);
+        }
         return 2;
     }
-
-    char *private_filename = argv[1];
-    FILE *private_file = fopen(private_filename, "w");
-    if (private_file == NULL || rsa_write_private_key(&rsa, private_file)) {
+    if (fclose(private_file)) {
         perror("Failed to write private key");
         return 2;
     }
-    fclose(private_file);
-    if (chmod(private_filename, S_IRUSR | S_IWUSR | S_IXUSR)) {
+    if (chmod(private_filename, S_IRUSR | S_IWUSR)) {
         perror("Failed to set private key permissions");
         return 2;
     }
@@ -42,11 +108,158 @@ int main(int argc, char **argv) {
     strcpy(public_filename, private_filename);
     strcat(public_filename, PUB_SUFFIX);
     FILE *public_file = fopen(public_filename, "w");
-    if (public_file == NULL || rsa_write_public_key(&rsa, public_file)) {
+    if (public_file == NULL || rsa_write_public_key(rsa, public_file)) {
         perror("Failed to write public key");
+        if (public_file != NULL) {
+            fclose(public_file);
+        }
         return 2;
     }
-    fclose(public_file);
+    if (fclose(public_file)) {
+        perror("Failed to write public key");
+        return 2;
+    }
+    return 0;
+}
+
+static void usage(const char *name) {
+    fprintf(stderr,
+            "Usage: %s RSA_FILE\n"
+            "       %s [--count N] [--bits B] [--exponent E] [--primes K] "
+            "[-j THREADS] [--out-dir DIR] [--seed S]\n"
+            "\n"
+            "The second form writes DIR/" KEY_PREFIX "0 ... DIR/" KEY_PREFIX
+            "<N-1> and their " PUB_SUFFIX " files,\n"
+            "generating keys on THREADS threads (default: one per CPU).\n"
+            "--primes makes multi-prime keys with K = 2 .. %d prime factors.\n"
+            "--seed makes the keys reproducible for benchmarks; they are not\n"
+            "secret and their files are marked as test keys.\n",
+            name, name, RSA_MAX_PRIMES);
+}
 
-    rsa_free(&rsa);
+static bool parse_size(const char *s, size_t *out) {
+    char *end;
+    errno = 0;
+    unsigned long long value = strtoull(s, &end, 10);
+    if (errno != 0 || end == s || *end != '\0' || s[0] == '-') {
+        return false;
+    }
+    *out = value;
+    return true;
+}
+
+int main(int argc, char **argv) {
+    static const struct option options[] = {
+        {"count",    required_argument, NULL, 'n'},
+        {"bits",     required_argument, NULL, 'b'},
+        {"exponent", required_argument, NULL, 'e'},
+        {"primes",   required_argument, NULL, 'p'},
+        {"jobs",     required_argument, NULL, 'j'},
+        {"out-dir",  required_argument, NULL, 'o'},
+        {"seed",     required_argument, NULL, 's'},
+        {"help",     no_argument,       NULL, 'h'},
+        {NULL, 0, NULL, 0}
+    };
+
+    size_t count = 1, bits = BITS, exponent = EXPONENT, primes = 2, jobs = 0,
+           seed = 0;
+    const char *out_dir = NULL;
+    bool batch = false, seeded = false;
+    int opt;
+    while ((opt = getopt_long(argc, argv, "j:h", options, NULL)) != -1) {
+        bool ok = true;
+        switch (opt) {
+        case 'n': ok = parse_size(optarg, &count) && count > 0; batch = true; break;
+        case 'b': ok = parse_size(optarg, &bits); break;
+        case 'e': ok = parse_size(optarg, &exponent); break;
+        case 'p': ok = parse_size(optarg, &primes); break;
+        case 'j': ok = parse_size(optarg, &jobs); break;
+        case 'o': out_dir = optarg; batch = true; break;
+        case 's': ok = parse_size(optarg, &seed); seeded = true; break;
+        default:  ok = false; break;
+        }
+        if (!ok) {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    // RSA_FILE alone keeps the original single-key behaviour
+    if (batch ? optind != argc : optind != argc - 1) {
+        usage(argv[0]);
+        return 1;
+    }
+    if (out_dir == NULL) {
+        out_dir = ".";
+    } else if (mkdir(out_dir, S_IRWXU) && errno != EEXIST) {
+        perror("Failed to create output directory");
+        return 2;
+    }
+
+    if (jobs == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        jobs = online > 0 ? (size_t)online : 1;
+    }
+    if (jobs > count) {
+        jobs = count;
+    }
+
+    keygen_pool pool = {.count = count, .bits = bits, .primes = primes,
+                        .exponent = exponent, .seeded = seeded};
+    if (seeded) {
+        fprintf(stderr, "WARNING: --seed generates reproducible, insecure test keys\n");
+        for (size_t i = 0; i < sizeof(seed); i++) {
+            pool.seed[i] = (uint8_t)(seed >> (8 * i));
+        }
+    }
+    atomic_init(&pool.next_index, 0);
+    pthread_mutex_init(&pool.lock, NULL);
+    pthread_cond_init(&pool.ready, NULL);
+
+    pthread_t *threads = malloc(jobs * sizeof(pthread_t));
+    size_t started = 0;
+    while (threads != NULL && started < jobs &&
+           pthread_create(&threads[started], NULL, keygen_worker, &pool) == 0) {
+        started++;
+    }
+    if (started == 0) {
+        fprintf(stderr, "Failed to start key generation threads\n");
+        return 2;
+    }
+
+    // Writer stage: emit each key as soon as a worker hands it over
+    int status = 0;
+    for (size_t written = 0; written < count; written++) {
+        pthread_mutex_lock(&pool.lock);
+        while (pool.head == NULL) {
+            pthread_cond_wait(&pool.ready, &pool.lock);
+        }
+        finished_key *key = pool.head;
+        pool.head = key->next;
+        if (pool.head == NULL) {
+            pool.tail = NULL;
+        }
+        pthread_mutex_unlock(&pool.lock);
+
+        if (key->err != 0) {
+            fprintf(stderr, "Key generation failed with error code: %d\n", key->err);
+            status = 2;
+        } else if (!batch) {
+            status |= write_key_pair(&key->rsa, argv[optind]);
+        } else {
+            char filename[strlen(out_dir) + STRLEN("/" KEY_PREFIX) + 21];
+            snprintf(filename, sizeof(filename), "%s/" KEY_PREFIX "%zu",
+                     out_dir, key->index);
+            status |= write_key_pair(&key->rsa, filename);
+        }
+        rsa_free(&key->rsa);
+        free(key);
+    }
+
+    for (size_t i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    free(threads);
+    pthread_mutex_destroy(&pool.lock);
+    pthread_cond_destroy(&pool.ready);
+    return status;
 }
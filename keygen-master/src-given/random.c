@@ -1,20 +1,54 @@
 #include "bigint.h"
+#include "drbg.h"
 
-#include <stdio.h>
-
-FILE *get_dev_urandom(void) {
-    static FILE *file;
-    if (file == NULL) file = fopen("/dev/urandom", "r");
-    return file;
-}
+#include <stdlib.h>
+#include <string.h>
 
 int big_fill_random(bigint *x, size_t size) {
-    FILE *random = get_dev_urandom();
-    if (random == NULL) return ERR_BIGINT_ALLOC_FAILED;
+    size_t n_limbs = (size + sizeof(big_uint) - 1) / sizeof(big_uint);
+    if (n_limbs == 0) {
+        free(x->data);
+        *x = BIG_ZERO;
+        return 0;
+    }
+    if (x->num_limbs < n_limbs) {
+        big_uint *data = malloc(n_limbs * sizeof(big_uint));
+        if (data == NULL) return ERR_BIGINT_ALLOC_FAILED;
+        free(x->data);
+        x->data = data;
+    }
+    x->num_limbs = n_limbs;
 
-    uint8_t buffer[size];
-    size_t read = fread(buffer, 1, size, random);
-    if (read != size) return ERR_BIGINT_ALLOC_FAILED;
+    // The random bytes are written straight into the limbs, right-aligned
+    // behind the zero padding of the top limb, and each limb is then read
+    // back as big-endian. X is thus the big-endian value of the stream.
+    uint8_t *bytes = (uint8_t *)x->data;
+    size_t pad = n_limbs * sizeof(big_uint) - size;
+    memset(bytes, 0, pad);
+    if (drbg_thread_random(bytes + pad, size) != 0) {
+        free(x->data);
+        *x = BIG_ZERO;
+        return ERR_BIGINT_RNG_FAILED;
+    }
+    for (size_t i = 0; i < n_limbs; i++) {
+        const uint8_t *b = bytes + i * sizeof(big_uint);
+        big_uint limb = 0;
+        for (size_t j = 0; j < sizeof(big_uint); j++) {
+            limb = limb << 8 | b[j];
+        }
+        x->data[i] = limb;
+    }
 
-    return big_read_binary(x, buffer, size);
+    // Leading zero limbs are dropped, and all zeros is BIG_ZERO
+    size_t zeros = 0;
+    while (zeros < n_limbs && x->data[zeros] == 0) zeros++;
+    if (zeros == n_limbs) {
+        free(x->data);
+        *x = BIG_ZERO;
+        return 0;
+    }
+    memmove(x->data, x->data + zeros, (n_limbs - zeros) * sizeof(big_uint));
+    x->num_limbs = n_limbs - zeros;
+    x->signum = 1;
+    return 0;
 }
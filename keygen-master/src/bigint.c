@@ -12,8 +12,25 @@
 #include <sys/types.h>
 #include <math.h>
 #include <ctype.h>
-
-static bool LOG_DEBUG = false;
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+
+#include "drbg.h"
+#include "small_primes.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <cpuid.h>
+#include <immintrin.h>
+#define BIG_HAVE_AVX2_KERNELS
+#define BIG_HAVE_ADX_KERNELS
+#endif
+
+// Debug tracing of the multiplication and division internals; a build
+// flag rather than a variable, so that there is no shared mutable state
+#ifndef BIG_LOG_DEBUG
+#define BIG_LOG_DEBUG 0
+#endif
 
 void big_print(bigint *X){
     char buf[X->num_limbs * 16 + 5]; 
@@ -82,16 +99,22 @@ static int trim_limbs(bigint *X) {
         }
     }
     int remaining_limbs = X->num_limbs - i;
-    big_uint* new_data = malloc(sizeof(bigint) * remaining_limbs);
+    if (remaining_limbs == 0) {
+        // zero owns no limbs, like BIG_ZERO; a 0-byte buffer would be
+        // lost by callers that overwrite an empty X
+        free(X->data);
+        X->data = NULL;
+        X->num_limbs = 0;
+        X->signum = 0;
+        return i;
+    }
+    big_uint* new_data = malloc(sizeof(big_uint) * remaining_limbs);
     for (size_t j = i; j < X->num_limbs; j++) {
         new_data[j - i] = X->data[j];
     }
     free(X->data);
     X->data = new_data;
     X->num_limbs = remaining_limbs;
-    if (X->num_limbs == 0){
-        X->signum = 0;
-    }
     return i;
 }
 
@@ -409,22 +432,21 @@ int big_write_binary(const bigint *X, uint8_t *buf, size_t buflen) {
     size_t idx = padlen;
 
 
+    bool leading = true;
     for (size_t i = 0; i < X->num_limbs; i++) {        
-        uint64_t biggest_uint64 = 18446744073709551615;
-        uint64_t temp = biggest_uint64 & X->data[i];
+        uint64_t temp = X->data[i];
 
         for (int j = 7; j >= 0; j--) {
             uint8_t binary = temp >> (8 * j);
-            // printf("binary = %02x\n", binary);
-            assert(idx < buflen);
-
-            if (i == 0 && binary == 0) {       
-                // take out leading 0s in the first limb
-            } else {
-                buf[idx] = binary;
-                idx++;
+            // take out the leading 0s; zero bytes after the first
+            // nonzero one are part of the value
+            if (leading && binary == 0) {
+                continue;
             }
-            // printf("binary = %02x\n", binary);
+            leading = false;
+            assert(idx < buflen);
+            buf[idx] = binary;
+            idx++;
         }
     }
 
@@ -652,46 +674,6 @@ int big_cmp(const bigint *x, const bigint *y) {
 }
 
 
-int big_mul(bigint *X, const bigint *A, const bigint *B) {
-
-    // X will take at most (A->num_limbs + B->num_limbs + 2) space
-    big_uint *new_data = calloc((A->num_limbs + B->num_limbs), sizeof(big_uint));
-    if (new_data == NULL){
-        return ERR_BIGINT_ALLOC_FAILED;
-    }
-
-    big_udbl uv = 0;
-
-    size_t new_size = A->num_limbs + B->num_limbs;
-    for (int B_idx = B->num_limbs - 1; B_idx >= 0; B_idx--) {
-        big_uint carry = 0;
-
-        for (int A_idx = A->num_limbs - 1; A_idx >= 0; A_idx--) {
-
-            int i_plus_j = (A->num_limbs - A_idx - 1) + (B->num_limbs - B_idx - 1);
-
-            uv = new_data[new_size - 1 - i_plus_j] + ((big_udbl)A->data[A_idx] * (big_udbl)B->data[B_idx]) + carry;
-
-            new_data[new_size - 1 - i_plus_j] = (big_uint)(uv & ULONG_MAX); // ones digit
-            carry = (big_uint)(uv >> 64);
-        } 
-        // n + 1 = A->num_limbs
-        // i = B->num_limbs - B_idx 
-        // n + 1 + i = A->num_limbs + B->num_limbs - B_idx
-        // Convert to an index: 
-        new_data[B_idx] = (big_uint) ((uv >> 64) & ULONG_MAX); // tens digit
-    }
-    
-    X->signum = A->signum * B->signum;
-    X->num_limbs = new_size;        
-    if (X->data != NULL) {
-        free(X->data);
-    }
-    X->data = new_data;
-    trim_limbs(X);
-    return 0;
-}
-
 int big_eval_polynomial(bigint *Y, bigint *A, size_t len_A, bigint *X) {
     /* Zero out result */
     big_copy(Y, &BIG_ZERO);
@@ -738,105 +720,530 @@ int big_shr(bigint *X, const bigint *A, size_t shift) {
     check_zero(X);
 }
 
-int big_fast_divide_by_3(bigint *X, const bigint *A) {
-    if (A->signum == 0) {
-        if (X->data != NULL) {
-            free(X->data);
+// Inverse of an odd limb d modulo 2^64, via Newton's iteration
+// x <- x * (2 - d * x), which doubles the number of correct low bits.
+// d * d == 1 mod 8 for any odd d, so x = d starts with 3 correct bits.
+static big_uint limb_inverse(big_uint d) {
+    big_uint x = d;
+    for (int i = 0; i < 5; i++) {
+        x *= 2 - d * x;
+    }
+    return x;
+}
+
+// Number of trailing zero bits of a nonzero limb
+static int limb_ctz(big_uint d) {
+    return __builtin_ctzll(d);
+}
+
+int big_divexact_limb(bigint *Q, const bigint *A, big_uint d) {
+    if (d == 0) {
+        return ERR_BIGINT_DIVISION_BY_ZERO;
+    }
+    if (A->signum == 0 || A->num_limbs == 0) {
+        return big_copy(Q, &BIG_ZERO);
+    }
+
+    size_t n = A->num_limbs;
+    big_uint *new_data = malloc(n * sizeof(big_uint));
+    if (new_data == NULL) {
+        return ERR_BIGINT_ALLOC_FAILED;
+    }
+
+    // Dividing by the power of two in d is a right shift, folded
+    // into the same low-to-high pass as the division by the odd part.
+    int shift = limb_ctz(d);
+    d >>= shift;
+    big_uint inv = limb_inverse(d);
+
+    big_uint carry = 0;
+    for (int i = (int)n - 1; i >= 0; i--) {
+        big_uint a = A->data[i] >> shift;
+        if (shift != 0 && i > 0) {
+            a |= A->data[i - 1] << (64 - shift);
         }
-        *X = BIG_ZERO;
+        big_uint borrow = a < carry;
+        a -= carry;
+        big_uint q = a * inv;
+        new_data[i] = q;
+        carry = (big_uint)(((big_udbl)q * d) >> 64) + borrow;
+    }
+
+    int signum = A->signum;
+    free(Q->data);
+    Q->data = new_data;
+    Q->num_limbs = n;
+    Q->signum = signum;
+    trim_limbs(Q);
+    return 0;
+}
+
+// Copies the magnitude of X into a little-endian limb array
+// (index 0 = least significant limb) and returns the number of
+// significant limbs, or 0 if X is zero.
+static size_t limbs_from_big(big_uint *dst, const bigint *X) {
+    size_t first = 0;
+    while (first < X->num_limbs && X->data[first] == 0) {
+        first++;
+    }
+    size_t n = X->num_limbs - first;
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = X->data[X->num_limbs - 1 - i];
+    }
+    return n;
+}
+
+// Writes a little-endian limb array of length n into X as a non-negative
+// bigint
+static int limbs_to_big(bigint *X, const big_uint *src, size_t n) {
+    while (n > 0 && src[n - 1] == 0) {
+        n--;
+    }
+    if (n == 0) {
+        return big_copy(X, &BIG_ZERO);
+    }
+    int err = resize_limbs(X, n);
+    if (err != 0) {
+        return err;
+    }
+    for (size_t i = 0; i < n; i++) {
+        X->data[n - 1 - i] = src[i];
+    }
+    X->signum = 1;
+    return 0;
+}
+
+// Shifts a little-endian limb array right by `bits`, dropping the low bits
+static void limbs_shr(big_uint *x, size_t n, size_t bits) {
+    size_t limb_shift = bits / 64;
+    int bit_shift = bits % 64;
+    for (size_t i = 0; i < n; i++) {
+        big_uint lo = i + limb_shift < n ? x[i + limb_shift] : 0;
+        big_uint hi = i + limb_shift + 1 < n ? x[i + limb_shift + 1] : 0;
+        x[i] = bit_shift == 0 ? lo : (lo >> bit_shift) | (hi << (64 - bit_shift));
+    }
+}
+
+/*
+ * Limb kernels: r = a * b and r += a * b over n little-endian limbs, for a
+ * single limb b, returning the carry limb. The schoolbook product behind
+ * big_mul (and so the Karatsuba and Toom-Cook base case) and the
+ * Montgomery multiplication, squaring and reduction are rows of these.
+ * The portable kernels use the double-limb type. On x86-64 with BMI2 and
+ * ADX, MULX leaves the flags alone, so ADCX and ADOX can run two carry
+ * chains at once: one adds the low halves of the products to r, the other
+ * the high halves to the next limb. big_select_kernels picks one set;
+ * the best available is selected at startup. The set in use is a single
+ * atomic pointer, read once per operation with a relaxed load: a thread
+ * switching it never races with others, which finish on the set they
+ * loaded, and all sets compute the same results.
+ */
+typedef big_uint limbs_mul_1_fn(big_uint *r, const big_uint *a, size_t n,
+                                big_uint b);
+
+static big_uint limbs_mul_1_c(big_uint *r, const big_uint *a, size_t n,
+                              big_uint b) {
+    big_uint c = 0;
+    for (size_t i = 0; i < n; i++) {
+        big_udbl uv = (big_udbl)a[i] * b + c;
+        r[i] = (big_uint)uv;
+        c = (big_uint)(uv >> 64);
+    }
+    return c;
+}
+
+static big_uint limbs_addmul_1_c(big_uint *r, const big_uint *a, size_t n,
+                                 big_uint b) {
+    big_uint c = 0;
+    for (size_t i = 0; i < n; i++) {
+        big_udbl uv = (big_udbl)a[i] * b + r[i] + c;
+        r[i] = (big_uint)uv;
+        c = (big_uint)(uv >> 64);
+    }
+    return c;
+}
+
+#ifdef BIG_HAVE_ADX_KERNELS
+// r = a * b + c over n limbs, n a positive multiple of 4; returns the carry
+static big_uint mul_4k_adx(big_uint *r, const big_uint *a, size_t n,
+                           big_uint b, big_uint c) {
+    long i = -(long)n;
+    __asm__ volatile(
+        "mov %[c], %%r8\n\t"
+        "xor %%eax, %%eax\n"
+        "1:\n\t"
+        "mulx (%[a],%[i],8), %%r10, %%r9\n\t"
+        "adcx %%r8, %%r10\n\t"
+        "mov %%r10, (%[r],%[i],8)\n\t"
+        "mulx 8(%[a],%[i],8), %%r10, %%r8\n\t"
+        "adcx %%r9, %%r10\n\t"
+        "mov %%r10, 8(%[r],%[i],8)\n\t"
+        "mulx 16(%[a],%[i],8), %%r10, %%r9\n\t"
+        "adcx %%r8, %%r10\n\t"
+        "mov %%r10, 16(%[r],%[i],8)\n\t"
+        "mulx 24(%[a],%[i],8), %%r10, %%r8\n\t"
+        "adcx %%r9, %%r10\n\t"
+        "mov %%r10, 24(%[r],%[i],8)\n\t"
+        "lea 4(%[i]), %[i]\n\t"
+        "jrcxz 2f\n\t"
+        "jmp 1b\n"
+        "2:\n\t"
+        "adcx %%rax, %%r8\n\t"
+        "mov %%r8, %[c]\n\t"
+        : [i] "+c"(i), [c] "+r"(c)
+        : [r] "r"(r + n), [a] "r"(a + n), "d"(b)
+        : "rax", "r8", "r9", "r10", "cc", "memory");
+    return c;
+}
+
+// r += a * b + c over n limbs, n a positive multiple of 4; returns the
+// carry. The low halves of the products go into r on the CF chain
+// (ADCX), the high halves into the next limb on the OF chain (ADOX).
+static big_uint addmul_4k_adx(big_uint *r, const big_uint *a, size_t n,
+                              big_uint b, big_uint c) {
+    long i = -(long)n;
+    __asm__ volatile(
+        "mov %[c], %%r8\n\t"
+        "xor %%eax, %%eax\n"
+        "1:\n\t"
+        "mulx (%[a],%[i],8), %%r10, %%r9\n\t"
+        "adox %%r8, %%r10\n\t"
+        "adcx (%[r],%[i],8), %%r10\n\t"
+        "mov %%r10, (%[r],%[i],8)\n\t"
+        "mulx 8(%[a],%[i],8), %%r10, %%r8\n\t"
+        "adox %%r9, %%r10\n\t"
+        "adcx 8(%[r],%[i],8), %%r10\n\t"
+        "mov %%r10, 8(%[r],%[i],8)\n\t"
+        "mulx 16(%[a],%[i],8), %%r10, %%r9\n\t"
+        "adox %%r8, %%r10\n\t"
+        "adcx 16(%[r],%[i],8), %%r10\n\t"
+        "mov %%r10, 16(%[r],%[i],8)\n\t"
+        "mulx 24(%[a],%[i],8), %%r10, %%r8\n\t"
+        "adox %%r9, %%r10\n\t"
+        "adcx 24(%[r],%[i],8), %%r10\n\t"
+        "mov %%r10, 24(%[r],%[i],8)\n\t"
+        "lea 4(%[i]), %[i]\n\t"
+        "jrcxz 2f\n\t"
+        "jmp 1b\n"
+        "2:\n\t"
+        "adox %%rax, %%r8\n\t"
+        "adcx %%rax, %%r8\n\t"
+        "mov %%r8, %[c]\n\t"
+        : [i] "+c"(i), [c] "+r"(c)
+        : [r] "r"(r + n), [a] "r"(a + n), "d"(b)
+        : "rax", "r8", "r9", "r10", "cc", "memory");
+    return c;
+}
+
+// The first n mod 4 limbs go through the C loop
+static big_uint limbs_mul_1_adx(big_uint *r, const big_uint *a, size_t n,
+                                big_uint b) {
+    size_t h = n % 4;
+    big_uint c = limbs_mul_1_c(r, a, h, b);
+    return n > h ? mul_4k_adx(r + h, a + h, n - h, b, c) : c;
+}
+static big_uint limbs_addmul_1_adx(big_uint *r, const big_uint *a, size_t n,
+                                   big_uint b) {
+    size_t h = n % 4;
+    big_uint c = limbs_addmul_1_c(r, a, h, b);
+    return n > h ? addmul_4k_adx(r + h, a + h, n - h, b, c) : c;
+}
+
+// CPUID leaf 7: BMI2 brings MULX, ADX brings ADCX and ADOX
+static bool cpu_has_adx(void) {
+    unsigned int eax, ebx, ecx, edx;
+    return __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) &&
+           (ebx & bit_BMI2) && (ebx & bit_ADX);
+}
+#endif
+
+typedef struct {
+    limbs_mul_1_fn *mul_1;
+    limbs_mul_1_fn *addmul_1;
+} limb_kernels;
+
+static const limb_kernels kernels_c = {limbs_mul_1_c, limbs_addmul_1_c};
+#ifdef BIG_HAVE_ADX_KERNELS
+static const limb_kernels kernels_adx = {limbs_mul_1_adx, limbs_addmul_1_adx};
+#endif
+
+static _Atomic(const limb_kernels *) selected_kernels = &kernels_c;
+
+static inline const limb_kernels *limb_kernels_get(void) {
+    return atomic_load_explicit(&selected_kernels, memory_order_relaxed);
+}
+
+int big_select_kernels(int kernels) {
+    if (kernels == BIG_KERNELS_PORTABLE) {
+        atomic_store_explicit(&selected_kernels, &kernels_c,
+                              memory_order_relaxed);
         return 0;
     }
+#ifdef BIG_HAVE_ADX_KERNELS
+    if ((kernels == BIG_KERNELS_ADX || kernels == BIG_KERNELS_AUTO) &&
+        cpu_has_adx()) {
+        atomic_store_explicit(&selected_kernels, &kernels_adx,
+                              memory_order_relaxed);
+        return 0;
+    }
+#endif
+    if (kernels == BIG_KERNELS_AUTO) {
+        return big_select_kernels(BIG_KERNELS_PORTABLE);
+    }
+    return ERR_BIGINT_BAD_INPUT_DATA;
+}
 
-    X->signum = A->signum;
-    resize_limbs(X, A->num_limbs);
+__attribute__((constructor))
+static void select_startup_kernels(void) {
+    big_select_kernels(BIG_KERNELS_AUTO);
+}
 
-    uint64_t borrow = 0;
-    for (int i = A->num_limbs - 1; i >= 0; i--) {
-        big_udbl w = (big_udbl)A->data[i] - borrow;
-        borrow = (borrow > A->data[i]) ? 1 : 0;
-        uint64_t new_limb = (uint64_t)w * 0xAAAAAAAAAAAAAAABLL;
-        if ((uint64_t) new_limb > 0x5555555555555555) {
-            borrow++;
-        }
-        if ((uint64_t) new_limb > 0xAAAAAAAAAAAAAAABLL) {
-            borrow++;
-        }
-        X->data[i] = new_limb;
+// r = a * b (na + nb limbs, na, nb >= 1), one row per limb of the shorter
+// operand. r must not overlap a or b.
+static void limbs_mul(big_uint *r, const big_uint *a, size_t na,
+                      const big_uint *b, size_t nb) {
+    if (na < nb) {
+        const big_uint *t = a;
+        a = b;
+        b = t;
+        size_t tn = na;
+        na = nb;
+        nb = tn;
+    }
+    const limb_kernels *k = limb_kernels_get();
+    r[na] = k->mul_1(r, a, na, b[0]);
+    for (size_t j = 1; j < nb; j++) {
+        r[na + j] = k->addmul_1(r + j, a, na, b[j]);
+    }
+}
+
+int big_mul(bigint *X, const bigint *A, const bigint *B) {
+    // The limbs are copied out first, so X may be A or B
+    int signum = A->signum * B->signum;
+    big_uint *buf = malloc((2 * (A->num_limbs + B->num_limbs) + 1) *
+                           sizeof(big_uint));
+    if (buf == NULL) {
+        return ERR_BIGINT_ALLOC_FAILED;
+    }
+    big_uint *a = buf, *b = buf + A->num_limbs;
+    big_uint *r = b + B->num_limbs;
+    size_t na = limbs_from_big(a, A);
+    size_t nb = limbs_from_big(b, B);
+    int err;
+    if (na == 0 || nb == 0) {
+        err = big_copy(X, &BIG_ZERO);
+    } else {
+        limbs_mul(r, a, na, b, nb);
+        err = limbs_to_big(X, r, na + nb);
+        X->signum = signum;
     }
+    free(buf);
+    return err;
 }
 
-int big_quad_divide_by_3(bigint *X, const bigint *A) {
+int big_divexact(bigint *Q, const bigint *A, const bigint *B) {
+    if (B->signum == 0) {
+        return ERR_BIGINT_DIVISION_BY_ZERO;
+    }
     if (A->signum == 0) {
-        if (X->data != NULL) {
-            free(X->data);
+        return big_copy(Q, &BIG_ZERO);
+    }
+
+    big_uint *a = malloc((A->num_limbs + 1) * sizeof(big_uint));
+    big_uint *b = malloc((B->num_limbs + 1) * sizeof(big_uint));
+    if (a == NULL || b == NULL) {
+        free(a);
+        free(b);
+        return ERR_BIGINT_ALLOC_FAILED;
+    }
+    size_t na = limbs_from_big(a, A);
+    size_t nb = limbs_from_big(b, B);
+    int signum = A->signum * B->signum;
+    int err = 0;
+
+    if (nb == 0) {
+        err = ERR_BIGINT_DIVISION_BY_ZERO;
+        goto cleanup;
+    }
+    if (na == 0) {
+        err = big_copy(Q, &BIG_ZERO);
+        goto cleanup;
+    }
+
+    // Remove the power of two from the divisor (and, since the division
+    // is exact, from A as well) so that B is odd and invertible mod 2^64.
+    size_t tz = 0;
+    while (b[tz / 64] == 0) {
+        tz += 64;
+    }
+    tz += limb_ctz(b[tz / 64]);
+    limbs_shr(a, na, tz);
+    limbs_shr(b, nb, tz);
+    while (na > 0 && a[na - 1] == 0) {
+        na--;
+    }
+    while (b[nb - 1] == 0) {
+        nb--;
+    }
+    if (na < nb) {
+        // A nonzero multiple of B is at least as long as B
+        err = ERR_BIGINT_NOT_ACCEPTABLE;
+        goto cleanup;
+    }
+
+    // Hensel division: the quotient fits in qn limbs, so it equals
+    // A * B^-1 mod 2^(64 qn). Each step fixes the next-lowest limb of
+    // the quotient and clears the matching limb of the running remainder;
+    // nothing above limb qn is ever needed.
+    size_t qn = na - nb + 1;
+    big_uint inv = limb_inverse(b[0]);
+    for (size_t i = 0; i < qn; i++) {
+        big_uint qi = a[i] * inv;
+
+        size_t len = nb < qn - i ? nb : qn - i;
+        big_uint carry = 0;
+        for (size_t j = 0; j < len; j++) {
+            big_udbl prod = (big_udbl)qi * b[j] + carry;
+            big_uint lo = (big_uint)prod;
+            carry = (big_uint)(prod >> 64) + (a[i + j] < lo);
+            a[i + j] -= lo;
         }
-        *X = BIG_ZERO;
-        return 0;
+        for (size_t j = i + len; carry != 0 && j < qn; j++) {
+            big_uint borrow = a[j] < carry;
+            a[j] -= carry;
+            carry = borrow;
+        }
+
+        // a[i] is now zero; reuse its slot for the quotient limb
+        a[i] = qi;
     }
 
-    bigint mod_inv_3; 
-    big_init(&mod_inv_3);
-    mod_inv_3.num_limbs = A->num_limbs;
-    mod_inv_3.signum = 1;
-    mod_inv_3.data = calloc(A->num_limbs, sizeof(big_uint));
-    memset(mod_inv_3.data, 0x55, A->num_limbs * sizeof(big_uint));
-    mod_inv_3.data[A->num_limbs - 1] += 1; 
+    err = resize_limbs(Q, qn);
+    if (err != 0) {
+        goto cleanup;
+    }
+    for (size_t i = 0; i < qn; i++) {
+        Q->data[qn - 1 - i] = a[i];
+    }
+    Q->signum = signum;
+    trim_limbs(Q);
 
-    big_mul(X, A, &mod_inv_3);
-    big_shr(X, X, 64 * mod_inv_3.num_limbs);
-    big_free(&mod_inv_3);
+cleanup:
+    free(a);
+    free(b);
+    return err;
 }
 
-/* Divides A by 3 and stores the result in X */
-int big_fast_divide_by_3_by_approx(bigint *X, const bigint *A) {
-    /*
-     * 1/3 = 1/4 * (1 + 2^-2)(1 + 2^-4)(1 + 2^-8)(1 + 2^-16)...(1 + 2^-i)
-     */
-    
-    // First, right-shift A by 2 
-    printf("After right shift by 2\n");
-    big_print(X);
+// Remainder of a little-endian limb array by a single limb
+static big_uint limbs_mod_1(const big_uint *a, size_t n, big_uint m) {
+    big_uint r = 0;
+    for (size_t i = n; i > 0; i--) {
+        r = (big_uint)((((big_udbl)r << 64) | a[i - 1]) % m);
+    }
+    return r;
+}
 
-    if (A->num_limbs == 0) {
-        if (X->data != NULL) {
-            free(X->data);
+// Remainder of little-endian limb arrays: r = a mod b, following Knuth,
+// TAOCP vol. 2, 4.3.1 Algorithm D. b has nb limbs with b[nb - 1] != 0 and
+// r receives nb limbs. scratch must hold na + nb + 1 limbs.
+static void limbs_mod(big_uint *r, const big_uint *a, size_t na,
+                      const big_uint *b, size_t nb, big_uint *scratch) {
+    if (na < nb) {
+        memcpy(r, a, na * sizeof(big_uint));
+        memset(r + na, 0, (nb - na) * sizeof(big_uint));
+        return;
+    }
+    if (nb == 1) {
+        r[0] = limbs_mod_1(a, na, b[0]);
+        return;
+    }
+
+    // D1: normalize so that the top bit of the divisor is set
+    int s = __builtin_clzll(b[nb - 1]);
+    big_uint *u = scratch;
+    big_uint *v = scratch + na + 1;
+    for (size_t i = nb - 1; i > 0; i--) {
+        v[i] = s == 0 ? b[i] : (b[i] << s) | (b[i - 1] >> (64 - s));
+    }
+    v[0] = b[0] << s;
+    u[na] = s == 0 ? 0 : a[na - 1] >> (64 - s);
+    for (size_t i = na - 1; i > 0; i--) {
+        u[i] = s == 0 ? a[i] : (a[i] << s) | (a[i - 1] >> (64 - s));
+    }
+    u[0] = a[0] << s;
+
+    big_uint vtop = v[nb - 1];
+    big_uint vnext = v[nb - 2];
+    for (size_t j = na - nb + 1; j > 0; j--) {
+        size_t k = j - 1;
+
+        // D3: estimate the quotient limb from the top two limbs
+        big_udbl num = ((big_udbl)u[k + nb] << 64) | u[k + nb - 1];
+        big_udbl qhat = num / vtop;
+        big_udbl rhat = num % vtop;
+        while (qhat >> 64 != 0 ||
+               qhat * vnext > ((rhat << 64) | u[k + nb - 2])) {
+            qhat--;
+            rhat += vtop;
+            if (rhat >> 64 != 0) {
+                break;
+            }
+        }
+
+        // D4: multiply and subtract
+        big_uint carry = 0;
+        big_uint borrow = 0;
+        for (size_t i = 0; i < nb; i++) {
+            big_udbl p = qhat * v[i] + carry;
+            carry = (big_uint)(p >> 64);
+            big_uint lo = (big_uint)p;
+            big_uint t = u[i + k] - lo;
+            big_uint b1 = u[i + k] < lo;
+            u[i + k] = t - borrow;
+            borrow = b1 + (t < borrow);
+        }
+        big_udbl sub = (big_udbl)carry + borrow;
+        bool negative = (big_udbl)u[k + nb] < sub;
+        u[k + nb] -= (big_uint)sub;
+
+        // D6: add back if the estimate was one too large
+        if (negative) {
+            big_uint c = 0;
+            for (size_t i = 0; i < nb; i++) {
+                big_udbl sum = (big_udbl)u[i + k] + v[i] + c;
+                u[i + k] = (big_uint)sum;
+                c = (big_uint)(sum >> 64);
+            }
+            u[k + nb] += c;
         }
-        *X = BIG_ZERO;
-        return 0;
     }
 
-    int i = 2;
-    bigint temp;
-    big_init(&temp);
-    temp.data = calloc(X->num_limbs, sizeof(big_uint));
-    big_copy(X, A);
-    printf("start X = ");
-    big_print(X);
-    while (i <= A->num_limbs * 64) {
-        // Then, X <- X + (X >> 2^2^i+1) for i = 0, 1, 2, ..
-        big_shr(&temp, X, i);
-        big_add(X, X, &temp);
-
-        printf("i = %d:\n", i);
-        printf("temp = ");
-        big_print(&temp);
-        printf("X = ");
-        big_print(X);
-        printf("\n");
-        i *= 2; 
-    }
-    int round = X->data[X->num_limbs - 1] % 4;
-    big_shr(X, X, 2);
-    printf("round = %d\n", round);
-    if (round == 3) {
-        printf("ROUNDING BITCH\n");
-        big_set_nonzero(&temp, 1);
-        big_add(X, X, &temp);
+    // D8: unnormalize the remainder
+    for (size_t i = 0; i < nb; i++) {
+        r[i] = s == 0 ? u[i] : (u[i] >> s) | (u[i + 1] << (64 - s));
     }
-    big_free(&temp);
-    X->signum = A->signum;
-    check_zero(X);
+}
 
+// Binary GCD of two limbs
+static big_uint limb_gcd(big_uint a, big_uint b) {
+    if (a == 0) {
+        return b;
+    }
+    if (b == 0) {
+        return a;
+    }
+    int shift = limb_ctz(a | b);
+    a >>= limb_ctz(a);
+    while (b != 0) {
+        b >>= limb_ctz(b);
+        if (a > b) {
+            big_uint t = a;
+            a = b;
+            b = t;
+        }
+        b -= a;
+    }
+    return a << shift;
 }
 
 // Split the two bigint numbers about the middle
@@ -1009,7 +1416,7 @@ int big_mul_tc(bigint *X, const bigint *A, const bigint *B) {
     size_t len_A = A->num_limbs;
     size_t len_B = B->num_limbs;
 
-    if (LOG_DEBUG) {
+    if (BIG_LOG_DEBUG) {
         printf("len_A: %zu\n", len_A);
         printf("len_B: %zu\n", len_B);
     }
@@ -1108,7 +1515,7 @@ int big_mul_tc(bigint *X, const bigint *A, const bigint *B) {
         trim_limbs(&a_i);
         trim_limbs(&b_i);
 
-        if (LOG_DEBUG) {
+        if (BIG_LOG_DEBUG) {
             printf("points[i] = %d\n", points[i]);
             printf("A(%d) = ", points[i]);
             big_print(&a_i);
@@ -1182,14 +1589,14 @@ int big_mul_tc(bigint *X, const bigint *A, const bigint *B) {
 
     /* (ab)_3 <- (ab(-2) - ab(1)) / 3 */
     big_sub(&ab_coefs[3], &ab_pts[3], &ab_pts[1]);
-    big_fast_divide_by_3(&ab_coefs[3], &ab_coefs[3]);
+    big_divexact_limb(&ab_coefs[3], &ab_coefs[3], 3);
     
     // printf("step (ab)_3 = ");
     // big_print(&ab_coefs[3]);
 
     /* (ab)_1 <- (ab(1) - ab(-1)) / 2 */
     big_sub(&ab_coefs[1], &ab_pts[1], &ab_pts[2]);
-    big_shr(&ab_coefs[1], &ab_coefs[1], 1);
+    big_divexact_limb(&ab_coefs[1], &ab_coefs[1], 2);
     // big_div(&ab_coefs[1], NULL, &ab_coefs[1], &TWO);
     // printf("step (ab)_1 = ");
     // big_print(&ab_coefs[1]);
@@ -1204,7 +1611,7 @@ int big_mul_tc(bigint *X, const bigint *A, const bigint *B) {
     bigint temp; // will be set to 2 * ab(inf)
     big_init(&temp);
     big_sub(&ab_coefs[3], &ab_coefs[2], &ab_coefs[3]);
-    big_shr(&ab_coefs[3], &ab_coefs[3], 1);
+    big_divexact_limb(&ab_coefs[3], &ab_coefs[3], 2);
     big_mul(&temp, &ab_coefs[4], &TWO); 
     big_add(&ab_coefs[3], &ab_coefs[3], &temp);
     big_free(&temp);
@@ -1293,6 +1700,8 @@ int big_div(bigint *Q, bigint *R, const bigint *A, const bigint *B) {
     if (B->num_limbs == 0){
         return ERR_BIGINT_DIVISION_BY_ZERO;
     }
+    // R or Q may be A itself, so its sign is read before either is written
+    int sign_A = A->signum;
 
     bigint abs_A, abs_B;
     big_init(&abs_A);
@@ -1305,19 +1714,20 @@ int big_div(bigint *Q, bigint *R, const bigint *A, const bigint *B) {
 
     // If denominator is greater, quotient is 0 and remainder is A
     if (big_cmp(&abs_A, &abs_B) < 0) {
+        if (R != NULL) {
+            big_copy(R, A);
+            if (R->signum == -1) {
+                big_add(R, R, &abs_B);
+            }
+        }
         if (Q != NULL) {
             big_copy(Q, &BIG_ZERO);
-            if (A->signum != B->signum && A->num_limbs > 0) {
+            if (sign_A != B->signum && sign_A != 0) {
                 bigint one;
                 big_init(&one);
                 big_set_nonzero(&one, 1);
                 big_sub(Q, Q, &one);
-            }
-        }
-        if (R != NULL) {
-            big_copy(R, A);
-            if (R->signum == -1) {
-                big_add(R, R, &abs_B);
+                big_free(&one);
             }
         }
         big_free(&abs_B);
@@ -1338,7 +1748,7 @@ int big_div(bigint *Q, bigint *R, const bigint *A, const bigint *B) {
 
         if (Q != NULL) {
             big_copy(Q, A);
-            Q->signum = A->signum * B->signum;
+            Q->signum = sign_A * B->signum;
         }
         big_free(&abs_A);
         return 0;
@@ -1400,7 +1810,7 @@ int big_div(bigint *Q, bigint *R, const bigint *A, const bigint *B) {
         // the starting digit is index 64 - (A_len % 64) - 1 in A[0]
         // then increases upwards
 
-        if (LOG_DEBUG) {
+        if (BIG_LOG_DEBUG) {
             printf("i = %zu\n", i);
         }
 
@@ -1408,7 +1818,7 @@ int big_div(bigint *Q, bigint *R, const bigint *A, const bigint *B) {
         uint8_t x_i_minus_1 = get_bit_from_array(abs_A.data, abs_A.num_limbs, i - 1);
         uint8_t x_i_minus_2 = get_bit_from_array(abs_A.data, abs_A.num_limbs, i - 2); 
 
-        if (LOG_DEBUG) {
+        if (BIG_LOG_DEBUG) {
             // printf("x_i = %d, x_i_minus_1 = %d, x_i_minus_2 = %d\n", x_i, x_i_minus_1, x_i_minus_2);
         }
         
@@ -1417,7 +1827,7 @@ int big_div(bigint *Q, bigint *R, const bigint *A, const bigint *B) {
 
         size_t i_minus_t_minus_1 = i - len_B;
 
-        if (LOG_DEBUG) {
+        if (BIG_LOG_DEBUG) {
             // printf("i_minus_t_minus_1 = %zu\n", i_minus_t_minus_1);
         }
 
@@ -1428,16 +1838,16 @@ int big_div(bigint *Q, bigint *R, const bigint *A, const bigint *B) {
         } */
 
         if (x_i == y_t) {
-            if (LOG_DEBUG) {
+            if (BIG_LOG_DEBUG) {
                 // printf("x_i == y_t\n");
             }
             set_bit_in_array(Q_data, Q_limbs, i_minus_t_minus_1, 1);
         } else {
-            if (LOG_DEBUG) {
+            if (BIG_LOG_DEBUG) {
                 // printf("x_i != y_t\n");
             }
             if ((x_i * 2 + x_i_minus_1) % 2 == 1) {
-                if (LOG_DEBUG) {
+                if (BIG_LOG_DEBUG) {
                     // printf("x_i != y_t\n");
                 }
                 set_bit_in_array(Q_data, Q_limbs, i_minus_t_minus_1, 1);
@@ -1455,13 +1865,13 @@ int big_div(bigint *Q, bigint *R, const bigint *A, const bigint *B) {
             set_bit_in_array(Q_data, Q_limbs, i_minus_t_minus_1, 0);
         }
 
-        if (LOG_DEBUG) {
+        if (BIG_LOG_DEBUG) {
             // printf("%d %d\n", LHS, RHS);
         }
 
         // 3.3
         if (get_bit_from_array(Q_data, Q_limbs, i_minus_t_minus_1) != 0){
-            if (LOG_DEBUG) {
+            if (BIG_LOG_DEBUG) {
                 // printf("3.3 case\n");
             }
             bigint YBIT1;
@@ -1472,7 +1882,7 @@ int big_div(bigint *Q, bigint *R, const bigint *A, const bigint *B) {
             }
             big_mul(&YBIT1, &YBIT1, B);
             YBIT1.signum = 1;
-            if (LOG_DEBUG) {
+            if (BIG_LOG_DEBUG) {
                 printf("prev X = ");
                 big_print(&abs_A);
                 printf("Subtracting YBIT1 = ");
@@ -1482,7 +1892,7 @@ int big_div(bigint *Q, bigint *R, const bigint *A, const bigint *B) {
             
             if (abs_A.signum == -1) {
                 // 3.4, no need to recompute
-                if (LOG_DEBUG) {
+                if (BIG_LOG_DEBUG) {
                     printf("3.4\n");
                 }
                 big_add(&abs_A, &abs_A, &YBIT1);
@@ -1512,12 +1922,14 @@ int big_div(bigint *Q, bigint *R, const bigint *A, const bigint *B) {
         // printf("q_i-t-1 = %d\n", get_bit_from_array(Q_data, Q_limbs, i_minus_t_minus_1));
     }
 
+    bool inexact = big_cmp(&abs_A, &BIG_ZERO) != 0;
     if (R != NULL) {
         big_copy(R, &abs_A);
-        if (R->signum == -1) {
-            big_add(R, R, &abs_B);
-        }
         trim_limbs(R);
+        if (inexact && sign_A == -1 && B->signum != -1) {
+            // R = B - R
+            big_sub(R, B, R);
+        }
     }
     if (Q != NULL) {
         if (Q->data != NULL) {
@@ -1525,19 +1937,15 @@ int big_div(bigint *Q, bigint *R, const bigint *A, const bigint *B) {
         }
         Q->data = Q_data;
         Q->num_limbs = Q_limbs;
-        Q->signum = A->signum * B->signum;
+        Q->signum = sign_A * B->signum;
         trim_limbs(Q);
 
-        if (A->signum != B->signum && big_cmp(&abs_A, &BIG_ZERO) != 0) {
+        if (sign_A != B->signum && inexact) {
             bigint one;
             big_init(&one);
             big_set_nonzero(&one, 1);
             big_sub(Q, Q, &one);
-
-            if (R != NULL && A->signum == -1 && B->signum != -1) {
-                // R = B - R
-                big_sub(R, B, R);
-            }
+            big_free(&one);
         }
     }
 
@@ -1548,11 +1956,62 @@ int big_div(bigint *Q, bigint *R, const bigint *A, const bigint *B) {
     return 0; 
 }
 
+// Computed on the limbs with Knuth's algorithm D instead of bit by bit
+// like big_div, and without forming the quotient
 int big_mod(bigint *R, const bigint *A, const bigint *B) {
-    bigint Q;
-    big_init(&Q);
-    big_div(&Q, R, A, B);
-    big_free(&Q);
+    if (B->signum == 0) {
+        return ERR_BIGINT_DIVISION_BY_ZERO;
+    }
+    big_uint *a = malloc((A->num_limbs + 1) * sizeof(big_uint));
+    big_uint *b = malloc(B->num_limbs * sizeof(big_uint));
+    big_uint *r = malloc(B->num_limbs * sizeof(big_uint));
+    big_uint *scratch = malloc((A->num_limbs + B->num_limbs + 2) * sizeof(big_uint));
+    int err = 0;
+    if (a == NULL || b == NULL || r == NULL || scratch == NULL) {
+        err = ERR_BIGINT_ALLOC_FAILED;
+    }
+    if (err == 0) {
+        size_t na = limbs_from_big(a, A);
+        size_t nb = limbs_from_big(b, B);
+        limbs_mod(r, a, na, b, nb, scratch);
+
+        bool zero = true;
+        for (size_t i = 0; i < nb; i++) {
+            zero = zero && r[i] == 0;
+        }
+        // A negative A leaves |B| - R, the non-negative residue
+        if (!zero && A->signum == -1) {
+            big_uint borrow = 0;
+            for (size_t i = 0; i < nb; i++) {
+                big_uint d = b[i] - r[i];
+                big_uint b1 = b[i] < r[i];
+                r[i] = d - borrow;
+                borrow = b1 + (d < borrow);
+            }
+        }
+        // R may be A or B, which are not read from here on
+        err = limbs_to_big(R, r, nb);
+    }
+    free(a);
+    free(b);
+    free(r);
+    free(scratch);
+    return err;
+}
+
+int big_mod_limb(big_uint *r, const bigint *A, big_uint b) {
+    if (b == 0) {
+        return ERR_BIGINT_DIVISION_BY_ZERO;
+    }
+
+    big_uint rem = 0;
+    for (size_t i = 0; i < A->num_limbs; i++) {
+        rem = (big_uint)((((big_udbl)rem << 64) | A->data[i]) % b);
+    }
+    if (A->signum == -1 && rem != 0) {
+        rem = b - rem;
+    }
+    *r = rem;
     return 0;
 }
 
@@ -1868,6 +2327,135 @@ int big_gcd(bigint *G, const bigint *A, const bigint *B) {
 //     return 0;
 // }
 
+// x = a^-1 mod N for an odd N of n limbs, by the binary extended Euclidean
+// algorithm (HAC 14.61 with the halvings done modulo N): only shifts,
+// additions and subtractions of limb arrays, so no divisions at all.
+// Keeps x1 * a = u and x2 * a = v (mod N) with v odd. a must be below N;
+// returns false if gcd(a, N) != 1. scratch holds 4 n limbs.
+static bool limbs_inv_mod_odd(big_uint *x, const big_uint *a,
+                              const big_uint *N, size_t n, big_uint *scratch) {
+    big_uint *u = scratch, *v = scratch + n;
+    big_uint *x1 = scratch + 2 * n, *x2 = scratch + 3 * n;
+    memcpy(u, a, n * sizeof(big_uint));
+    memcpy(v, N, n * sizeof(big_uint));
+    memset(x1, 0, n * sizeof(big_uint));
+    memset(x2, 0, n * sizeof(big_uint));
+    x1[0] = 1;
+    big_uint n_inv = limb_inverse(N[0]);
+
+    // u and v only shrink, so their loops stop at the top nonzero limb
+    size_t len = n;
+    for (;;) {
+        while (len > 0 && u[len - 1] == 0 && v[len - 1] == 0) {
+            len--;
+        }
+        bool u_zero = true;
+        for (size_t i = 0; i < len; i++) {
+            u_zero = u_zero && u[i] == 0;
+        }
+        if (u_zero) {
+            break;
+        }
+
+        // u = u / 2^k, and x1 = x1 / 2^k mod N by first adding the
+        // multiple m N that clears the low k bits (as in a Montgomery
+        // reduction); x1 + m N < 2^k N keeps the quotient below N
+        while ((u[0] & 1) == 0) {
+            int k = u[0] == 0 ? 63 : limb_ctz(u[0]);
+            limbs_shr(u, len, k);
+            big_uint m = -(x1[0] * n_inv) & (((big_uint)1 << k) - 1);
+            big_uint carry = 0;
+            for (size_t i = 0; i < n; i++) {
+                big_udbl t = (big_udbl)m * N[i] + x1[i] + carry;
+                x1[i] = (big_uint)t;
+                carry = (big_uint)(t >> 64);
+            }
+            limbs_shr(x1, n, k);
+            x1[n - 1] |= carry << (64 - k);
+        }
+
+        // the larger of u and v drops by the smaller, and its coefficient
+        // by the other coefficient, modulo N; u is made the even one again
+        size_t i = len;
+        while (i > 0 && u[i - 1] == v[i - 1]) {
+            i--;
+        }
+        if (i == 0 || u[i - 1] < v[i - 1]) {
+            big_uint *t = u;
+            u = v;
+            v = t;
+            t = x1;
+            x1 = x2;
+            x2 = t;
+        }
+        big_uint borrow = 0;
+        for (size_t j = 0; j < len; j++) {
+            big_uint d = u[j] - v[j];
+            big_uint b1 = u[j] < v[j];
+            u[j] = d - borrow;
+            borrow = b1 + (d < borrow);
+        }
+        borrow = 0;
+        for (size_t j = 0; j < n; j++) {
+            big_uint d = x1[j] - x2[j];
+            big_uint b1 = x1[j] < x2[j];
+            x1[j] = d - borrow;
+            borrow = b1 + (d < borrow);
+        }
+        if (borrow) {
+            big_uint carry = 0;
+            for (size_t j = 0; j < n; j++) {
+                big_uint s1 = x1[j] + N[j];
+                big_uint c1 = s1 < N[j];
+                x1[j] = s1 + carry;
+                carry = c1 + (x1[j] < carry);
+            }
+        }
+    }
+
+    // u = 0 and v = gcd(a, N)
+    memcpy(x, x2, n * sizeof(big_uint));
+    for (size_t i = 1; i < len; i++) {
+        if (v[i] != 0) {
+            return false;
+        }
+    }
+    return v[0] == 1;
+}
+
+// big_inv_mod for odd N: A is reduced and inverted with limbs_inv_mod_odd
+static int big_inv_mod_odd(bigint *X, const bigint *A, const bigint *N) {
+    size_t n = N->num_limbs;
+    bigint R;
+    big_init(&R);
+    big_uint *a = calloc(n, sizeof(big_uint));
+    big_uint *x = malloc(n * sizeof(big_uint));
+    big_uint *m = malloc(n * sizeof(big_uint));
+    big_uint *scratch = malloc(4 * n * sizeof(big_uint));
+    int err = 0;
+    if (a == NULL || x == NULL || m == NULL || scratch == NULL) {
+        err = ERR_BIGINT_ALLOC_FAILED;
+    }
+    if (err == 0) {
+        err = big_mod(&R, A, N);
+    }
+    if (err == 0) {
+        limbs_from_big(a, &R);
+        n = limbs_from_big(m, N);
+        if (!limbs_inv_mod_odd(x, a, m, n, scratch)) {
+            err = ERR_BIGINT_NOT_ACCEPTABLE;
+        } else {
+            err = limbs_to_big(X, x, n);
+        }
+    }
+    big_free(&R);
+    free(a);
+    free(x);
+    free(m);
+    free(scratch);
+    return err;
+}
+
 int big_inv_mod(bigint *X, const bigint *A, const bigint *N) {
     // 2.107
     bigint one;
@@ -1880,8 +2468,13 @@ int big_inv_mod(bigint *X, const bigint *A, const bigint *N) {
         return ERR_BIGINT_BAD_INPUT_DATA;
     }
     if (big_cmp(A, &BIG_ZERO) == 0){
+        big_free(&one);
         return ERR_BIGINT_NOT_ACCEPTABLE;
     }
+    if (N->data[N->num_limbs - 1] & 1) {
+        big_free(&one);
+        return big_inv_mod_odd(X, A, N);
+    }
 
     bigint temp;
     big_init(&temp);
@@ -1980,33 +2573,16 @@ int big_inv_mod(bigint *X, const bigint *A, const bigint *N) {
 
         // printf("ENDLOOP\n");
     }
-    printf("b = ");
-    big_print(smol);
-
-    printf("d = ");
-    big_print(big);
-
-    printf("x2 = ");
-    big_print(&x2);
-
-    printf("y2 = ");
-    big_print(&y2);
-
     big_copy(X, &x2);
 
     if (A_is_small) {
-        printf("A_is_small\n");
+        // x2 * N + y2 * A = 1, so the inverse is y2
         big_copy(X, &y2);
     }
 
+    // |X| < N, so a single addition brings it into range
     while (X->signum == -1) {
-        // printf("new X = ");
-        // big_print(X);
-        if (A_is_small){
-            big_add(X, X, A);
-        } else {
-            big_add(X, X, N);
-        }
+        big_add(X, X, N);
     }
     // make sure big = 1, otherwise, no modular inverse
 
@@ -2030,366 +2606,2026 @@ int big_inv_mod(bigint *X, const bigint *A, const bigint *N) {
 }
 
 
-int mont_mul(bigint *result, bigint *m, bigint *x, bigint *y) {
-    // algo 14.36, not tested
-    // Base 2^64
-    bigint b;
-    b.signum = 1;
-    b.num_limbs = 2;
-    b.data = malloc(sizeof(big_uint) * 2);
-    b.data[0] = 1;
-    b.data[1] = 0;
-
-    bigint m_prime;
-    big_init(&m_prime);
-    m_prime.signum *= -1;
-    big_inv_mod(&m_prime, m, &b);
+/*
+ * Montgomery arithmetic modulo an odd N of n limbs, with R = 2^(64 n).
+ * Values are little-endian limb arrays of length n, kept below N.
+ */
+typedef struct {
+    size_t n;              /*!<  number of limbs of N          */
+    big_uint n0;           /*!<  -N^-1 mod 2^64                */
+    big_uint *N;           /*!<  the modulus                   */
+    big_uint *RR;          /*!<  R^2 mod N                     */
+    big_uint *one;         /*!<  R mod N, the image of 1       */
+    big_uint *scratch;     /*!<  2n + 1 limbs for mont_redc    */
+} mont_ctx;
+
+static void mont_free(mont_ctx *ctx) {
+    free(ctx->N);
+    free(ctx->RR);
+    free(ctx->one);
+    free(ctx->scratch);
+    ctx->N = ctx->RR = ctx->one = ctx->scratch = NULL;
+}
 
-    bigint y_0;
-    big_init(&y_0);
-    if (y->num_limbs > 0) {
-        big_set_nonzero(&y_0, y->data[y->num_limbs - 1]);
-    } else {
-        y_0 = BIG_ZERO;
-    }
-
-    bigint A;
-    big_init(&A);
-    bigint x_i;
-    big_init(&x_i);
-    bigint xiy0;
-    big_init(&xiy0);
-    bigint a0;
-    big_init(&a0);
-    bigint axy;
-    big_init(&axy);
-    bigint axym_prime;
-    big_init(&axym_prime);
-    bigint u_i;
-    big_init(&u_i);
-    bigint xiy;
-    big_init(&xiy);
-    bigint uim;
-    big_init(&uim);
-    bigint Axiy;
-    big_init(&Axiy);
-    bigint Axiyuim;
-    big_init(&Axiyuim);
-    bigint remainder;
-    big_init(&remainder);
-    
-    for (size_t i = 0; i < x->num_limbs; i++) {
-        // 2.1 
-        if (x->data[x->num_limbs - i - 1] != 0){
-            big_set_nonzero(&x_i, x->data[x->num_limbs - i - 1]);
-            big_mul(&xiy0, &x_i, &y_0);
-        } else {
-            big_copy(&xiy0, &BIG_ZERO);
-        }
-        if (A.num_limbs > 0){
-            big_set_nonzero(&a0, A.data[A.num_limbs - 1]);
-            big_add(&axy, &a0, &xiy0);
+// out = t * R^-1 mod N for the 2n-limb t < N R, one limb of t cleared
+// per row: t += m * N * 2^(64 i). Each row's carry goes into limb i + n,
+// and the carry out of that limb into the next row. t is overwritten and
+// must have room for 2n + 1 limbs; out may alias the lower half.
+static void mont_redc(const mont_ctx *ctx, big_uint *out, big_uint *t) {
+    size_t n = ctx->n;
+    const big_uint *N = ctx->N;
+    limbs_mul_1_fn *addmul_1 = limb_kernels_get()->addmul_1;
+    big_uint top = 0;
+    for (size_t i = 0; i < n; i++) {
+        big_uint c = addmul_1(t + i, N, n, t[i] * ctx->n0);
+        big_udbl uv = (big_udbl)t[i + n] + c + top;
+        t[i + n] = (big_uint)uv;
+        top = (big_uint)(uv >> 64);
+    }
+    t += n;
+    t[n] = top;
+
+    // t < 2N: one conditional subtraction
+    bool ge = t[n] != 0;
+    if (!ge) {
+        ge = true;
+        for (size_t j = n; j > 0; j--) {
+            if (t[j - 1] != N[j - 1]) {
+                ge = t[j - 1] > N[j - 1];
+                break;
+            }
         }
-        big_mul(&axym_prime, &axy, &m_prime);
-        big_mod(&u_i, &axym_prime, &b);
-
-        // 2.2
-        big_mul(&xiy, &x_i, y);
-        big_mul(&uim, &u_i, m);
-        big_add(&Axiy, &A, &xiy);
-        big_add(&Axiyuim, &Axiy, &uim);
-        
-        // ignore remainder
-        big_div(&A, &remainder, &Axiyuim, &b);
     }
-        
-    // 3
-    if (big_cmp(&A, m) >= 0) {
-        big_sub(&A, &A, m);
+    if (ge) {
+        big_uint borrow = 0;
+        for (size_t j = 0; j < n; j++) {
+            big_uint d = t[j] - N[j];
+            big_uint b1 = t[j] < N[j];
+            out[j] = d - borrow;
+            borrow = b1 + (d < borrow);
+        }
+    } else {
+        memcpy(out, t, n * sizeof(big_uint));
     }
-    
-    // 4
-    big_copy(result, &A);
-
-    big_free(&x_i);
-    big_free(&xiy0);
-    big_free(&a0);
-    big_free(&axy);
-    big_free(&m_prime);
-    big_free(&axym_prime);
-    big_free(&u_i);
-    big_free(&xiy);
-    big_free(&uim);
-    big_free(&Axiy);
-    big_free(&Axiyuim);
-    big_free(&remainder);
-    big_free(&b);
-    big_free(&A);
-    big_free(&y_0);
-    return 0;
 }
 
-uint8_t get_bit_from_arr(big_uint *data, int idx, size_t data_idx, size_t sigfigs){
-    // from left to right, 0 -> least sig bit
-    // not tested
-    int max_idx = data_idx == 0 ? sigfigs-1 : 15;
-    size_t loc = (max_idx - (idx % 16));
-    // printf("loc = %d\n", loc);
-    // printf("data_idx = %d\n", data_idx);
-    // printf("ret = %d\n", (data[data_idx] >> loc) & 1);
-    // printf("----------------------\n");
-    return (data[data_idx] >> loc) & 1;
+// out = a * b * R^-1 mod N: the full product, then mont_redc. out may
+// alias a or b.
+static void mont_mul(const mont_ctx *ctx, big_uint *out,
+                     const big_uint *a, const big_uint *b) {
+    limbs_mul(ctx->scratch, a, ctx->n, b, ctx->n);
+    mont_redc(ctx, out, ctx->scratch);
 }
 
-int big_exp_mod(bigint *X, const bigint *A, const bigint *E, const bigint *N, bigint *_RR) {
-    // algo 14.94
-    // 1
-    bigint R;
-    big_init(&R);
-    big_two_to_pwr(&R, 64 * N->num_limbs);
-    
-    bigint R2;
-    big_init(&R2);
-    big_two_to_pwr(&R2, 2 * 64 * N->num_limbs);
-    
-    bigint R2_mod_N;
-    big_init(&R2_mod_N);
-    big_mod(&R2_mod_N, &R2, N);
-    big_copy(_RR, &R2_mod_N);
-    
-    bigint x_tilde;
-    big_init(&x_tilde);
-    mont_mul(&x_tilde, N, A, &R2_mod_N);
-    // printf("x_tilde = ");
-    
-    bigint R_mod_N;
-    big_init(&R_mod_N);
-    big_mod(&R_mod_N, &R, N);
-    
-    big_copy(A, &R_mod_N);
- 
-    // 2
-    bigint mont_A;
-    big_init(&mont_A);
-
-    size_t e_bits = (E->num_limbs-1) * 16;
-    size_t sigfigs = 0;
-    uint64_t first_idx = E->data[0];
-    while (first_idx){
-        e_bits++;
-        sigfigs++;
-        first_idx >>= 1;
-    }
-    // printf("e_bits = %d\n", e_bits);
-    // printf("sigfigs = %d\n", sigfigs);
-    
-    for (size_t i = 0; i < e_bits; i++) {
-        // 2.1
-        mont_mul(&mont_A, N, A, A);
-        big_copy(A, &mont_A);
+// out = a^2 * R^-1 mod N. The cross products a[i] a[j], i < j, are summed
+// once and doubled, which saves about a quarter of the multiplications of
+// mont_mul(ctx, out, a, a); the 2n-limb square then goes to mont_redc.
+// out may alias a.
+static void mont_sqr(const mont_ctx *ctx, big_uint *out, const big_uint *a) {
+    size_t n = ctx->n;
+    big_uint *t = ctx->scratch;
+    memset(t, 0, (2 * n + 1) * sizeof(big_uint));
+
+    limbs_mul_1_fn *addmul_1 = limb_kernels_get()->addmul_1;
+    for (size_t i = 0; i + 1 < n; i++) {
+        t[i + n] = addmul_1(t + 2 * i + 1, a + i + 1, n - i - 1, a[i]);
+    }
+    big_uint top = 0;
+    for (size_t i = 0; i < 2 * n; i++) {
+        big_uint next = t[i] >> 63;
+        t[i] = t[i] << 1 | top;
+        top = next;
+    }
+    big_uint c = 0;
+    for (size_t i = 0; i < n; i++) {
+        big_udbl sq = (big_udbl)a[i] * a[i];
+        big_udbl uv = (big_udbl)t[2 * i] + (big_uint)sq + c;
+        t[2 * i] = (big_uint)uv;
+        uv = (big_udbl)t[2 * i + 1] + (big_uint)(sq >> 64) + (big_uint)(uv >> 64);
+        t[2 * i + 1] = (big_uint)uv;
+        c = (big_uint)(uv >> 64);
+    }
+    mont_redc(ctx, out, t);
+}
+
+// Sets up ctx for the odd modulus N. If RR is given and nonzero it is
+// taken as R^2 mod N; otherwise R^2 mod N is computed.
+static int mont_init(mont_ctx *ctx, const bigint *N, const bigint *RR) {
+    size_t n = N->num_limbs;
+    ctx->N = calloc(n, sizeof(big_uint));
+    ctx->RR = calloc(n, sizeof(big_uint));
+    ctx->one = calloc(n, sizeof(big_uint));
+    ctx->scratch = calloc(2 * n + 1, sizeof(big_uint));
+    if (ctx->N == NULL || ctx->RR == NULL || ctx->one == NULL ||
+        ctx->scratch == NULL) {
+        mont_free(ctx);
+        return ERR_BIGINT_ALLOC_FAILED;
+    }
+    ctx->n = limbs_from_big(ctx->N, N);
+    n = ctx->n;
+    ctx->n0 = -limb_inverse(ctx->N[0]);
 
-        // 2.2
-        int d_idx = (e_bits - i)/16;
-        uint8_t curr_e_bit = get_bit_from_arr(E->data, i, d_idx, sigfigs);
-        if (curr_e_bit == 1) {
-            mont_mul(&mont_A, N, A, &x_tilde);
-            big_copy(A, &mont_A); // can condense into 1 line
+    if (RR != NULL && RR->signum != 0) {
+        limbs_from_big(ctx->RR, RR);
+    } else {
+        // R^2 = 2^(128 n), reduced with a single long division
+        big_uint *r2 = calloc(2 * n + 1, sizeof(big_uint));
+        big_uint *div_scratch = malloc((3 * n + 2) * sizeof(big_uint));
+        if (r2 == NULL || div_scratch == NULL) {
+            free(r2);
+            free(div_scratch);
+            mont_free(ctx);
+            return ERR_BIGINT_ALLOC_FAILED;
         }
+        r2[2 * n] = 1;
+        limbs_mod(ctx->RR, r2, 2 * n + 1, ctx->N, n, div_scratch);
+        free(r2);
+        free(div_scratch);
     }
 
-    // 3
-    bigint one;
-    big_init(&one);
-    big_set_nonzero(&one, 1);
-    mont_mul(X, N, A, &one);
+    // R mod N = mont_mul(R^2 mod N, 1)
+    ctx->one[0] = 1;
+    mont_mul(ctx, ctx->one, ctx->RR, ctx->one);
+    return 0;
+}
 
-    big_free(&R);
-    big_free(&R2);
-    big_free(&R2_mod_N);
-    big_free(&x_tilde);
-    big_free(&R_mod_N);
-    big_free(&mont_A);
-    big_free(&one);
+// Bit i (counted from the least significant bit) of a non-negative bigint
+static int big_get_bit(const bigint *X, size_t i) {
+    if (i / 64 >= X->num_limbs) {
+        return 0;
+    }
+    return (X->data[X->num_limbs - 1 - i / 64] >> (i % 64)) & 1;
+}
+
+// Sliding-window exponentiation in the Montgomery domain:
+// out = base^E, where base and out are Montgomery images.
+static int mont_exp(const mont_ctx *ctx, big_uint *out, const big_uint *base,
+                    const bigint *E) {
+    size_t n = ctx->n;
+    size_t ebits = big_bitlen(E);
+    size_t w = ebits > 671 ? 6 : ebits > 239 ? 5 : ebits > 79 ? 4 : ebits > 23 ? 3 : 1;
+
+    // table[i] = base^(2i + 1)
+    size_t table_size = (size_t)1 << (w - 1);
+    big_uint *table = malloc((table_size + 1) * n * sizeof(big_uint));
+    if (table == NULL) {
+        return ERR_BIGINT_ALLOC_FAILED;
+    }
+    big_uint *sq = table + table_size * n;
+    memcpy(table, base, n * sizeof(big_uint));
+    if (table_size > 1) {
+        mont_mul(ctx, sq, base, base);
+        for (size_t i = 1; i < table_size; i++) {
+            mont_mul(ctx, table + i * n, table + (i - 1) * n, sq);
+        }
+    }
+
+    memcpy(out, ctx->one, n * sizeof(big_uint));
+    size_t i = ebits;
+    while (i > 0) {
+        if (!big_get_bit(E, i - 1)) {
+            mont_sqr(ctx, out, out);
+            i--;
+            continue;
+        }
+        // Longest window of at most w bits that ends in a one
+        size_t low = i > w ? i - w : 0;
+        while (!big_get_bit(E, low)) {
+            low++;
+        }
+        size_t value = 0;
+        for (size_t j = i; j > low; j--) {
+            value = (value << 1) | big_get_bit(E, j - 1);
+            mont_sqr(ctx, out, out);
+        }
+        mont_mul(ctx, out, out, table + (value >> 1) * n);
+        i = low;
+    }
 
+    free(table);
     return 0;
 }
 
-bigint *load_primes(const char *filename, size_t num_primes) {
-    bigint *result = malloc(num_primes * sizeof(bigint));
-    
-    FILE *f = fopen(filename, "r");
-    assert(f != NULL);
+// Modular helpers for Montgomery images (values below N, n limbs)
+static void mont_add(const mont_ctx *ctx, big_uint *out, const big_uint *a,
+                     const big_uint *b) {
+    size_t n = ctx->n;
+    big_uint carry = 0;
+    for (size_t j = 0; j < n; j++) {
+        big_uint s = a[j] + carry;
+        carry = s < carry;
+        out[j] = s + b[j];
+        carry += out[j] < s;
+    }
+    bool ge = carry != 0;
+    if (!ge) {
+        ge = true;
+        for (size_t j = n; j > 0; j--) {
+            if (out[j - 1] != ctx->N[j - 1]) {
+                ge = out[j - 1] > ctx->N[j - 1];
+                break;
+            }
+        }
+    }
+    if (ge) {
+        big_uint borrow = 0;
+        for (size_t j = 0; j < n; j++) {
+            big_uint d = out[j] - ctx->N[j];
+            big_uint b1 = out[j] < ctx->N[j];
+            out[j] = d - borrow;
+            borrow = b1 + (d < borrow);
+        }
+    }
+}
 
-    char *line = NULL;
-    size_t len = 0;
+static void mont_sub(const mont_ctx *ctx, big_uint *out, const big_uint *a,
+                     const big_uint *b) {
+    size_t n = ctx->n;
+    big_uint borrow = 0;
+    for (size_t j = 0; j < n; j++) {
+        big_uint d = a[j] - b[j];
+        big_uint b1 = a[j] < b[j];
+        out[j] = d - borrow;
+        borrow = b1 + (d < borrow);
+    }
+    if (borrow) {
+        big_uint carry = 0;
+        for (size_t j = 0; j < n; j++) {
+            big_uint s = out[j] + carry;
+            carry = s < carry;
+            out[j] = s + ctx->N[j];
+            carry += out[j] < s;
+        }
+    }
+}
 
-    ssize_t read; 
+// x = x / 2 mod N. Halving commutes with the Montgomery factor R.
+static void mont_half(const mont_ctx *ctx, big_uint *x) {
+    size_t n = ctx->n;
+    big_uint top = 0;
+    if (x[0] & 1) {
+        big_uint carry = 0;
+        for (size_t j = 0; j < n; j++) {
+            big_uint s = x[j] + carry;
+            carry = s < carry;
+            x[j] = s + ctx->N[j];
+            carry += x[j] < s;
+        }
+        top = carry;
+    }
+    for (size_t j = 0; j < n; j++) {
+        big_uint next = j + 1 < n ? x[j + 1] : top;
+        x[j] = (x[j] >> 1) | (next << 63);
+    }
+}
 
-    for (size_t i = 0; i < num_primes; i++) {
-        big_init(&result[i]);
+// out = a * v mod N for a small signed v, by double-and-add; much
+// cheaper than a Montgomery multiplication. out must not alias a.
+static void mont_mul_small(const mont_ctx *ctx, big_uint *out,
+                           const big_uint *a, big_sint v) {
+    size_t n = ctx->n;
+    big_uint mag = v < 0 ? -(big_uint)v : (big_uint)v;
+    memset(out, 0, n * sizeof(big_uint));
+    for (int i = 63 - __builtin_clzll(mag | 1); i >= 0; i--) {
+        mont_add(ctx, out, out, out);
+        if ((mag >> i) & 1) {
+            mont_add(ctx, out, out, a);
+        }
     }
+    if (v < 0) {
+        big_uint *zero = ctx->scratch;
+        memset(zero, 0, n * sizeof(big_uint));
+        mont_sub(ctx, out, zero, out);
+    }
+}
 
-    int count = 0; 
-    while ((read = getline(&line, &len, f)) != -1 && count < (int)num_primes) {
-        line[read - 1] = '\0';
-        big_read_string(&result[count], (const char *)line);
+static bool limbs_is_zero(const big_uint *x, size_t n) {
+    for (size_t j = 0; j < n; j++) {
+        if (x[j] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
 
-        count++;
+// out = 2^E in the Montgomery domain. Multiplying by the base 2 is a
+// doubling (a shift by one bit and a conditional subtraction), so only
+// the squarings cost a full Montgomery multiplication.
+static void mont_exp2(const mont_ctx *ctx, big_uint *out, const bigint *E) {
+    size_t n = ctx->n;
+    memcpy(out, ctx->one, n * sizeof(big_uint));
+    size_t i = big_bitlen(E);
+    if (i == 0) {
+        return;
+    }
+
+    // The leading (up to four) bits need no squaring: 2^top is just
+    // `top` doublings of 1
+    size_t top = 0;
+    while (i > 0 && top < 8) {
+        top = (top << 1) | big_get_bit(E, i - 1);
+        i--;
+    }
+    for (size_t j = 0; j < top; j++) {
+        mont_add(ctx, out, out, out);
     }
 
-    free(line);
-    return result; 
+    for (; i > 0; i--) {
+        mont_sqr(ctx, out, out);
+        if (big_get_bit(E, i - 1)) {
+            mont_add(ctx, out, out, out);
+        }
+    }
 }
 
-int big_is_prime(const bigint *X) {
-    bigint ONE, TWO, FOUR;
-    big_init(&ONE);
-    big_set_nonzero(&ONE, 1);
-    big_init(&TWO);
-    big_set_nonzero(&TWO, 2);
-    big_init(&FOUR);
-    big_set_nonzero(&FOUR, 4);
+int big_exp_mod(bigint *X, const bigint *A, const bigint *E, const bigint *N, bigint *_RR) {
+    if (N->signum != 1 || (N->data[N->num_limbs - 1] & 1) == 0 ||
+        E->signum == -1) {
+        return ERR_BIGINT_BAD_INPUT_DATA;
+    }
 
-    // corner cases
-    if (big_cmp(X, &ONE) <= 0 || big_cmp(X, &FOUR) == 0) {
-        big_free(&ONE);
-        big_free(&TWO);
-        big_free(&FOUR);
-        return ERR_BIGINT_NOT_ACCEPTABLE;
+    mont_ctx ctx;
+    int err = mont_init(&ctx, N, _RR);
+    if (err != 0) {
+        return err;
     }
-    if (big_cmp(X, &FOUR) < 0) {
-        // 2 or 3
-        big_free(&ONE);
-        big_free(&TWO);
-        big_free(&FOUR);
-        return 0;
+    size_t n = ctx.n;
+    if (_RR != NULL && _RR->signum == 0) {
+        err = limbs_to_big(_RR, ctx.RR, n);
+    }
+
+    // Reduce A modulo N (as a non-negative residue) and convert it
+    big_uint *a = calloc(A->num_limbs + 1, sizeof(big_uint));
+    big_uint *x = calloc(2 * n, sizeof(big_uint));
+    big_uint *div_scratch = malloc((A->num_limbs + n + 2) * sizeof(big_uint));
+    if (a == NULL || x == NULL || div_scratch == NULL) {
+        err = ERR_BIGINT_ALLOC_FAILED;
+    }
+    if (err == 0) {
+        size_t na = limbs_from_big(a, A);
+        limbs_mod(x, a, na, ctx.N, n, div_scratch);
+        if (A->signum == -1) {
+            bool zero = true;
+            for (size_t i = 0; i < n; i++) {
+                zero = zero && x[i] == 0;
+            }
+            if (!zero) {
+                // x = N - x
+                big_uint borrow = 0;
+                for (size_t i = 0; i < n; i++) {
+                    big_uint d = ctx.N[i] - x[i];
+                    big_uint b1 = ctx.N[i] < x[i];
+                    x[i] = d - borrow;
+                    borrow = b1 + (d < borrow);
+                }
+            }
+        }
+        mont_mul(&ctx, x, x, ctx.RR);
+
+        big_uint *result = x + n;
+        err = mont_exp(&ctx, result, x, E);
+        if (err == 0) {
+            // Leave the Montgomery domain: multiply by 1
+            memset(x, 0, n * sizeof(big_uint));
+            x[0] = 1;
+            mont_mul(&ctx, result, result, x);
+            err = limbs_to_big(X, result, n);
+        }
     }
-    
-    bigint remainder_mod_2; 
-    big_init(&remainder_mod_2);
-    big_mod(&remainder_mod_2, X, &TWO);
-
-    // If X is even, don't even do the rest
-    if (big_cmp(&remainder_mod_2, &BIG_ZERO) == 1) {
-        big_free(&ONE);
-        big_free(&TWO);
-        big_free(&FOUR);
-        big_free(&remainder_mod_2);
-        return ERR_BIGINT_NOT_ACCEPTABLE;
+
+    free(a);
+    free(x);
+    free(div_scratch);
+    mont_free(&ctx);
+    return err;
+}
+
+int big_exp2_mod(bigint *X, const bigint *E, const bigint *N, bigint *_RR) {
+    if (N->signum != 1 || (N->data[N->num_limbs - 1] & 1) == 0 ||
+        E->signum == -1) {
+        return ERR_BIGINT_BAD_INPUT_DATA;
+    }
+
+    mont_ctx ctx;
+    int err = mont_init(&ctx, N, _RR);
+    if (err != 0) {
+        return err;
+    }
+    size_t n = ctx.n;
+    if (_RR != NULL && _RR->signum == 0) {
+        err = limbs_to_big(_RR, ctx.RR, n);
+    }
+
+    big_uint *x = calloc(2 * n, sizeof(big_uint));
+    if (x == NULL) {
+        err = ERR_BIGINT_ALLOC_FAILED;
+    }
+    if (err == 0) {
+        big_uint *result = x + n;
+        mont_exp2(&ctx, result, E);
+        // Leave the Montgomery domain: multiply by 1
+        x[0] = 1;
+        mont_mul(&ctx, result, result, x);
+        err = limbs_to_big(X, result, n);
+    }
+
+    free(x);
+    mont_free(&ctx);
+    return err;
+}
+
+int big_mont_rr(bigint *RR, const bigint *N) {
+    if (N->signum != 1 || (N->data[N->num_limbs - 1] & 1) == 0) {
+        return ERR_BIGINT_BAD_INPUT_DATA;
+    }
+    mont_ctx ctx;
+    int err = mont_init(&ctx, N, NULL);
+    if (err != 0) {
+        return err;
+    }
+    err = limbs_to_big(RR, ctx.RR, ctx.n);
+    mont_free(&ctx);
+    return err;
+}
+
+/*
+ * Left-to-right binary exponentiation by a single-limb exponent. No window
+ * table is built, so E = 65537 costs exactly its optimal addition chain,
+ * 16 squarings and one multiplication, and E = 3 one of each; both besides
+ * the conversions into and out of the Montgomery domain.
+ */
+int big_exp_mod_limb(bigint *X, const bigint *A, big_uint e, const bigint *N,
+                     bigint *_RR) {
+    if (N->signum != 1 || (N->data[N->num_limbs - 1] & 1) == 0) {
+        return ERR_BIGINT_BAD_INPUT_DATA;
+    }
+
+    // A outside [0, N) is reduced first; the usual 0 <= A < N is not copied
+    bigint T;
+    big_init(&T);
+    int err = 0;
+    if (A->signum == -1 || big_cmp(A, N) >= 0) {
+        err = big_mod(&T, A, N);
+        A = &T;
     }
 
-    // Maximize r such that d is odd, x = 2^r * d + 1 
-    bigint d, n_minus_one;
+    mont_ctx ctx;
+    if (err == 0) {
+        err = mont_init(&ctx, N, _RR);
+    }
+    if (err != 0) {
+        big_free(&T);
+        return err;
+    }
+    size_t n = ctx.n;
+    if (_RR != NULL && _RR->signum == 0) {
+        err = limbs_to_big(_RR, ctx.RR, n);
+    }
+
+    big_uint *a = calloc(2 * n, sizeof(big_uint));
+    if (a == NULL) {
+        err = ERR_BIGINT_ALLOC_FAILED;
+    }
+    if (err == 0) {
+        big_uint *x = a + n;
+        limbs_from_big(a, A);
+        mont_mul(&ctx, a, a, ctx.RR);
+        if (e == 0) {
+            memcpy(x, ctx.one, n * sizeof(big_uint));
+        } else {
+            memcpy(x, a, n * sizeof(big_uint));
+            for (int i = 62 - __builtin_clzll(e); i >= 0; i--) {
+                mont_sqr(&ctx, x, x);
+                if ((e >> i) & 1) {
+                    mont_mul(&ctx, x, x, a);
+                }
+            }
+        }
+        // Leave the Montgomery domain: multiply by 1
+        memset(a, 0, n * sizeof(big_uint));
+        a[0] = 1;
+        mont_mul(&ctx, x, x, a);
+        err = limbs_to_big(X, x, n);
+    }
+
+    free(a);
+    big_free(&T);
+    mont_free(&ctx);
+    return err;
+}
+
+/*
+ * Four independent Montgomery exponentiations in lockstep, one per 64-bit
+ * lane of an AVX2 vector. AVX2 only multiplies 32 x 32 -> 64 bits
+ * (vpmuludq), so the operands are held in radix 2^28: a lane sums at most
+ * 2 D products below 2^56 plus a carry, which stays below 2^64 for up to
+ * MONT4_MAX_DIGITS digits, and no carries are propagated inside the
+ * multiplication. With R = 2^(28 D) > 4N, the outputs of a Montgomery
+ * multiplication of values below 2N are again below 2N, so the lanes
+ * never branch on a final subtraction. Digit j of lane l is element
+ * 4 j + l of a 32-byte aligned array.
+ */
+#ifdef BIG_HAVE_AVX2_KERNELS
+#define MONT4_DIGIT_BITS 28
+#define MONT4_MASK ((1ULL << MONT4_DIGIT_BITS) - 1)
+#define MONT4_MAX_DIGITS 127
+
+typedef struct {
+    size_t D;              /*!<  digits per lane, 28 D >= bits + 2    */
+    uint64_t n0[4];        /*!<  -N^-1 mod 2^28 of each lane          */
+    uint64_t *N;           /*!<  the moduli                           */
+    uint64_t *t;           /*!<  2 D + 1 vectors for mont4_mul        */
+} mont4_ctx;
+
+// Splits the little-endian limbs x (n limbs) into the D digits of a lane
+static void mont4_set_lane(uint64_t *d, size_t D, size_t lane,
+                           const big_uint *x, size_t n) {
+    for (size_t j = 0; j < D; j++) {
+        size_t bit = j * MONT4_DIGIT_BITS;
+        size_t k = bit / 64;
+        int s = bit % 64;
+        uint64_t v = k < n ? x[k] >> s : 0;
+        if (s > 64 - MONT4_DIGIT_BITS && k + 1 < n) {
+            v |= x[k + 1] << (64 - s);
+        }
+        d[4 * j + lane] = v & MONT4_MASK;
+    }
+}
+
+// Joins the (normalized) digits of a lane into n little-endian limbs
+static void mont4_get_lane(big_uint *x, size_t n, const uint64_t *d,
+                           size_t D, size_t lane) {
+    memset(x, 0, n * sizeof(big_uint));
+    for (size_t j = 0; j < D; j++) {
+        size_t bit = j * MONT4_DIGIT_BITS;
+        size_t k = bit / 64;
+        int s = bit % 64;
+        uint64_t v = d[4 * j + lane];
+        if (k < n) {
+            x[k] |= v << s;
+        }
+        if (s > 64 - MONT4_DIGIT_BITS && k + 1 < n) {
+            x[k + 1] |= v >> (64 - s);
+        }
+    }
+}
+
+// out = a * b * R^-1 mod N in every lane, for a, b < 2N; out < 2N and
+// may alias a or b
+__attribute__((target("avx2")))
+static void mont4_mul(const mont4_ctx *ctx, uint64_t *out, const uint64_t *a,
+                      const uint64_t *b) {
+    size_t D = ctx->D;
+    const __m256i *A = (const __m256i *)a;
+    const __m256i *B = (const __m256i *)b;
+    const __m256i *N = (const __m256i *)ctx->N;
+    __m256i *t = (__m256i *)ctx->t;
+    const __m256i mask = _mm256_set1_epi64x(MONT4_MASK);
+    const __m256i n0 = _mm256_loadu_si256((const __m256i *)ctx->n0);
+
+    for (size_t k = 0; k <= 2 * D; k++) {
+        t[k] = _mm256_setzero_si256();
+    }
+    // Two rows per pass, t += (a * (b[i] + b[i+1] 2^28) + (m0 + m1 2^28) N)
+    // * 2^(28 i): m0 clears digit i, then m1 digit i + 1 (D >= 2)
+    size_t i = 0;
+    for (; i + 1 < D; i += 2) {
+        __m256i b0 = B[i], b1 = B[i + 1];
+        __m256i u = _mm256_add_epi64(t[i], _mm256_mul_epu32(A[0], b0));
+        __m256i m0 = _mm256_and_si256(
+            _mm256_mul_epu32(_mm256_and_si256(u, mask), n0), mask);
+        u = _mm256_add_epi64(u, _mm256_mul_epu32(m0, N[0]));
+        __m256i v = _mm256_add_epi64(t[i + 1], _mm256_srli_epi64(u, MONT4_DIGIT_BITS));
+        v = _mm256_add_epi64(v, _mm256_add_epi64(_mm256_mul_epu32(A[1], b0),
+                                                 _mm256_mul_epu32(m0, N[1])));
+        v = _mm256_add_epi64(v, _mm256_mul_epu32(A[0], b1));
+        __m256i m1 = _mm256_and_si256(
+            _mm256_mul_epu32(_mm256_and_si256(v, mask), n0), mask);
+        v = _mm256_add_epi64(v, _mm256_mul_epu32(m1, N[0]));
+        t[i + 2] = _mm256_add_epi64(t[i + 2], _mm256_srli_epi64(v, MONT4_DIGIT_BITS));
+        for (size_t j = 2; j < D; j++) {
+            __m256i p = _mm256_add_epi64(_mm256_mul_epu32(A[j], b0),
+                                         _mm256_mul_epu32(m0, N[j]));
+            __m256i q = _mm256_add_epi64(_mm256_mul_epu32(A[j - 1], b1),
+                                         _mm256_mul_epu32(m1, N[j - 1]));
+            t[i + j] = _mm256_add_epi64(t[i + j], _mm256_add_epi64(p, q));
+        }
+        t[i + D] = _mm256_add_epi64(t[i + D],
+                                    _mm256_add_epi64(_mm256_mul_epu32(A[D - 1], b1),
+                                                     _mm256_mul_epu32(m1, N[D - 1])));
+    }
+    if (i < D) {
+        // odd D: one last row
+        __m256i bi = B[i];
+        __m256i u = _mm256_add_epi64(t[i], _mm256_mul_epu32(A[0], bi));
+        __m256i m = _mm256_and_si256(
+            _mm256_mul_epu32(_mm256_and_si256(u, mask), n0), mask);
+        u = _mm256_add_epi64(u, _mm256_mul_epu32(m, N[0]));
+        t[i + 1] = _mm256_add_epi64(t[i + 1], _mm256_srli_epi64(u, MONT4_DIGIT_BITS));
+        for (size_t j = 1; j < D; j++) {
+            __m256i p = _mm256_add_epi64(_mm256_mul_epu32(A[j], bi),
+                                         _mm256_mul_epu32(m, N[j]));
+            t[i + j] = _mm256_add_epi64(t[i + j], p);
+        }
+    }
+
+    // The upper half, with its carries propagated, is the result
+    __m256i *X = (__m256i *)out;
+    __m256i c = _mm256_setzero_si256();
+    for (size_t k = 0; k < D; k++) {
+        __m256i v = _mm256_add_epi64(t[D + k], c);
+        X[k] = _mm256_and_si256(v, mask);
+        c = _mm256_srli_epi64(v, MONT4_DIGIT_BITS);
+    }
+}
+
+// Fixed-window exponentiation of all four lanes: the exponents share the
+// window positions, so each lane only picks its own table entry
+static int mont4_exp(const mont4_ctx *ctx, uint64_t *out, const uint64_t *base,
+                     const uint64_t *one, const bigint *const E[4]) {
+    size_t D = ctx->D;
+    size_t ebits = 0;
+    for (size_t l = 0; l < 4; l++) {
+        size_t b = big_bitlen(E[l]);
+        ebits = b > ebits ? b : ebits;
+    }
+    size_t w = ebits > 960 ? 6 : ebits > 320 ? 5 : ebits > 96 ? 4 :
+               ebits > 24 ? 3 : ebits > 4 ? 2 : 1;
+
+    // table[v] = base^v, then one gathered operand
+    size_t table_size = (size_t)1 << w;
+    uint64_t *table = aligned_alloc(32, (table_size + 1) * D * 4 * sizeof(uint64_t));
+    if (table == NULL) {
+        return ERR_BIGINT_ALLOC_FAILED;
+    }
+    uint64_t *g = table + table_size * D * 4;
+    memcpy(table, one, D * 4 * sizeof(uint64_t));
+    memcpy(table + D * 4, base, D * 4 * sizeof(uint64_t));
+    for (size_t v = 2; v < table_size; v++) {
+        mont4_mul(ctx, table + v * D * 4, table + (v - 1) * D * 4, base);
+    }
+
+    size_t top = (ebits + w - 1) / w * w;
+    memcpy(out, one, D * 4 * sizeof(uint64_t));
+    for (size_t i = top; i > 0; i -= w) {
+        size_t v[4] = {0, 0, 0, 0};
+        for (size_t l = 0; l < 4; l++) {
+            for (size_t b = i; b > i - w; b--) {
+                v[l] = (v[l] << 1) | big_get_bit(E[l], b - 1);
+            }
+        }
+        for (size_t j = 0; j < D * 4; j += 4) {
+            for (size_t l = 0; l < 4; l++) {
+                g[j + l] = table[v[l] * D * 4 + j + l];
+            }
+        }
+        if (i == top) {
+            memcpy(out, g, D * 4 * sizeof(uint64_t));
+            continue;
+        }
+        for (size_t s = 0; s < w; s++) {
+            mont4_mul(ctx, out, out, out);
+        }
+        mont4_mul(ctx, out, out, g);
+    }
+    free(table);
+    return 0;
+}
+
+// X[l] = A[l]^E[l] mod N[l] with D digits per lane, for odd N[l] and
+// 0 <= A[l] < N[l]. The results are only written once all inputs are read.
+static int exp_mod_x4_avx2(bigint *const X[4], const bigint *const A[4],
+                           const bigint *const E[4], const bigint *const N[4],
+                           size_t D) {
+    size_t vec = D * 4 * sizeof(uint64_t);
+    mont4_ctx ctx = {.D = D};
+    ctx.N = aligned_alloc(32, vec);
+    ctx.t = aligned_alloc(32, (2 * D + 1) * 4 * sizeof(uint64_t));
+    uint64_t *buf = aligned_alloc(32, 4 * vec);
+
+    // Limb buffers hold a lane value, and 2^(56 D) for R^2 mod N
+    size_t n = 0;
+    for (size_t l = 0; l < 4; l++) {
+        n = N[l]->num_limbs > n ? N[l]->num_limbs : n;
+    }
+    size_t r2_limbs = 2 * D * MONT4_DIGIT_BITS / 64 + 1;
+    big_uint *limbs = calloc(3 * n + 2 * r2_limbs + 1, sizeof(big_uint));
+    int err = 0;
+    if (ctx.N == NULL || ctx.t == NULL || buf == NULL || limbs == NULL) {
+        err = ERR_BIGINT_ALLOC_FAILED;
+    }
+    if (err == 0) {
+        uint64_t *base = buf, *rr = buf + D * 4, *one = buf + 2 * D * 4;
+        uint64_t *acc = buf + 3 * D * 4;
+        big_uint *x = limbs, *m = limbs + n, *r2 = limbs + 2 * n;
+        big_uint *scratch = r2 + r2_limbs;
+        size_t nl[4];
+        for (size_t l = 0; l < 4; l++) {
+            nl[l] = limbs_from_big(m, N[l]);
+            mont4_set_lane(ctx.N, D, l, m, nl[l]);
+            ctx.n0[l] = -limb_inverse(m[0]) & MONT4_MASK;
+
+            memset(r2, 0, r2_limbs * sizeof(big_uint));
+            r2[r2_limbs - 1] = 1ULL << (2 * D * MONT4_DIGIT_BITS % 64);
+            limbs_mod(x, r2, r2_limbs, m, nl[l], scratch);
+            mont4_set_lane(rr, D, l, x, nl[l]);
+
+            size_t na = limbs_from_big(x, A[l]);
+            mont4_set_lane(base, D, l, x, na);
+        }
+        // one <- R mod N, base <- A R mod N
+        memset(one, 0, vec);
+        for (size_t l = 0; l < 4; l++) {
+            one[l] = 1;
+        }
+        mont4_mul(&ctx, base, base, rr);
+        mont4_mul(&ctx, rr, rr, one);
+        err = mont4_exp(&ctx, acc, base, rr, E);
+        if (err == 0) {
+            // Leave the Montgomery domain; the result is at most N, and
+            // equal to it only for 0
+            mont4_mul(&ctx, acc, acc, one);
+        }
+        for (size_t l = 0; l < 4 && err == 0; l++) {
+            limbs_from_big(m, N[l]);
+            mont4_get_lane(x, nl[l], acc, D, l);
+            if (memcmp(x, m, nl[l] * sizeof(big_uint)) == 0) {
+                memset(x, 0, nl[l] * sizeof(big_uint));
+            }
+            err = limbs_to_big(X[l], x, nl[l]);
+        }
+    }
+
+    free(ctx.N);
+    free(ctx.t);
+    free(buf);
+    free(limbs);
+    return err;
+}
+#endif
+
+// Digits per lane for moduli of up to `bits` bits (R > 4N), or 0 if they
+// are too long for the lanes, or the CPU has no AVX2
+static size_t mont4_digits(size_t bits) {
+#ifdef BIG_HAVE_AVX2_KERNELS
+    size_t D = (bits + 2 + MONT4_DIGIT_BITS - 1) / MONT4_DIGIT_BITS;
+    if (__builtin_cpu_supports("avx2") && D <= MONT4_MAX_DIGITS) {
+        return D < 2 ? 2 : D;
+    }
+#else
+    (void)bits;
+#endif
+    return 0;
+}
+
+int big_exp_mod_x4(bigint *const X[4], const bigint *const A[4],
+                   const bigint *const E[4], const bigint *const N[4]) {
+    size_t bits = 0;
+    for (size_t l = 0; l < 4; l++) {
+        if (N[l]->signum != 1 || (N[l]->data[N[l]->num_limbs - 1] & 1) == 0 ||
+            E[l]->signum == -1) {
+            return ERR_BIGINT_BAD_INPUT_DATA;
+        }
+        size_t b = big_bitlen(N[l]);
+        bits = b > bits ? b : bits;
+    }
+
+    // Bases outside [0, N) are reduced first, and the results are kept
+    // apart until the end, as X may alias any of the inputs
+    bigint T[4], Y[4];
+    const bigint *a[4];
+    bigint *y[4];
+    int err = 0;
+    for (size_t l = 0; l < 4; l++) {
+        big_init(&T[l]);
+        big_init(&Y[l]);
+        a[l] = A[l];
+        y[l] = &Y[l];
+        if (err == 0 && (A[l]->signum == -1 || big_cmp(A[l], N[l]) >= 0)) {
+            err = big_mod(&T[l], A[l], N[l]);
+            a[l] = &T[l];
+        }
+    }
+
+    size_t D = mont4_digits(bits);
+#ifdef BIG_HAVE_AVX2_KERNELS
+    if (err == 0 && D != 0) {
+        err = exp_mod_x4_avx2(y, a, E, N, D);
+    }
+#endif
+    for (size_t l = 0; l < 4 && err == 0 && D == 0; l++) {
+        err = big_exp_mod(y[l], a[l], E[l], N[l], NULL);
+    }
+    for (size_t l = 0; l < 4 && err == 0; l++) {
+        err = big_copy(X[l], &Y[l]);
+    }
+    for (size_t l = 0; l < 4; l++) {
+        big_free(&T[l]);
+        big_free(&Y[l]);
+    }
+    return err;
+}
+
+int random_bigint(bigint *X, size_t nbits) {
+    size_t n_limbs = nbits / 64;
+    size_t top_bits = nbits % 64;
+    if (top_bits != 0) {
+        n_limbs++;
+    } else {
+        top_bits = 64;
+    }
+    int err = resize_limbs(X, n_limbs);
+    if (err != 0) {
+        return err;
+    }
+    // The limbs are filled straight from this thread's generator
+    if (drbg_thread_random(X->data, n_limbs * sizeof(big_uint)) != 0) {
+        return ERR_BIGINT_RNG_FAILED;
+    }
+    X->signum = 1;
+    if (top_bits < 64) {
+        X->data[0] &= (1ULL << top_bits) - 1;
+    }
+    return 0;
+}
+
+// a * b * 2^-64 mod n for an odd n < 2^64 and a, b < n; ninv = n^-1 mod
+// 2^64. With m = lo(ab) * ninv, the low halves of ab and m * n are equal,
+// so ab * 2^-64 = hi(ab) - hi(m * n) exactly, and both terms are below n.
+static inline uint64_t mont64_mul(uint64_t a, uint64_t b, uint64_t n,
+                                  uint64_t ninv) {
+    big_udbl t = (big_udbl)a * b;
+    uint64_t m = (uint64_t)t * ninv;
+    uint64_t mn_hi = (uint64_t)(((big_udbl)m * n) >> 64);
+    uint64_t t_hi = (uint64_t)(t >> 64);
+    uint64_t r = t_hi - mn_hi;
+    return t_hi < mn_hi ? r + n : r;
+}
+
+/*
+ * Deterministic Miller-Rabin for odd 2^16 < n < 2^64, in 64-bit Montgomery
+ * arithmetic. The bases 2, 325, 9375, 28178, 450775, 9780504, 1795265022
+ * (found by Jim Sinclair) leave no strong pseudoprime below 2^64, and
+ * 2, 7, 61 none below 4759123141. Base 2 runs first and alone, since it
+ * rejects nearly every composite; the other bases share one pass over the
+ * exponent bits, so their independent multiplications overlap in the
+ * pipeline.
+ */
+#define U64_MR_BASES 6
+
+static bool is_prime_u64(uint64_t n) {
+    static const uint64_t bases_64[U64_MR_BASES] = {
+        325, 9375, 28178, 450775, 9780504, 1795265022
+    };
+    static const uint64_t bases_32[] = { 7, 61 };
+    const uint64_t *bases = n < 4759123141ULL ? bases_32 : bases_64;
+    int num_bases = n < 4759123141ULL ? 2 : U64_MR_BASES;
+
+    uint64_t d = n - 1;
+    int r = limb_ctz(d);
+    d >>= r;
+    int top = 63 - __builtin_clzll(d);
+
+    uint64_t ninv = limb_inverse(n);
+    uint64_t one = -n % n;                                // 2^64 mod n
+    uint64_t rr = (uint64_t)(((big_udbl)one * one) % n);  // 2^128 mod n
+    uint64_t minus_one = n - one;
+
+    // Base 2: multiplying by the base is a modular doubling
+    uint64_t t = one;
+    for (int bit = top; bit >= 0; bit--) {
+        t = mont64_mul(t, t, n, ninv);
+        if ((d >> bit) & 1) {
+            t = t >= n - t ? t - (n - t) : t + t;
+        }
+    }
+    bool probable_prime = t == one || t == minus_one;
+    for (int j = 1; j < r && !probable_prime; j++) {
+        t = mont64_mul(t, t, n, ninv);
+        probable_prime = t == minus_one;
+    }
+    if (!probable_prime) {
+        return false;
+    }
+
+    uint64_t base[U64_MR_BASES], x[U64_MR_BASES];
+    for (int i = 0; i < num_bases; i++) {
+        base[i] = mont64_mul(bases[i] % n, rr, n, ninv);
+        x[i] = one;
+    }
+    for (int bit = top; bit >= 0; bit--) {
+        bool set = (d >> bit) & 1;
+        for (int i = 0; i < num_bases; i++) {
+            x[i] = mont64_mul(x[i], x[i], n, ninv);
+            if (set) {
+                x[i] = mont64_mul(x[i], base[i], n, ninv);
+            }
+        }
+    }
+
+    for (int i = 0; i < num_bases; i++) {
+        // a base that is a multiple of n proves nothing and is skipped
+        t = x[i];
+        probable_prime = base[i] == 0 || t == one || t == minus_one;
+        for (int j = 1; j < r && !probable_prime; j++) {
+            t = mont64_mul(t, t, n, ninv);
+            probable_prime = t == minus_one;
+        }
+        if (!probable_prime) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * Minimum number of Miller-Rabin rounds with random bases for a random
+ * candidate of the given bit length, keeping the probability of accepting
+ * a composite below 2^-128 (FIPS 186-5 Appendix B, using the average-case
+ * bounds of Damgard, Landrock and Pomerance).
+ */
+static size_t mr_rounds(size_t bits) {
+    if (bits >= 3747) return 3;
+    if (bits >= 1345) return 4;
+    if (bits >= 476) return 5;
+    if (bits >= 400) return 6;
+    if (bits >= 347) return 7;
+    if (bits >= 308) return 8;
+    if (bits >= 55) return 27;
+    return 34;
+}
+
+// The table above only holds for random candidates. An input of unknown
+// origin may be a composite built to pass as many bases as possible,
+// which a random base still rejects with probability at least 3/4; 64
+// rounds keep even those below 2^-128.
+#define MR_WORST_CASE_ROUNDS 64
+
+// Strong probable-prime test of the odd X > 3 to the base a, given as a
+// Montgomery image (NULL for the base 2), where X - 1 = 2^r * d with d
+// odd. minus_one is the image of X - 1; t must hold ctx->n limbs.
+static int is_strong_probable_prime(const mont_ctx *ctx, const big_uint *a,
+                                    const bigint *d, size_t r,
+                                    const big_uint *minus_one, big_uint *t,
+                                    bool *probable_prime) {
+    size_t n = ctx->n;
+
+    // t <- a^d; probably prime if t == 1 or t == n - 1
+    if (a == NULL) {
+        mont_exp2(ctx, t, d);
+    } else {
+        int err = mont_exp(ctx, t, a, d);
+        if (err != 0) {
+            return err;
+        }
+    }
+    *probable_prime = memcmp(t, ctx->one, n * sizeof(big_uint)) == 0 ||
+                      memcmp(t, minus_one, n * sizeof(big_uint)) == 0;
+
+    // otherwise, square up to r - 1 times looking for n - 1
+    for (size_t j = 1; j < r && !*probable_prime; j++) {
+        mont_sqr(ctx, t, t);
+        if (memcmp(t, minus_one, n * sizeof(big_uint)) == 0) {
+            *probable_prime = true;
+        } else if (memcmp(t, ctx->one, n * sizeof(big_uint)) == 0) {
+            break;  // nontrivial square root of 1: composite
+        }
+    }
+    return 0;
+}
+
+// Miller-Rabin on an odd X > 2^16 without small factors: one round to
+// the base 2, which rejects nearly every composite for the price of a
+// single exponentiation, then `rounds` rounds with random bases. All
+// bases share one Montgomery context, and the witness loop never leaves
+// the Montgomery domain. If cancel is set between two rounds, X is
+// reported as composite; the caller is expected to check the flag.
+static int miller_rabin(const bigint *X, size_t rounds,
+                        const atomic_bool *cancel) {
+    mont_ctx ctx;
+    int err = mont_init(&ctx, X, NULL);
+    if (err != 0) {
+        return err;
+    }
+    size_t n = ctx.n;
+
+    bigint d, a, n_minus_one;
     big_init(&d);
+    big_init(&a);
     big_init(&n_minus_one);
+    big_uint *buf = calloc(4 * n, sizeof(big_uint));
+    if (buf == NULL) {
+        mont_free(&ctx);
+        return ERR_BIGINT_ALLOC_FAILED;
+    }
+    big_uint *am = buf, *minus_one = buf + n, *t = buf + 2 * n;
+    big_uint *limbs = buf + 3 * n;
 
-    // residual = 2^r + d
-    big_sub(&n_minus_one, X, &ONE);
-    big_copy(&d, &n_minus_one);
+    // X - 1 = 2^r * d with d odd (X is odd, so no borrow)
+    memcpy(limbs, ctx.N, n * sizeof(big_uint));
+    limbs[0]--;
+    err = limbs_to_big(&n_minus_one, limbs, n);
+    size_t r = 0;
+    while (limbs[r / 64] == 0) {
+        r += 64;
+    }
+    r += limb_ctz(limbs[r / 64]);
+    limbs_shr(limbs, n, r);
+    if (err == 0) {
+        err = limbs_to_big(&d, limbs, n);
+    }
 
-    big_uint r = 0;
-    // loop to set residual = d
-    big_mod(&remainder_mod_2, &d, &TWO);
+    // Images of 1 and X - 1 = -1: R mod X and X - (R mod X)
+    memset(t, 0, n * sizeof(big_uint));
+    mont_sub(&ctx, minus_one, t, ctx.one);
 
-    while (big_cmp(&remainder_mod_2, &BIG_ZERO) == 0) { // while remainder mod 2 is even, i.e. we can divide out 2
-        // residual /= 2
-        big_div(&d, &remainder_mod_2, &d, &TWO);
-        r++;
+    size_t bits = big_bitlen(X);
+    int result = 0;
+    for (size_t i = 0; i <= rounds && err == 0; i++) {
+        if (cancel != NULL && atomic_load_explicit(cancel, memory_order_relaxed)) {
+            result = ERR_BIGINT_NOT_ACCEPTABLE;
+            break;
+        }
+        if (i > 0) {
+            // random base with 2 <= a <= n - 2
+            do {
+                err = random_bigint(&a, bits);
+            } while (err == 0 && (big_bitlen(&a) < 2 ||
+                                  big_cmp(&a, &n_minus_one) >= 0));
+            if (err != 0) {
+                break;
+            }
+            memset(am, 0, n * sizeof(big_uint));
+            limbs_from_big(am, &a);
+            mont_mul(&ctx, am, am, ctx.RR);
+        }
+        bool probable_prime;
+        err = is_strong_probable_prime(&ctx, i == 0 ? NULL : am, &d, r,
+                                       minus_one, t, &probable_prime);
+        if (err == 0 && !probable_prime) {
+            result = ERR_BIGINT_NOT_ACCEPTABLE; // composite
+            break;
+        }
     }
-    assert (big_cmp(&remainder_mod_2, &BIG_ZERO) == 0);
-    size_t NUM_PRIMES = 1229;
 
-    // So, now we should have X = d * 2^r + 1. Can test this if it doesn't work.
-    bigint *primes = load_primes("list_of_primes.txt", NUM_PRIMES);
+    free(buf);
+    big_free(&d);
+    big_free(&a);
+    big_free(&n_minus_one);
+    mont_free(&ctx);
+    return err != 0 ? err : result;
+}
 
-    for (size_t i = 0; i < NUM_PRIMES; i++) {
-        // t <- a^d mod n 
-        bigint t;
-        big_init(&t);
-        big_exp_mod(&t, &primes[i], &d, X, NULL);
-        
-        // if t == 1 or t == n - 1, continue. 
-        if (big_cmp(&t, &ONE) == 0 || big_cmp(&t, &n_minus_one)) {
-            continue;
+// Jacobi symbol (a/n) for odd n, binary algorithm: factors of two are
+// stripped with a single shift and the odd parts are reduced by
+// subtraction, flipping the sign per the reciprocity laws.
+static int limb_jacobi(big_uint a, big_uint n) {
+    int t = 1;
+    a %= n;
+    while (a != 0) {
+        int z = limb_ctz(a);
+        a >>= z;
+        // (2/n) = -1 iff n = 3, 5 (mod 8)
+        if ((z & 1) && ((n & 7) == 3 || (n & 7) == 5)) {
+            t = -t;
+        }
+        if (a < n) {
+            big_uint tmp = a;
+            a = n;
+            n = tmp;
+            // (a/n) = -(n/a) iff a = n = 3 (mod 4)
+            if ((a & n & 3) == 3) {
+                t = -t;
+            }
+        }
+        a -= n;
+    }
+    return n == 1 ? t : 0;
+}
+
+// True if the positive X is a perfect square (Newton's integer square root)
+static bool is_perfect_square(const bigint *X) {
+    // squares are 0, 1, 4, 9, 16, 17, 25, 33, 36, 41, 49, 57 mod 64
+    big_uint low = X->data[X->num_limbs - 1];
+    if (((0x202021202030213ULL >> (low & 63)) & 1) == 0) {
+        return false;
+    }
+
+    bigint x, y, TWO;
+    big_init(&x);
+    big_init(&y);
+    big_init(&TWO);
+    big_set_nonzero(&TWO, 2);
+
+    // x = 2^ceil(bits / 2) >= sqrt(X); then x <- (x + X / x) / 2
+    // decreases until it reaches floor(sqrt(X))
+    size_t half = (big_bitlen(X) + 1) / 2;
+    size_t n = half / 64 + 1;
+    big_uint *start = calloc(n, sizeof(big_uint));
+    bool square = false;
+    if (start != NULL) {
+        start[half / 64] = 1ULL << (half % 64);
+        limbs_to_big(&x, start, n);
+        free(start);
+        while (true) {
+            big_div(&y, NULL, X, &x);
+            big_add(&y, &y, &x);
+            big_div(&y, NULL, &y, &TWO);
+            if (big_cmp(&y, &x) >= 0) {
+                break;
+            }
+            big_copy(&x, &y);
+        }
+        big_mul(&y, &x, &x);
+        square = big_cmp(&y, X) == 0;
+    }
+
+    big_free(&x);
+    big_free(&y);
+    big_free(&TWO);
+    return square;
+}
+
+/*
+ * Selfridge's method A: D is the first of 5, -7, 9, -11, ... with
+ * (D/X) = -1. With the sign alternating as |D| = 1 or 3 (mod 4),
+ * reciprocity gives (D/X) = (X mod |D| / |D|) in both cases, so every
+ * step costs one single-limb remainder and one word-sized Jacobi symbol.
+ * Returns ERR_BIGINT_NOT_ACCEPTABLE if X is found to be composite.
+ */
+static int selfridge_d(const bigint *X, big_sint *D) {
+    for (big_uint a = 5; ; a += 2) {
+        big_uint r;
+        int err = big_mod_limb(&r, X, a);
+        if (err != 0) {
+            return err;
+        }
+        int j = limb_jacobi(r, a);
+        if (j == -1) {
+            *D = (a & 3) == 1 ? (big_sint)a : -(big_sint)a;
+            return 0;
+        }
+        if (j == 0 && r != 0) {
+            return ERR_BIGINT_NOT_ACCEPTABLE;  // shares a factor with a
+        }
+        // No such D exists for a square; only look after a few misses,
+        // which are rare (each candidate fails with probability ~1/2).
+        if (a == 5 + 2 * 32 && is_perfect_square(X)) {
+            return ERR_BIGINT_NOT_ACCEPTABLE;
+        }
+    }
+}
+
+/*
+ * Strong Lucas probable-prime test for an odd X > 2^16 without small
+ * factors, with Selfridge's parameters P = 1, Q = (1 - D) / 4. Writing
+ * X + 1 = 2^s * d with d odd, X passes if U_d = 0 or V_(d 2^r) = 0 for
+ * some 0 <= r < s. U_k, V_k and Q^k are built by binary doubling over the
+ * bits of d, entirely in the Montgomery domain; products with the small
+ * D and Q are done by additions:
+ *
+ *   U_2k = U_k V_k           U_(2k+1) = (U_2k + V_2k) / 2
+ *   V_2k = V_k^2 - 2 Q^k     V_(2k+1) = (D U_2k + V_2k) / 2
+ */
+static int strong_lucas(const bigint *X) {
+    big_sint D;
+    int err = selfridge_d(X, &D);
+    if (err != 0) {
+        return err;
+    }
+    big_sint Q = (1 - D) / 4;
+
+    mont_ctx ctx;
+    err = mont_init(&ctx, X, NULL);
+    if (err != 0) {
+        return err;
+    }
+    size_t n = ctx.n;
+
+    bigint d;
+    big_init(&d);
+    big_uint *buf = calloc(5 * n + 1, sizeof(big_uint));
+    if (buf == NULL) {
+        mont_free(&ctx);
+        return ERR_BIGINT_ALLOC_FAILED;
+    }
+    big_uint *U = buf, *V = buf + n, *Qk = buf + 2 * n;
+    big_uint *t = buf + 3 * n, *k = buf + 4 * n;
+
+    // X + 1 = 2^s * d with d odd
+    memcpy(k, ctx.N, n * sizeof(big_uint));
+    for (size_t j = 0; j <= n; j++) {
+        if (++k[j] != 0) {
+            break;
+        }
+    }
+    size_t s = 0;
+    while (k[s / 64] == 0) {
+        s += 64;
+    }
+    s += limb_ctz(k[s / 64]);
+    limbs_shr(k, n + 1, s);
+    err = limbs_to_big(&d, k, n + 1);
+
+    if (err == 0) {
+        memcpy(U, ctx.one, n * sizeof(big_uint));   // U_1 = 1
+        memcpy(V, ctx.one, n * sizeof(big_uint));   // V_1 = P = 1
+        mont_mul_small(&ctx, Qk, ctx.one, Q);       // Q^1
+
+        for (size_t i = big_bitlen(&d) - 1; i > 0; i--) {
+            mont_mul(&ctx, U, U, V);
+            mont_mul(&ctx, V, V, V);
+            mont_sub(&ctx, V, V, Qk);
+            mont_sub(&ctx, V, V, Qk);
+            mont_mul(&ctx, Qk, Qk, Qk);
+            if (big_get_bit(&d, i - 1)) {
+                mont_mul_small(&ctx, t, U, D);
+                mont_add(&ctx, t, t, V);
+                mont_half(&ctx, t);
+                mont_add(&ctx, U, U, V);
+                mont_half(&ctx, U);
+                memcpy(V, t, n * sizeof(big_uint));
+                mont_mul_small(&ctx, t, Qk, Q);
+                memcpy(Qk, t, n * sizeof(big_uint));
+            }
+        }
+
+        bool probable_prime = limbs_is_zero(U, n) || limbs_is_zero(V, n);
+        for (size_t r = 1; r < s && !probable_prime; r++) {
+            mont_mul(&ctx, V, V, V);
+            mont_sub(&ctx, V, V, Qk);
+            mont_sub(&ctx, V, V, Qk);
+            mont_mul(&ctx, Qk, Qk, Qk);
+            probable_prime = limbs_is_zero(V, n);
+        }
+        err = probable_prime ? 0 : ERR_BIGINT_NOT_ACCEPTABLE;
+    }
+
+    free(buf);
+    big_free(&d);
+    mont_free(&ctx);
+    return err;
+}
+
+// Runs the selected probable-prime test on an odd random candidate
+// X > 2^16 that has no factor below 2^16, with the Miller-Rabin rounds of
+// mr_rounds. A set cancel flag makes it give up early (see miller_rabin).
+static int probable_prime(const bigint *X, size_t bits, int policy,
+                          const atomic_bool *cancel) {
+    if (bits <= 64) {
+        return is_prime_u64(X->data[X->num_limbs - 1]) ? 0 : ERR_BIGINT_NOT_ACCEPTABLE;
+    }
+    if (policy == BIG_PRIMALITY_BPSW) {
+        // Baillie-PSW: a base-2 strong test, then a strong Lucas test
+        int err = miller_rabin(X, 0, cancel);
+        if (err == 0 && cancel != NULL &&
+            atomic_load_explicit(cancel, memory_order_relaxed)) {
+            err = ERR_BIGINT_NOT_ACCEPTABLE;
         }
+        return err != 0 ? err : strong_lucas(X);
+    }
+    return miller_rabin(X, mr_rounds(bits), cancel);
+}
 
-        // repeat r - 1 times:
-        bool next_iter = false;
-        for (size_t j = 0; j < r - 1; j++) {
-            // x <- x^2 mod n
-            big_exp_mod(&t, &t, &TWO, X, NULL);
+// Reduces the little-endian candidate x (n limbs) modulo primorial block k
+static void mod_primorial_block(big_uint *r, const big_uint *x, size_t n,
+                                size_t k, big_uint *scratch) {
+    const big_uint *block = &PRIMORIAL_BLOCK_DATA[PRIMORIAL_BLOCK_OFFSET[k]];
+    size_t block_limbs = PRIMORIAL_BLOCK_OFFSET[k + 1] - PRIMORIAL_BLOCK_OFFSET[k];
+    limbs_mod(r, x, n, block, block_limbs, scratch);
+}
 
-            // if x = n - 1, then continue. 
-            if (big_cmp(&t, &n_minus_one) == 0) {
-                next_iter = true;
+/*
+ * Cheap first stage for prime candidates: returns true if X is divisible
+ * by one of the odd primes below 2^16 (X itself must be larger than 2^16).
+ *
+ * Instead of ~6500 trial divisions, X is reduced modulo each multi-limb
+ * primorial block, and that (short) residue modulo each single-limb
+ * primorial inside the block. One single-limb GCD then tests every prime
+ * in that primorial at once. Small primes come first, so most composites
+ * are rejected within the first block.
+ */
+static bool has_small_factor(const bigint *X) {
+    big_uint *x = malloc(X->num_limbs * sizeof(big_uint));
+    big_uint *scratch = malloc((X->num_limbs + 2 * PRIMORIAL_BLOCK_LIMBS + 1) *
+                               sizeof(big_uint));
+    if (x == NULL || scratch == NULL) {
+        free(x);
+        free(scratch);
+        return false;
+    }
+    big_uint *r = scratch + X->num_limbs + PRIMORIAL_BLOCK_LIMBS + 1;
+    size_t n = limbs_from_big(x, X);
+
+    bool found = false;
+    for (size_t k = 0; k < NUM_PRIMORIAL_BLOCKS && !found; k++) {
+        mod_primorial_block(r, x, n, k, scratch);
+        size_t block_limbs = PRIMORIAL_BLOCK_OFFSET[k + 1] - PRIMORIAL_BLOCK_OFFSET[k];
+
+        size_t first = k * PRIMORIAL_BLOCK_LIMBS;
+        size_t last = first + PRIMORIAL_BLOCK_LIMBS;
+        if (last > NUM_PRIMORIALS) {
+            last = NUM_PRIMORIALS;
+        }
+        for (size_t j = first; j < last; j++) {
+            big_uint residue = limbs_mod_1(r, block_limbs, PRIMORIALS[j]);
+            if (limb_gcd(residue, PRIMORIALS[j]) != 1) {
+                found = true;
                 break;
             }
         }
+    }
+
+    free(x);
+    free(scratch);
+    return found;
+}
 
-        if (!next_iter) {
-            return ERR_BIGINT_NOT_ACCEPTABLE; // composite
+#ifdef BIG_HAVE_AVX2_KERNELS
+/*
+ * Last step of small_prime_residues for 8 primes per vector. Prime i
+ * comes with a one-limb value v_i (the residue of the candidate modulo
+ * the primorial holding that prime) split into four 16-bit chunks
+ * chunks[0][i] .. chunks[3][i], most significant first. Horner's rule
+ * r <- (r * 2^16 + chunk) mod p keeps every intermediate below 2^32, so
+ * it is reduced with the Barrett constant floor(2^32 / p): the estimated
+ * quotient is exact or one too small, leaving a single conditional
+ * subtraction. Returns the number of primes handled (a multiple of 8).
+ */
+__attribute__((target("avx2")))
+static size_t residues_avx2(uint16_t *residues, uint16_t *const chunks[4]) {
+    size_t i = 0;
+    for (; i + 8 <= NUM_SMALL_PRIMES; i += 8) {
+        __m256i p = _mm256_cvtepu16_epi32(
+            _mm_loadu_si128((const __m128i *)&SMALL_PRIMES[i]));
+        __m256i m = _mm256_loadu_si256((const __m256i *)&SMALL_PRIME_BARRETT[i]);
+        __m256i m_odd = _mm256_srli_epi64(m, 32);
+        __m256i r = _mm256_setzero_si256();
+        for (size_t j = 0; j < 4; j++) {
+            __m256i c = _mm256_cvtepu16_epi32(
+                _mm_loadu_si128((const __m128i *)&chunks[j][i]));
+            __m256i x = _mm256_or_si256(_mm256_slli_epi32(r, 16), c);
+            // q = (x * m) >> 32, lanewise: even lanes take the high half
+            // of their 64-bit product, odd lanes already sit there
+            __m256i q_even = _mm256_srli_epi64(_mm256_mul_epu32(x, m), 32);
+            __m256i q_odd = _mm256_mul_epu32(_mm256_srli_epi64(x, 32), m_odd);
+            __m256i q = _mm256_blend_epi32(q_even, q_odd, 0xAA);
+            r = _mm256_sub_epi32(x, _mm256_mullo_epi32(q, p));
+            // r < 2p: r - p wraps around unless r >= p
+            r = _mm256_min_epu32(r, _mm256_sub_epi32(r, p));
         }
+        __m128i packed = _mm_packus_epi32(_mm256_castsi256_si128(r),
+                                          _mm256_extracti128_si256(r, 1));
+        _mm_storeu_si128((__m128i *)&residues[i], packed);
     }
+    return i;
+}
+#endif
+
+// Computes X mod p for every p in SMALL_PRIMES, going through the
+// primorial blocks so that the long candidate is only traversed once
+// per block. The last step, from primorial residues down to the primes,
+// runs 8 primes at a time with AVX2 when the CPU has it, and one
+// division per prime otherwise.
+static int small_prime_residues(uint16_t *residues, const bigint *X) {
+    big_uint *x = malloc(X->num_limbs * sizeof(big_uint));
+    big_uint *scratch = malloc((X->num_limbs + 2 * PRIMORIAL_BLOCK_LIMBS + 1) *
+                               sizeof(big_uint));
+    if (x == NULL || scratch == NULL) {
+        free(x);
+        free(scratch);
+        return ERR_BIGINT_ALLOC_FAILED;
+    }
+    big_uint *r = scratch + X->num_limbs + PRIMORIAL_BLOCK_LIMBS + 1;
+    size_t n = limbs_from_big(x, X);
 
-    for (size_t i = 0; i < NUM_PRIMES; i++) {
-        big_free(&primes[i]);
+#ifdef BIG_HAVE_AVX2_KERNELS
+    uint16_t *chunk_data = NULL;
+    if (__builtin_cpu_supports("avx2")) {
+        chunk_data = malloc(4 * NUM_SMALL_PRIMES * sizeof(uint16_t));
+    }
+    uint16_t *chunks[4];
+    for (size_t c = 0; c < 4 && chunk_data != NULL; c++) {
+        chunks[c] = chunk_data + c * NUM_SMALL_PRIMES;
     }
-    free(primes);
+#endif
 
+    size_t prime_idx = 0;
+    for (size_t k = 0; k < NUM_PRIMORIAL_BLOCKS; k++) {
+        mod_primorial_block(r, x, n, k, scratch);
+        size_t block_limbs = PRIMORIAL_BLOCK_OFFSET[k + 1] - PRIMORIAL_BLOCK_OFFSET[k];
+
+        size_t first = k * PRIMORIAL_BLOCK_LIMBS;
+        size_t last = first + PRIMORIAL_BLOCK_LIMBS;
+        if (last > NUM_PRIMORIALS) {
+            last = NUM_PRIMORIALS;
+        }
+        for (size_t j = first; j < last; j++) {
+            big_uint residue = limbs_mod_1(r, block_limbs, PRIMORIALS[j]);
+            for (; prime_idx < PRIMORIAL_END[j]; prime_idx++) {
+#ifdef BIG_HAVE_AVX2_KERNELS
+                if (chunk_data != NULL) {
+                    for (size_t c = 0; c < 4; c++) {
+                        chunks[c][prime_idx] = (uint16_t)(residue >> (48 - 16 * c));
+                    }
+                    continue;
+                }
+#endif
+                residues[prime_idx] = residue % SMALL_PRIMES[prime_idx];
+            }
+        }
+    }
+
+#ifdef BIG_HAVE_AVX2_KERNELS
+    if (chunk_data != NULL) {
+        for (size_t i = residues_avx2(residues, chunks); i < NUM_SMALL_PRIMES; i++) {
+            big_uint residue = 0;
+            for (size_t c = 0; c < 4; c++) {
+                residue = (residue << 16) | chunks[c][i];
+            }
+            residues[i] = residue % SMALL_PRIMES[i];
+        }
+        free(chunk_data);
+    }
+#endif
+
+    free(x);
+    free(scratch);
     return 0;
 }
 
-big_uint random_limb(size_t nbits) {
-    big_uint mask = ~(0xFFFFFFFFFFFFFFFF << (64 - nbits)); 
-    uint16_t a = rand();
-    uint16_t b = rand();
-    uint16_t c = rand();
-    uint16_t d = rand();
-    big_uint full_rand = 0;
-    full_rand |= a; 
-    full_rand |= ((uint64_t)b << 16);
-    full_rand |= ((uint64_t)c << 32);
-    full_rand |= ((uint64_t)d << 48);
-    full_rand &= mask;
-    return full_rand;
+// Adds a limb to a non-negative bigint in place; returns the carry out
+// of the most significant limb.
+static big_uint add_limb_in_place(bigint *X, big_uint v) {
+    for (size_t i = X->num_limbs; i > 0 && v != 0; i--) {
+        X->data[i - 1] += v;
+        v = X->data[i - 1] < v;
+    }
+    return v;
 }
 
-int random_bigint(bigint *X, size_t nbits) {
-    size_t n_limbs = nbits / 64;
-    if (nbits % 64 != 0) {
-        n_limbs++;
+/*
+ * Incremental prime search. One random odd start is drawn and its residues
+ * modulo the small primes are computed once. Each window then covers the
+ * odd candidates start, start + 2, ..., start + 2(window - 1): a bitmap is
+ * sieved from the residues, and moving to the next window only adds
+ * 2 * window to every residue. Optionally, candidates X with
+ * gcd(X - 1, e) != 1 are sieved out as well, tracking start mod e in a
+ * single limb.
+ */
+typedef struct {
+    size_t nbits;          /*!<  bit length of the candidates  */
+    size_t window;         /*!<  odd candidates per window     */
+    bigint start;          /*!<  first candidate of the window */
+    uint16_t *residues;    /*!<  start mod SMALL_PRIMES[i]     */
+    uint64_t *composite;   /*!<  window bitmap, 1 = composite  */
+    big_uint e;            /*!<  0, or the value X - 1 must be coprime to */
+    big_uint e_residue;    /*!<  start mod e                   */
+} prime_sieve;
+
+// splitmix64 (Steele, Lea and Flood): a fast, well-mixed but predictable
+// generator, used only for reproducible searches
+static uint64_t splitmix64(uint64_t *state) {
+    uint64_t z = (*state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+// Turns sieve->start into an odd nbits candidate and computes its residues
+static int sieve_set_start(prime_sieve *sieve) {
+    sieve->start.data[0] |= 1ULL << ((sieve->nbits - 1) % 64);
+    sieve->start.data[sieve->start.num_limbs - 1] |= 1;
+    if (sieve->e != 0) {
+        int err = big_mod_limb(&sieve->e_residue, &sieve->start, sieve->e);
+        if (err != 0) {
+            return err;
+        }
+    }
+    return small_prime_residues(sieve->residues, &sieve->start);
+}
+
+static int sieve_reseed(prime_sieve *sieve) {
+    int err = random_bigint(&sieve->start, sieve->nbits);
+    if (err != 0) {
+        return err;
+    }
+    return sieve_set_start(sieve);
+}
+
+// Starts window w of a seeded search at a value that depends only on
+// (seed, w), so that any worker can pick up any window
+static int sieve_seed_window(prime_sieve *sieve, uint64_t seed, uint64_t w) {
+    int err = resize_limbs(&sieve->start, (sieve->nbits + 63) / 64);
+    if (err != 0) {
+        return err;
+    }
+    sieve->start.signum = 1;
+    uint64_t state = seed ^ splitmix64(&w);
+    size_t top_bits = (sieve->nbits - 1) % 64 + 1;
+    for (size_t i = 0; i < sieve->start.num_limbs; i++) {
+        sieve->start.data[i] = splitmix64(&state);
     }
-    resize_limbs(X, n_limbs);
-    X->data[0] = random_limb(nbits % 64);
-    for (size_t i = 1; i < X->num_limbs; i++) {
-        X->data[i] = random_limb(64);
+    if (top_bits < 64) {
+        sieve->start.data[0] &= (1ULL << top_bits) - 1;
+    }
+    return sieve_set_start(sieve);
+}
+
+// Allocates the sieve buffers; the caller then draws a start
+static int sieve_init(prime_sieve *sieve, size_t nbits, big_uint e) {
+    // The expected gap between primes grows linearly with the bit length
+    // (about 0.35 * nbits odd candidates), so a window of nbits odd
+    // candidates holds a prime with roughly constant probability (~94%).
+    sieve->nbits = nbits;
+    sieve->window = (nbits + 63) / 64 * 64;
+    sieve->e = e;
+    big_init(&sieve->start);
+    sieve->residues = malloc(NUM_SMALL_PRIMES * sizeof(uint16_t));
+    sieve->composite = malloc(sieve->window / 64 * sizeof(uint64_t));
+    if (sieve->residues == NULL || sieve->composite == NULL) {
+        return ERR_BIGINT_ALLOC_FAILED;
     }
     return 0;
 }
 
+static void sieve_free(prime_sieve *sieve) {
+    big_free(&sieve->start);
+    free(sieve->residues);
+    free(sieve->composite);
+}
+
+// Marks every candidate start + 2k in the window that a small prime
+// divides, or for which start + 2k - 1 shares a factor with e
+static void sieve_fill(prime_sieve *sieve) {
+    memset(sieve->composite, 0, sieve->window / 64 * sizeof(uint64_t));
+    for (size_t i = 0; i < NUM_SMALL_PRIMES; i++) {
+        uint32_t p = SMALL_PRIMES[i];
+        // start + 2k == 0 (mod p)  <=>  k == -start / 2 (mod p)
+        uint32_t k = (uint32_t)(((uint64_t)(p - sieve->residues[i]) % p) *
+                                ((p + 1) / 2) % p);
+        for (; k < sieve->window; k += p) {
+            sieve->composite[k / 64] |= 1ULL << (k % 64);
+        }
+    }
+
+    if (sieve->e == 0) {
+        return;
+    }
+    // Only the few survivors are checked, with one single-limb GCD each
+    big_uint e = sieve->e;
+    for (size_t k = 0; k < sieve->window; k++) {
+        if (sieve->composite[k / 64] & (1ULL << (k % 64))) {
+            continue;
+        }
+        big_uint r = (big_uint)(((big_udbl)sieve->e_residue + 2 * k + e - 1) % e);
+        if (limb_gcd(r, e) != 1) {
+            sieve->composite[k / 64] |= 1ULL << (k % 64);
+        }
+    }
+}
+
+// Moves the window forward: start += 2 * window, updating the residues
+// with single-word arithmetic. Returns false if the next window would
+// leave the nbits range, in which case the caller reseeds.
+static bool sieve_advance(prime_sieve *sieve) {
+    if (add_limb_in_place(&sieve->start, 2 * sieve->window) != 0 ||
+        big_bitlen(&sieve->start) > sieve->nbits) {
+        return false;
+    }
+    for (size_t i = 0; i < NUM_SMALL_PRIMES; i++) {
+        uint32_t p = SMALL_PRIMES[i];
+        sieve->residues[i] = (sieve->residues[i] + 2 * sieve->window) % p;
+    }
+    if (sieve->e != 0) {
+        sieve->e_residue = (big_uint)(((big_udbl)sieve->e_residue +
+                                       2 * sieve->window) % sieve->e);
+    }
+    return true;
+}
+
+int big_is_prime(const bigint *X) {
+    return big_is_prime_ext(X, BIG_PRIMALITY_MILLER_RABIN);
+}
+
+int big_is_prime_ext(const bigint *X, int policy) {
+    if (policy != BIG_PRIMALITY_MILLER_RABIN && policy != BIG_PRIMALITY_BPSW) {
+        return ERR_BIGINT_BAD_INPUT_DATA;
+    }
+    if (X->signum != 1 || X->num_limbs == 0) {
+        return ERR_BIGINT_NOT_ACCEPTABLE;
+    }
+
+    // Below 2^16 the prime table answers directly
+    if (big_bitlen(X) <= 16) {
+        big_uint x = X->data[X->num_limbs - 1];
+        if (x == 2) {
+            return 0;
+        }
+        size_t lo = 0, hi = NUM_SMALL_PRIMES;
+        while (lo < hi) {
+            size_t mid = (lo + hi) / 2;
+            if (SMALL_PRIMES[mid] < x) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return lo < NUM_SMALL_PRIMES && SMALL_PRIMES[lo] == x ? 0 : ERR_BIGINT_NOT_ACCEPTABLE;
+    }
+
+    if ((X->data[X->num_limbs - 1] & 1) == 0) {
+        return ERR_BIGINT_NOT_ACCEPTABLE;
+    }
+    if (big_bitlen(X) <= 64) {
+        big_uint x = X->data[X->num_limbs - 1];
+        return limb_gcd(x % PRIMORIALS[0], PRIMORIALS[0]) == 1 && is_prime_u64(x)
+               ? 0 : ERR_BIGINT_NOT_ACCEPTABLE;
+    }
+    if (has_small_factor(X)) {
+        return ERR_BIGINT_NOT_ACCEPTABLE;
+    }
+    // X is not known to be random, so the generation round counts do not
+    // apply
+    if (policy == BIG_PRIMALITY_MILLER_RABIN) {
+        return miller_rabin(X, MR_WORST_CASE_ROUNDS, NULL);
+    }
+    return probable_prime(X, big_bitlen(X), policy, NULL);
+}
+
+// Returned by sieve_scan when the window holds no prime, or when the
+// cancel flag was set
+#define SEARCH_EXHAUSTED 1
+#define SEARCH_CANCELLED 2
+
+#ifdef BIG_HAVE_AVX2_KERNELS
+// Smaller candidates are cheap enough to test one at a time
+#define MONT4_MIN_BITS 256
+
+// Fermat test to the base 2 of four odd candidates X > 2^16 at once, one
+// per AVX2 lane: pass[l] is cleared if 2^(X - 1) != 1 mod X, which proves
+// X[l] composite. A composite failing it also fails the strong base-2
+// round of probable_prime, before any random base is drawn. If memory
+// runs out, every lane passes.
+static void fermat2_x4(const bigint *const X[4], size_t D, bool pass[4]) {
+    bigint two, E[4], Y[4];
+    const bigint *a[4], *e[4];
+    bigint *y[4];
+    big_init(&two);
+    int err = big_set_nonzero(&two, 2);
+    for (size_t l = 0; l < 4; l++) {
+        big_init(&E[l]);
+        big_init(&Y[l]);
+        a[l] = &two;
+        e[l] = &E[l];
+        y[l] = &Y[l];
+        if (err == 0) {
+            err = big_copy(&E[l], X[l]);
+        }
+        if (err == 0) {
+            E[l].data[E[l].num_limbs - 1] &= ~(big_uint)1;
+        }
+    }
+    if (err == 0) {
+        err = exp_mod_x4_avx2(y, a, e, X, D);
+    }
+    for (size_t l = 0; l < 4; l++) {
+        pass[l] = err != 0 || big_bitlen(&Y[l]) == 1;
+        big_free(&E[l]);
+        big_free(&Y[l]);
+    }
+    big_free(&two);
+}
+#endif
+
+// Tests the survivors of the current window in order and leaves the first
+// probable prime in X. *in_range is cleared if the window runs past nbits.
+// With AVX2, the survivors are taken four at a time through fermat2_x4
+// first; that only skips composites, so the result is the same.
+static int sieve_scan(prime_sieve *sieve, bigint *X, int policy,
+                      const atomic_bool *cancel, bool *in_range) {
+    sieve_fill(sieve);
+    *in_range = true;
+    size_t lanes = 1;
+#ifdef BIG_HAVE_AVX2_KERNELS
+    size_t D = sieve->nbits >= MONT4_MIN_BITS ? mont4_digits(sieve->nbits) : 0;
+    if (D != 0) {
+        lanes = 4;
+    }
+#endif
+    bigint batch[4];
+    for (size_t l = 0; l < 4; l++) {
+        big_init(&batch[l]);
+    }
+
+    int result = SEARCH_EXHAUSTED;
+    size_t k = 0;
+    while (result == SEARCH_EXHAUSTED && *in_range && k < sieve->window) {
+        if (atomic_load_explicit(cancel, memory_order_relaxed)) {
+            result = SEARCH_CANCELLED;
+            break;
+        }
+        // The next (up to) `lanes` survivors, in order
+        size_t count = 0;
+        for (; k < sieve->window && count < lanes; k++) {
+            if (sieve->composite[k / 64] & (1ULL << (k % 64))) {
+                continue;
+            }
+            int err = big_copy(&batch[count], &sieve->start);
+            if (err != 0) {
+                result = err;
+                break;
+            }
+            if (add_limb_in_place(&batch[count], 2 * k) != 0 ||
+                big_bitlen(&batch[count]) > sieve->nbits) {
+                *in_range = false;
+                break;
+            }
+            count++;
+        }
+
+        bool pass[4] = {true, true, true, true};
+#ifdef BIG_HAVE_AVX2_KERNELS
+        if (result == SEARCH_EXHAUSTED && count > 1) {
+            // A short last group fills its spare lanes with the first
+            const bigint *lane[4];
+            for (size_t l = 0; l < 4; l++) {
+                lane[l] = &batch[l < count ? l : 0];
+            }
+            fermat2_x4(lane, D, pass);
+        }
+#endif
+        for (size_t l = 0; l < count && result == SEARCH_EXHAUSTED; l++) {
+            if (pass[l] && probable_prime(&batch[l], sieve->nbits, policy, cancel) == 0) {
+                result = big_copy(X, &batch[l]);
+            }
+        }
+    }
+
+    for (size_t l = 0; l < 4; l++) {
+        big_free(&batch[l]);
+    }
+    if (result == SEARCH_EXHAUSTED && *in_range &&
+        atomic_load_explicit(cancel, memory_order_relaxed)) {
+        result = SEARCH_CANCELLED;
+    }
+    return result;
+}
+
+// Searches windows of random odd nbits candidates (nbits > 16) until one
+// passes the probable-prime test, or until cancel is set
+static int sieve_search(bigint *X, size_t nbits, int policy, big_uint e,
+                        const atomic_bool *cancel) {
+    prime_sieve sieve;
+    int err = sieve_init(&sieve, nbits, e);
+    if (err == 0) {
+        err = sieve_reseed(&sieve);
+    }
+    while (err == 0) {
+        bool in_range;
+        err = sieve_scan(&sieve, X, policy, cancel, &in_range);
+        if (err == SEARCH_EXHAUSTED) {
+            err = in_range && sieve_advance(&sieve) ? 0 : sieve_reseed(&sieve);
+        } else if (err == 0) {
+            break;
+        }
+    }
+    sieve_free(&sieve);
+    return err;
+}
+
+/*
+ * Parallel prime search. In the default mode every worker runs
+ * sieve_search from its own random start; the first one to find a prime
+ * claims `winner` and sets `done`, which the others notice before their
+ * next candidate or Miller-Rabin round. A worker that fails also sets
+ * `done`, so errors are not waited out.
+ *
+ * In the seeded mode, windows are numbered 0, 1, 2, ... and the start of
+ * window w depends only on (seed, w). Workers claim window numbers in
+ * order, and the result is the first prime of the lowest window holding
+ * one, exactly as a single thread would find it. Finding a prime in
+ * window w cancels only the workers busy with a later window; the ones
+ * below w keep going, since they may still hold the result.
+ *
+ * The calling thread acts as worker 0.
+ */
+typedef struct prime_worker prime_worker;
+
+typedef struct {
+    size_t nbits;
+    const big_prime_ctx *ctx;
+    atomic_bool done;      /*!<  set once any worker has finished   */
+    atomic_int winner;     /*!<  first worker with a prime, or -1    */
+
+    // seeded mode
+    pthread_mutex_t lock;  /*!<  guards the fields below            */
+    prime_worker *workers;
+    size_t num_workers;
+    uint64_t next_window;  /*!<  next window number to claim        */
+    uint64_t best_window;  /*!<  lowest window with a prime so far  */
+    int err;               /*!<  first error of any worker          */
+} prime_search;
+
+struct prime_worker {
+    prime_search *search;
+    int index;
+    pthread_t thread;
+    bigint X;              /*!<  the worker's current candidate     */
+    int err;
+    uint64_t window;       /*!<  seeded mode: window being scanned  */
+    atomic_bool cancel;    /*!<  seeded mode: a lower window won    */
+};
+
+static void *prime_worker_run(void *arg) {
+    prime_worker *worker = arg;
+    prime_search *search = worker->search;
+
+    worker->err = sieve_search(&worker->X, search->nbits, search->ctx->policy,
+                               search->ctx->e, &search->done);
+    if (worker->err == 0) {
+        int none = -1;
+        atomic_compare_exchange_strong(&search->winner, &none, worker->index);
+    }
+    if (worker->err != SEARCH_CANCELLED) {
+        atomic_store(&search->done, true);
+    }
+    return NULL;
+}
+
+// Called with search->lock held
+static void cancel_windows_above(prime_search *search, uint64_t w) {
+    for (size_t i = 0; i < search->num_workers; i++) {
+        if (search->workers[i].window > w) {
+            atomic_store(&search->workers[i].cancel, true);
+        }
+    }
+}
+
+static void *seeded_worker_run(void *arg) {
+    prime_worker *worker = arg;
+    prime_search *search = worker->search;
+    const big_prime_ctx *ctx = search->ctx;
+
+    prime_sieve sieve;
+    int err = sieve_init(&sieve, search->nbits, ctx->e);
+    while (true) {
+        pthread_mutex_lock(&search->lock);
+        if (err != 0 && search->err == 0) {
+            search->err = err;
+            cancel_windows_above(search, 0);
+            search->best_window = 0;
+        }
+        if (err != 0 || search->next_window >= search->best_window) {
+            worker->window = UINT64_MAX;
+            pthread_mutex_unlock(&search->lock);
+            break;
+        }
+        uint64_t w = search->next_window++;
+        worker->window = w;
+        atomic_store(&worker->cancel, false);
+        pthread_mutex_unlock(&search->lock);
+
+        bool in_range;
+        err = sieve_seed_window(&sieve, ctx->seed, w);
+        if (err == 0) {
+            err = sieve_scan(&sieve, &worker->X, ctx->policy, &worker->cancel,
+                             &in_range);
+        }
+        if (err == 0) {
+            pthread_mutex_lock(&search->lock);
+            if (w < search->best_window) {
+                search->best_window = w;
+                atomic_store(&search->winner, worker->index);
+                cancel_windows_above(search, w);
+            }
+            pthread_mutex_unlock(&search->lock);
+        }
+        if (err == SEARCH_EXHAUSTED || err == SEARCH_CANCELLED || err == 0) {
+            err = 0;
+        }
+    }
+    sieve_free(&sieve);
+    return NULL;
+}
+
+void big_prime_ctx_init(big_prime_ctx *ctx) {
+    ctx->policy = BIG_PRIMALITY_MILLER_RABIN;
+    ctx->e = 0;
+    ctx->num_workers = 1;
+    ctx->seeded = 0;
+    ctx->seed = 0;
+}
+
 int big_gen_prime(bigint *X, size_t nbits) {
-    // Process for this procedure:
-    // 1. Preselect a random number with n-bits
-    // 2. Ensure the chosen number is not divisible by the first few hundred primes 
-    //    (these are pre-generated)
-    random_bigint(X, nbits); 
-    while (big_is_prime(X) == 1) {
-        random_bigint(X, nbits); 
+    return big_gen_prime_ext(X, nbits, BIG_PRIMALITY_MILLER_RABIN, 0);
+}
+
+int big_gen_prime_ext(bigint *X, size_t nbits, int policy, big_uint e) {
+    big_prime_ctx ctx;
+    big_prime_ctx_init(&ctx);
+    ctx.policy = policy;
+    ctx.e = e;
+    return big_gen_prime_ctx(X, nbits, &ctx);
+}
+
+int big_gen_prime_ctx(bigint *X, size_t nbits, const big_prime_ctx *ctx) {
+    int policy = ctx->policy;
+    big_uint e = ctx->e;
+    if (nbits < 3 || (e != 0 && (e & 1) == 0) ||
+        (policy != BIG_PRIMALITY_MILLER_RABIN && policy != BIG_PRIMALITY_BPSW) ||
+        (ctx->seeded && nbits <= 16)) {
+        return ERR_BIGINT_BAD_INPUT_DATA;
     }
-    return 0;
+
+    // Too small to sieve: the candidates could be small primes themselves
+    if (nbits <= 16) {
+        while (true) {
+            int err = random_bigint(X, nbits);
+            if (err != 0) {
+                return err;
+            }
+            X->data[0] |= 1ULL << (nbits - 1);
+            X->data[0] |= 1;
+            if (e != 0 && limb_gcd((X->data[0] - 1) % e, e) != 1) {
+                continue;
+            }
+            if (big_is_prime_ext(X, policy) == 0) {
+                return 0;
+            }
+        }
+    }
+
+    size_t num_workers = ctx->num_workers;
+    if (num_workers == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        num_workers = online > 0 ? (size_t)online : 1;
+    }
+
+    prime_search search = {.nbits = nbits, .ctx = ctx,
+                           .num_workers = num_workers,
+                           .best_window = UINT64_MAX};
+    atomic_init(&search.done, false);
+    atomic_init(&search.winner, -1);
+    prime_worker *workers = calloc(num_workers, sizeof(prime_worker));
+    if (workers == NULL) {
+        return ERR_BIGINT_ALLOC_FAILED;
+    }
+    search.workers = workers;
+    pthread_mutex_init(&search.lock, NULL);
+    void *(*run)(void *) = ctx->seeded ? seeded_worker_run : prime_worker_run;
+
+    for (size_t i = 0; i < num_workers; i++) {
+        workers[i].search = &search;
+        workers[i].index = (int)i;
+        workers[i].window = UINT64_MAX;
+        atomic_init(&workers[i].cancel, false);
+        big_init(&workers[i].X);
+    }
+    // If a thread cannot be started, search with the ones that were
+    size_t started = 1;
+    while (started < num_workers &&
+           pthread_create(&workers[started].thread, NULL, run,
+                          &workers[started]) == 0) {
+        started++;
+    }
+    run(&workers[0]);
+    for (size_t i = 1; i < started; i++) {
+        pthread_join(workers[i].thread, NULL);
+    }
+
+    int err = search.err;
+    int winner = atomic_load(&search.winner);
+    if (err == 0 && winner >= 0) {
+        err = big_copy(X, &workers[winner].X);
+    } else {
+        for (size_t i = 0; i < started && err == 0; i++) {
+            if (workers[i].err != SEARCH_CANCELLED) {
+                err = workers[i].err;
+            }
+        }
+    }
+    for (size_t i = 0; i < num_workers; i++) {
+        big_free(&workers[i].X);
+    }
+    free(workers);
+    pthread_mutex_destroy(&search.lock);
+    return err;
 }
 
 int big_two_to_pwr(bigint *X, size_t pwr) {
     size_t n_limbs_for_exp = 1 + pwr / 64;
-    if (pwr % 64 != 0) {
-        n_limbs_for_exp++;
-    }
 
     if (X->data != NULL) {
         free(X->data);
     }
 
     X->data = calloc(n_limbs_for_exp, sizeof(big_uint));
+    if (X->data == NULL) {
+        X->num_limbs = 0;
+        X->signum = 0;
+        return ERR_BIGINT_ALLOC_FAILED;
+    }
     X->num_limbs = n_limbs_for_exp;
     X->signum = 1;
     X->data[0] = (1UL << (pwr % 64));
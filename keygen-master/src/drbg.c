@@ -0,0 +1,364 @@
+#include "drbg.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <sys/random.h>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define DRBG_HAVE_AVX2_KERNELS
+#endif
+
+// Reseed from the kernel after this many refills (about 15 MiB of output)
+#define DRBG_RESEED_INTERVAL (1u << 15)
+
+// "expand 32-byte k"
+static const uint32_t CHACHA20_CONSTANTS[4] = {
+    0x61707865, 0x3320646e, 0x79622d32, 0x6b206574
+};
+
+#define ROTL32(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+
+#define QUARTER_ROUND(a, b, c, d)                          \
+    do {                                                   \
+        a += b; d ^= a; d = ROTL32(d, 16);                 \
+        c += d; b ^= c; b = ROTL32(b, 12);                 \
+        a += b; d ^= a; d = ROTL32(d, 8);                  \
+        c += d; b ^= c; b = ROTL32(b, 7);                  \
+    } while (0)
+
+// Clears secrets through a volatile pointer, so that the stores are kept
+// even where the memory is dead right after
+static void drbg_wipe(void *buf, size_t len) {
+    volatile uint8_t *p = buf;
+    while (len-- > 0) {
+        *p++ = 0;
+    }
+}
+
+static void chacha20_init_state(uint32_t s[16], const uint32_t key[8],
+                                uint64_t nonce, uint64_t counter) {
+    memcpy(s, CHACHA20_CONSTANTS, sizeof(CHACHA20_CONSTANTS));
+    memcpy(s + 4, key, 8 * sizeof(uint32_t));
+    s[12] = (uint32_t)counter;
+    s[13] = (uint32_t)(counter >> 32);
+    s[14] = (uint32_t)nonce;
+    s[15] = (uint32_t)(nonce >> 32);
+}
+
+static void chacha20_block(uint8_t out[64], const uint32_t s[16]) {
+    uint32_t x[16];
+    memcpy(x, s, sizeof(x));
+    for (int i = 0; i < 10; i++) {
+        QUARTER_ROUND(x[0], x[4], x[8], x[12]);
+        QUARTER_ROUND(x[1], x[5], x[9], x[13]);
+        QUARTER_ROUND(x[2], x[6], x[10], x[14]);
+        QUARTER_ROUND(x[3], x[7], x[11], x[15]);
+        QUARTER_ROUND(x[0], x[5], x[10], x[15]);
+        QUARTER_ROUND(x[1], x[6], x[11], x[12]);
+        QUARTER_ROUND(x[2], x[7], x[8], x[13]);
+        QUARTER_ROUND(x[3], x[4], x[9], x[14]);
+    }
+    for (int i = 0; i < 16; i++) {
+        uint32_t v = x[i] + s[i];
+        out[4 * i] = (uint8_t)v;
+        out[4 * i + 1] = (uint8_t)(v >> 8);
+        out[4 * i + 2] = (uint8_t)(v >> 16);
+        out[4 * i + 3] = (uint8_t)(v >> 24);
+    }
+}
+
+#ifdef DRBG_HAVE_AVX2_KERNELS
+/*
+ * Eight blocks at once: lane j of register i holds word i of block j, so
+ * every quarter round is a handful of 8-wide instructions. The rotations
+ * by 16 and 8 are byte shuffles. At the end an 8x8 transpose turns the
+ * words back into consecutive blocks.
+ */
+#define ROTL_AVX2(x, n) \
+    _mm256_or_si256(_mm256_slli_epi32(x, n), _mm256_srli_epi32(x, 32 - (n)))
+
+#define QUARTER_ROUND_AVX2(a, b, c, d)                                     \
+    do {                                                                   \
+        a = _mm256_add_epi32(a, b); d = _mm256_xor_si256(d, a);            \
+        d = _mm256_shuffle_epi8(d, rot16);                                 \
+        c = _mm256_add_epi32(c, d); b = _mm256_xor_si256(b, c);            \
+        b = ROTL_AVX2(b, 12);                                              \
+        a = _mm256_add_epi32(a, b); d = _mm256_xor_si256(d, a);            \
+        d = _mm256_shuffle_epi8(d, rot8);                                  \
+        c = _mm256_add_epi32(c, d); b = _mm256_xor_si256(b, c);            \
+        b = ROTL_AVX2(b, 7);                                               \
+    } while (0)
+
+// Stores words 0-7 (half = 0) or 8-15 (half = 1) of eight blocks from the
+// eight registers a[0..7], which hold one word of every block each
+__attribute__((target("avx2")))
+static void transpose_store_avx2(uint8_t *out, __m256i a[8], int half) {
+    __m256i t[8], u[8];
+    for (int i = 0; i < 8; i += 2) {
+        t[i] = _mm256_unpacklo_epi32(a[i], a[i + 1]);
+        t[i + 1] = _mm256_unpackhi_epi32(a[i], a[i + 1]);
+    }
+    for (int i = 0; i < 8; i += 4) {
+        u[i] = _mm256_unpacklo_epi64(t[i], t[i + 2]);
+        u[i + 1] = _mm256_unpackhi_epi64(t[i], t[i + 2]);
+        u[i + 2] = _mm256_unpacklo_epi64(t[i + 1], t[i + 3]);
+        u[i + 3] = _mm256_unpackhi_epi64(t[i + 1], t[i + 3]);
+    }
+    // u[k] and u[k + 4] hold words 0-3 and 4-7 of blocks k and k + 4
+    for (int k = 0; k < 4; k++) {
+        __m256i lo = _mm256_permute2x128_si256(u[k], u[k + 4], 0x20);
+        __m256i hi = _mm256_permute2x128_si256(u[k], u[k + 4], 0x31);
+        _mm256_storeu_si256((__m256i *)(out + 64 * k + 32 * half), lo);
+        _mm256_storeu_si256((__m256i *)(out + 64 * (k + 4) + 32 * half), hi);
+    }
+}
+
+__attribute__((target("avx2")))
+static void chacha20_blocks_avx2(uint8_t *out, const uint32_t s[16]) {
+    const __m256i rot16 = _mm256_setr_epi8(
+        2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+        2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+    const __m256i rot8 = _mm256_setr_epi8(
+        3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14,
+        3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14);
+
+    __m256i in[16], x[16];
+    for (int i = 0; i < 16; i++) {
+        in[i] = _mm256_set1_epi32((int)s[i]);
+    }
+    // 64-bit block counter: add 0..7 to the low word, carrying into word 13
+    __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i low = _mm256_add_epi32(in[12], lanes);
+    __m256i sign = _mm256_set1_epi32((int)0x80000000);
+    __m256i carry = _mm256_cmpgt_epi32(_mm256_xor_si256(in[12], sign),
+                                       _mm256_xor_si256(low, sign));
+    in[12] = low;
+    in[13] = _mm256_sub_epi32(in[13], carry);
+    memcpy(x, in, sizeof(x));
+
+    for (int i = 0; i < 10; i++) {
+        QUARTER_ROUND_AVX2(x[0], x[4], x[8], x[12]);
+        QUARTER_ROUND_AVX2(x[1], x[5], x[9], x[13]);
+        QUARTER_ROUND_AVX2(x[2], x[6], x[10], x[14]);
+        QUARTER_ROUND_AVX2(x[3], x[7], x[11], x[15]);
+        QUARTER_ROUND_AVX2(x[0], x[5], x[10], x[15]);
+        QUARTER_ROUND_AVX2(x[1], x[6], x[11], x[12]);
+        QUARTER_ROUND_AVX2(x[2], x[7], x[8], x[13]);
+        QUARTER_ROUND_AVX2(x[3], x[4], x[9], x[14]);
+    }
+    for (int i = 0; i < 16; i++) {
+        x[i] = _mm256_add_epi32(x[i], in[i]);
+    }
+    transpose_store_avx2(out, x, 0);
+    transpose_store_avx2(out, x + 8, 1);
+}
+#endif
+
+void chacha20_blocks(uint8_t *out, const uint32_t key[8], uint64_t nonce,
+                     uint64_t counter) {
+    uint32_t s[16];
+    chacha20_init_state(s, key, nonce, counter);
+#ifdef DRBG_HAVE_AVX2_KERNELS
+    if (__builtin_cpu_supports("avx2")) {
+        chacha20_blocks_avx2(out, s);
+        drbg_wipe(s, sizeof(s));
+        return;
+    }
+#endif
+    for (int j = 0; j < DRBG_BLOCKS; j++) {
+        chacha20_block(out + 64 * j, s);
+        if (++s[12] == 0) {
+            s[13]++;
+        }
+    }
+    drbg_wipe(s, sizeof(s));
+}
+
+/*
+ * fork() duplicates every thread-local generator into the child, which
+ * would then repeat the parent's output. A child handler bumps the
+ * generation, and a generator seeded in an older generation reseeds
+ * before its next output.
+ */
+static atomic_uint drbg_fork_generation;
+static pthread_once_t drbg_atfork_once = PTHREAD_ONCE_INIT;
+
+static void drbg_after_fork(void) {
+    atomic_fetch_add(&drbg_fork_generation, 1);
+}
+
+static void drbg_register_atfork(void) {
+    pthread_atfork(NULL, NULL, drbg_after_fork);
+}
+
+void drbg_init(drbg_context *ctx) {
+    memset(ctx, 0, sizeof(*ctx));
+}
+
+void drbg_free(drbg_context *ctx) {
+    drbg_wipe(ctx, sizeof(*ctx));
+}
+
+static int get_entropy(uint8_t *buf, size_t len) {
+    while (len > 0) {
+        ssize_t n = getrandom(buf, len, 0);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return ERR_DRBG_ENTROPY_FAILED;
+        }
+        buf += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+int drbg_reseed(drbg_context *ctx) {
+    pthread_once(&drbg_atfork_once, drbg_register_atfork);
+    unsigned int generation = atomic_load(&drbg_fork_generation);
+
+    uint32_t seed[DRBG_KEY_SIZE / 4];
+    int err = get_entropy((uint8_t *)seed, sizeof(seed));
+    if (err != 0) {
+        return err;
+    }
+    // Mixed into the old key rather than replacing it
+    for (int i = 0; i < DRBG_KEY_SIZE / 4; i++) {
+        ctx->key[i] ^= seed[i];
+    }
+    drbg_wipe(seed, sizeof(seed));
+    drbg_wipe(ctx->buffer, sizeof(ctx->buffer));
+    ctx->available = 0;
+    ctx->refills = 0;
+    ctx->generation = generation;
+    ctx->seeded = 1;
+    return 0;
+}
+
+// Seeds are byte strings; the key words are little-endian, as in ChaCha20
+static void load_key(uint32_t key[DRBG_KEY_SIZE / 4], const uint8_t *seed) {
+    for (int i = 0; i < DRBG_KEY_SIZE / 4; i++) {
+        key[i] = (uint32_t)seed[4 * i] | (uint32_t)seed[4 * i + 1] << 8 |
+                 (uint32_t)seed[4 * i + 2] << 16 | (uint32_t)seed[4 * i + 3] << 24;
+    }
+}
+
+void drbg_seed_deterministic(drbg_context *ctx, const uint8_t *seed) {
+    drbg_free(ctx);
+    load_key(ctx->key, seed);
+    ctx->seeded = 1;
+    ctx->deterministic = 1;
+}
+
+void drbg_derive_seed(uint8_t *out, const uint8_t *seed, uint64_t index) {
+    // The first block of the keystream under the base seed, with the
+    // stream number as the nonce
+    uint32_t key[DRBG_KEY_SIZE / 4];
+    uint8_t buffer[DRBG_BUFFER_SIZE];
+    load_key(key, seed);
+    chacha20_blocks(buffer, key, index, 0);
+    memcpy(out, buffer, DRBG_KEY_SIZE);
+    drbg_wipe(buffer, sizeof(buffer));
+    drbg_wipe(key, sizeof(key));
+}
+
+// Generates a new buffer and replaces the key with its first 32 bytes
+static int drbg_refill(drbg_context *ctx) {
+    if (!ctx->deterministic &&
+        (!ctx->seeded || ctx->refills >= DRBG_RESEED_INTERVAL ||
+         ctx->generation != atomic_load_explicit(&drbg_fork_generation,
+                                                 memory_order_relaxed))) {
+        int err = drbg_reseed(ctx);
+        if (err != 0) {
+            return err;
+        }
+    }
+    chacha20_blocks(ctx->buffer, ctx->key, 0, 0);
+    memcpy(ctx->key, ctx->buffer, DRBG_KEY_SIZE);
+    drbg_wipe(ctx->buffer, DRBG_KEY_SIZE);
+    ctx->available = DRBG_BUFFER_SIZE - DRBG_KEY_SIZE;
+    ctx->refills++;
+    return 0;
+}
+
+int drbg_random(drbg_context *ctx, void *out, size_t len) {
+    uint8_t *dst = out;
+    if (ctx->seeded && !ctx->deterministic && ctx->generation != atomic_load_explicit(
+            &drbg_fork_generation, memory_order_relaxed)) {
+        // Whatever is buffered was generated before the fork
+        ctx->available = 0;
+    }
+    while (len > 0) {
+        if (ctx->available == 0) {
+            int err = drbg_refill(ctx);
+            if (err != 0) {
+                return err;
+            }
+        }
+        // Hand out the buffer in order and erase what was used
+        size_t n = len < ctx->available ? len : ctx->available;
+        uint8_t *src = ctx->buffer + DRBG_BUFFER_SIZE - ctx->available;
+        memcpy(dst, src, n);
+        drbg_wipe(src, n);
+        ctx->available -= n;
+        dst += n;
+        len -= n;
+    }
+    return 0;
+}
+
+/*
+ * A thread's generator holds its key and up to DRBG_BUFFER_SIZE bytes of
+ * unused keystream. On first use it is attached to a thread-specific key
+ * whose destructor wipes it when the thread exits. The main thread's
+ * generator is not wiped by exit(), which runs no such destructors.
+ */
+static _Thread_local drbg_context thread_drbg;
+static _Thread_local int thread_drbg_attached;
+static pthread_key_t thread_drbg_key;
+static pthread_once_t thread_drbg_key_once = PTHREAD_ONCE_INIT;
+
+static void thread_drbg_destroy(void *ctx) {
+    drbg_free(ctx);
+}
+
+static void thread_drbg_create_key(void) {
+    pthread_key_create(&thread_drbg_key, thread_drbg_destroy);
+}
+
+static drbg_context *thread_drbg_get(void) {
+    if (!thread_drbg_attached) {
+        pthread_once(&thread_drbg_key_once, thread_drbg_create_key);
+        pthread_setspecific(thread_drbg_key, &thread_drbg);
+        thread_drbg_attached = 1;
+    }
+    return &thread_drbg;
+}
+
+int drbg_thread_random(void *out, size_t len) {
+    return drbg_random(thread_drbg_get(), out, len);
+}
+
+void drbg_thread_seed(const uint8_t *seed) {
+    if (seed == NULL) {
+        drbg_free(&thread_drbg);
+    } else {
+        drbg_seed_deterministic(thread_drbg_get(), seed);
+    }
+}
+
+int drbg_thread_is_deterministic(void) {
+    return thread_drbg.deterministic;
+}
+
+int drbg_thread_derive_seed(uint8_t *seed) {
+    if (!thread_drbg.deterministic) {
+        return 0;
+    }
+    drbg_random(&thread_drbg, seed, DRBG_KEY_SIZE);
+    return 1;
+}
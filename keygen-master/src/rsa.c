@@ -4,9 +4,10 @@
 #include <string.h>
 #include <stdbool.h>
 #include <stdlib.h>
-#include <time.h>
+#include <pthread.h>
 
 #include "base64.h"
+#include "drbg.h"
 
 #define RSA_KEY_STRING = "ssh-rsa"
 
@@ -24,7 +25,15 @@ void rsa_init(rsa_context *ctx) {
     big_init(&ctx->RN);
     big_init(&ctx->RP);
     big_init(&ctx->RQ);
-    srand(time(NULL));
+
+    ctx->num_other = 0;
+    for (size_t i = 0; i < RSA_MAX_PRIMES - 2; i++) {
+        big_init(&ctx->other[i].R);
+        big_init(&ctx->other[i].D);
+        big_init(&ctx->other[i].T);
+        big_init(&ctx->other[i].RR);
+    }
+    ctx->deterministic = 0;
 }
 
 void rsa_free(rsa_context *ctx) {
@@ -42,128 +51,765 @@ void rsa_free(rsa_context *ctx) {
     big_free(&ctx->RN);
     big_free(&ctx->RP);
     big_free(&ctx->RQ);
-    free(ctx);
+
+    for (size_t i = 0; i < RSA_MAX_PRIMES - 2; i++) {
+        big_free(&ctx->other[i].R);
+        big_free(&ctx->other[i].D);
+        big_free(&ctx->other[i].T);
+        big_free(&ctx->other[i].RR);
+    }
+    ctx->num_other = 0;
 }
 
-int rsa_gen_key(rsa_context *ctx, size_t nbits, big_uint exponent) {
-    big_set_nonzero(&ctx->E, exponent);
+int rsa_precompute(rsa_context *ctx) {
+    int err = big_mont_rr(&ctx->RN, &ctx->N);
+    if (err == 0 && ctx->P.signum != 0) {
+        err = big_mont_rr(&ctx->RP, &ctx->P);
+    }
+    if (err == 0 && ctx->Q.signum != 0) {
+        err = big_mont_rr(&ctx->RQ, &ctx->Q);
+    }
+    for (size_t i = 0; err == 0 && i < ctx->num_other; i++) {
+        err = big_mont_rr(&ctx->other[i].RR, &ctx->other[i].R);
+    }
+    return err;
+}
 
-    bigint ONE;
-    big_set_nonzero(&ONE, 1);
-    
-    bool complete = false;
-    while (!complete) {
-        
-        big_gen_prime(&ctx->P, nbits / 2);
-        big_gen_prime(&ctx->Q, nbits / 2);
-        big_mul(&ctx->N, &ctx->P, &ctx->Q);
+// X = A^E mod N; a one-limb E skips the window table of big_exp_mod
+static int rsa_exp_mod_n(rsa_context *ctx, bigint *X, const bigint *A,
+                         const bigint *E) {
+    if (E->num_limbs == 1) {
+        return big_exp_mod_limb(X, A, E->data[0], &ctx->N, &ctx->RN);
+    }
+    return big_exp_mod(X, A, E, &ctx->N, &ctx->RN);
+}
+
+int rsa_public(rsa_context *ctx, const bigint *in, bigint *out) {
+    if (ctx->N.signum != 1 || ctx->E.signum != 1 ||
+        in->signum == -1 || big_cmp(in, &ctx->N) >= 0) {
+        return ERR_BIGINT_BAD_INPUT_DATA;
+    }
+    return rsa_exp_mod_n(ctx, out, in, &ctx->E);
+}
+
+// Whether the CRT fields of a key are all set
+static bool rsa_has_crt(const rsa_context *ctx) {
+    if (ctx->N.signum != 1 || ctx->P.signum != 1 || ctx->Q.signum != 1 ||
+        ctx->QP.signum != 1 || ctx->num_other > RSA_MAX_PRIMES - 2) {
+        return false;
+    }
+    for (size_t i = 0; i < ctx->num_other; i++) {
+        if (ctx->other[i].R.signum != 1 || ctx->other[i].T.signum != 1) {
+            return false;
+        }
+    }
+    return true;
+}
 
-        bigint abs_p_minus_q;
-        big_init(&abs_p_minus_q);
-        big_sub(&abs_p_minus_q, &ctx->P, &ctx->Q);
-        if (abs_p_minus_q.signum < 0) {
-            abs_p_minus_q.signum = 1;
+// Prime number i of the key, counting P and Q as 0 and 1, and its cached
+// R^2
+static const bigint *rsa_prime(const rsa_context *ctx, size_t i) {
+    return i == 0 ? &ctx->P : i == 1 ? &ctx->Q : &ctx->other[i - 2].R;
+}
+
+static bigint *rsa_prime_rr(rsa_context *ctx, size_t i) {
+    return i == 0 ? &ctx->RP : i == 1 ? &ctx->RQ : &ctx->other[i - 2].RR;
+}
+
+/*
+ * S mod N from its residues M[i] mod the primes, by Garner's CRT
+ * recombination:
+ *   H = QP * (M[0] - M[1]) mod P,
+ *   S = M[1] + H * Q, which is S mod P * Q.
+ * Each further prime r of a multi-prime key extends S from mod Y to
+ * mod Y * r (RFC 8017 Section 5.1.2), where Y = P * Q * ... are the
+ * primes before it:
+ *   H = T_r * (M[i] - S) mod r,
+ *   S = S + H * Y.
+ * M is used as scratch.
+ */
+static int rsa_crt_join(const rsa_context *ctx, bigint *S, bigint *M) {
+    bigint Y;
+    big_init(&Y);
+
+    int err;
+    if ((err = big_sub(S, &M[0], &M[1])) == 0 &&
+        (err = big_mul(S, S, &ctx->QP)) == 0 &&
+        (err = big_mod(S, S, &ctx->P)) == 0 &&
+        (err = big_mul(S, S, &ctx->Q)) == 0 &&
+        (err = big_add(S, S, &M[1])) == 0 &&
+        ctx->num_other > 0) {
+        err = big_mul(&Y, &ctx->P, &ctx->Q);
+    }
+    for (size_t i = 0; err == 0 && i < ctx->num_other; i++) {
+        const rsa_prime_info *info = &ctx->other[i];
+        bigint *H = &M[i + 2];
+        if ((err = big_sub(H, H, S)) == 0 &&
+            (err = big_mul(H, H, &info->T)) == 0 &&
+            (err = big_mod(H, H, &info->R)) == 0 &&
+            (err = big_mul(H, H, &Y)) == 0 &&
+            (err = big_add(S, S, H)) == 0) {
+            err = big_mul(&Y, &Y, &info->R);
         }
+    }
+
+    big_free(&Y);
+    return err;
+}
+
+// X = A^-1 mod N, joined from the inverses mod the primes, which are
+// about half as costly together as one inversion mod N
+static int rsa_crt_inverse(const rsa_context *ctx, bigint *X, const bigint *A) {
+    bigint M[RSA_MAX_PRIMES];
+    for (size_t i = 0; i < RSA_MAX_PRIMES; i++) {
+        big_init(&M[i]);
+    }
 
-        bigint pwr2;
-        big_init(&pwr2);
-        big_two_to_pwr(&pwr2, nbits / 2 - 100);
+    int err = 0;
+    for (size_t i = 0; err == 0 && i < ctx->num_other + 2; i++) {
+        err = big_inv_mod(&M[i], A, rsa_prime(ctx, i));
+    }
+    if (err == 0) {
+        err = rsa_crt_join(ctx, X, M);
+    }
 
-        if (big_cmp(&abs_p_minus_q, &pwr2) < 1) {
-            big_free(&abs_p_minus_q);
+    for (size_t i = 0; i < RSA_MAX_PRIMES; i++) {
+        big_free(&M[i]);
+    }
+    return err;
+}
+
+// Draws a random blinding value R in [1, N) and its inverse VF; R has no
+// inverse only if it shares a factor with N, which is negligibly rare
+static int rsa_blinding_value(const rsa_context *ctx, bigint *R, bigint *VF) {
+    for (int i = 0; i < RSA_BLINDING_TRIES; i++) {
+        int err = big_fill_random(R, ctx->len);
+        if (err == 0) {
+            err = big_mod(R, R, &ctx->N);
+        }
+        if (err != 0) {
+            return err;
+        }
+        if (R->signum == 0) {
             continue;
         }
+        err = rsa_crt_inverse(ctx, VF, R);
+        if (err != ERR_BIGINT_NOT_ACCEPTABLE) {
+            return err;
+        }
+    }
+    return ERR_BIGINT_RNG_FAILED;
+}
+
+// S = C^d mod N from the exponents d mod (r - 1) of the primes r. The
+// exponentiations mod P and Q are half the size of N, so together they
+// cost about a quarter of C^d mod N.
+static int rsa_crt_exp(rsa_context *ctx, bigint *S, const bigint *C,
+                       const bigint *const *exponents) {
+    bigint M[RSA_MAX_PRIMES];
+    for (size_t i = 0; i < RSA_MAX_PRIMES; i++) {
+        big_init(&M[i]);
+    }
+
+    int err = 0;
+    for (size_t i = 0; err == 0 && i < ctx->num_other + 2; i++) {
+        err = big_exp_mod(&M[i], C, exponents[i], rsa_prime(ctx, i),
+                          rsa_prime_rr(ctx, i));
+    }
+    if (err == 0) {
+        err = rsa_crt_join(ctx, S, M);
+    }
 
-        big_free(&abs_p_minus_q);
+    for (size_t i = 0; i < RSA_MAX_PRIMES; i++) {
+        big_free(&M[i]);
+    }
+    return err;
+}
 
-        bigint p_minus_1, q_minus_1;
-        big_init(&p_minus_1);
-        big_init(&q_minus_1);
+// The CRT exponentiation of C = in * R^E mod N blinded, and
+// out = S * R^-1 mod N
+int rsa_private(rsa_context *ctx, const bigint *in, bigint *out) {
+    if (!rsa_has_crt(ctx) || ctx->DP.signum != 1 || ctx->DQ.signum != 1 ||
+        in->signum == -1 || big_cmp(in, &ctx->N) >= 0) {
+        return ERR_BIGINT_BAD_INPUT_DATA;
+    }
+    const bigint *exponents[RSA_MAX_PRIMES] = {&ctx->DP, &ctx->DQ};
+    for (size_t i = 0; i < ctx->num_other; i++) {
+        if (ctx->other[i].D.signum != 1) {
+            return ERR_BIGINT_BAD_INPUT_DATA;
+        }
+        exponents[i + 2] = &ctx->other[i].D;
+    }
 
-        big_sub(&p_minus_1, &ctx->P, &ONE);
-        big_sub(&q_minus_1, &ctx->Q, &ONE);
+    bigint R, VF, C, S;
+    big_init(&R);
+    big_init(&VF);
+    big_init(&C);
+    big_init(&S);
+
+    int err;
+    if ((err = rsa_blinding_value(ctx, &R, &VF)) == 0 &&
+        (err = rsa_public(ctx, &R, &C)) == 0 &&
+        (err = big_mul(&C, &C, in)) == 0 &&
+        (err = big_mod(&C, &C, &ctx->N)) == 0 &&
+        (err = rsa_crt_exp(ctx, &S, &C, exponents)) == 0 &&
+        (err = big_mul(&S, &S, &VF)) == 0) {
+        err = big_mod(out, &S, &ctx->N);
+    }
 
-        bigint totient;
-        big_init(&totient);
-        big_mul(&totient, &p_minus_1, &q_minus_1); 
+    big_free(&R);
+    big_free(&VF);
+    big_free(&C);
+    big_free(&S);
+    return err;
+}
 
-        bigint gcd;
-        big_init(&gcd);
-        big_gcd(&gcd, &ctx->E, &totient);
+// D = E^-1 mod (r - 1) for an odd E that is small next to r, found as
+// D = ((r - 1) * t + 1) / E with t = -(r - 1)^-1 mod E, so that only the
+// inverse mod the small, odd E is needed
+static int rsa_root_exponent(bigint *D, const bigint *E, const bigint *r) {
+    bigint one, R1, t;
+    big_init(&one);
+    big_init(&R1);
+    big_init(&t);
+
+    int err;
+    if ((err = big_set_nonzero(&one, 1)) == 0 &&
+        (err = big_sub(&R1, r, &one)) == 0 &&
+        (err = big_inv_mod(&t, &R1, E)) == 0 &&
+        (err = big_sub(&t, E, &t)) == 0 &&
+        (err = big_mul(D, &R1, &t)) == 0 &&
+        (err = big_add(D, D, &one)) == 0) {
+        err = big_divexact(D, D, E);
+    }
 
-        big_free(&totient);
+    big_free(&one);
+    big_free(&R1);
+    big_free(&t);
+    return err;
+}
 
-        if (big_cmp(&gcd, &ONE) != 0) {
-            big_free(&gcd);
-            continue; 
+// Inverts count values mod N in place with a single inversion
+// (Montgomery's trick): with the prefix products P_j = A_0 * ... * A_j,
+// A_j^-1 = P_j^-1 * P_(j-1) and P_(j-1)^-1 = P_j^-1 * A_j
+static int rsa_batch_inverse(const rsa_context *ctx, bigint *A,
+                             bigint *prefix, size_t count) {
+    bigint inv, T;
+    big_init(&inv);
+    big_init(&T);
+
+    int err = big_copy(&prefix[0], &A[0]);
+    for (size_t j = 1; err == 0 && j < count; j++) {
+        if ((err = big_mul(&prefix[j], &prefix[j - 1], &A[j])) == 0) {
+            err = big_mod(&prefix[j], &prefix[j], &ctx->N);
         }
+    }
+    if (err == 0) {
+        err = rsa_crt_inverse(ctx, &inv, &prefix[count - 1]);
+    }
+    for (size_t j = count - 1; err == 0 && j > 0; j--) {
+        if ((err = big_mul(&T, &inv, &prefix[j - 1])) == 0 &&
+            (err = big_mul(&inv, &inv, &A[j])) == 0 &&
+            (err = big_mod(&inv, &inv, &ctx->N)) == 0) {
+            err = big_mod(&A[j], &T, &ctx->N);
+        }
+    }
+    if (err == 0) {
+        err = big_copy(&A[0], &inv);
+    }
 
-        // LCM(p-1, q-1) = (p-1)(q-1) / (gcd(p-1, q-1))
-        big_gcd(&gcd, &p_minus_1, &q_minus_1);
-        bigint lcm;
-        big_init(&lcm);
-        big_mul(&lcm, &p_minus_1, &q_minus_1);
-        big_div(&lcm, NULL, &lcm, &gcd);
+    big_free(&inv);
+    big_free(&T);
+    return err;
+}
+
+/*
+ * Fiat's batch RSA. The leaves of a binary tree are the inputs m_i with
+ * their exponents e_i; each inner node joins its children a and b into
+ *   v = v_a^(E_b) * v_b^(E_a) mod N,  E = E_a * E_b,
+ * so that v^(1/E) = v_a^(1/E_a) * v_b^(1/E_b). One blinded CRT
+ * exponentiation takes the E-th root s of the top node, and the roots
+ * percolate down: with U = E_b^-1 mod E_a, X = E_b * U is 1 mod E_a and
+ * 0 mod E_b, so
+ *   s_a = s^X / (v_a^((X - 1) / E_a) * v_b^U) = num / den,
+ *   s_b = s / s_a = s * den / num,
+ * and the num and den of a whole level share one inversion. An odd node
+ * at the end of a level is carried up and down unchanged.
+ */
+int rsa_private_batch(rsa_context *ctx, const big_uint *exponents,
+                      const bigint *in, bigint *out, size_t count) {
+    if (count == 0 || !rsa_has_crt(ctx)) {
+        return ERR_BIGINT_BAD_INPUT_DATA;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (exponents[i] < 3 || (exponents[i] & 1) == 0 ||
+            in[i].signum != 1 || big_cmp(&in[i], &ctx->N) >= 0) {
+            return ERR_BIGINT_BAD_INPUT_DATA;
+        }
+    }
 
-        big_inv_mod(&ctx->D, &ctx->E, &lcm);
+    // Level k has width[k] nodes from offset[k] on; each level halves the
+    // one below, so a size_t count needs at most 65 levels
+    size_t width[65], offset[65], levels = 1, total = count;
+    width[0] = count;
+    offset[0] = 0;
+    while (width[levels - 1] > 1) {
+        width[levels] = (width[levels - 1] + 1) / 2;
+        offset[levels] = total;
+        total += width[levels];
+        levels++;
+    }
+    size_t top = total - 1;
+
+    // Values, exponent products, U (of inner nodes) and roots of the
+    // nodes, then the copies of num and den of a level, at most count,
+    // and their prefix products
+    bigint *V = malloc((4 * total + 2 * count) * sizeof(bigint));
+    if (V == NULL) {
+        return ERR_BIGINT_ALLOC_FAILED;
+    }
+    for (size_t i = 0; i < 4 * total + 2 * count; i++) {
+        big_init(&V[i]);
+    }
+    bigint *E = V + total, *U = E + total, *S = U + total;
+    bigint *frac = S + total, *prefix = frac + count;
+
+    bigint one, X, T, R, VF;
+    big_init(&one);
+    big_init(&X);
+    big_init(&T);
+    big_init(&R);
+    big_init(&VF);
+    bigint D[RSA_MAX_PRIMES];
+    const bigint *Dp[RSA_MAX_PRIMES];
+    for (size_t i = 0; i < RSA_MAX_PRIMES; i++) {
+        big_init(&D[i]);
+        Dp[i] = &D[i];
+    }
 
-        big_two_to_pwr(&pwr2, nbits / 2);
-        if (big_cmp(&ctx->D, &pwr2) != 1) {
-            continue;
+    // Up the tree
+    int err = big_set_nonzero(&one, 1);
+    for (size_t i = 0; err == 0 && i < count; i++) {
+        if ((err = big_copy(&V[i], &in[i])) == 0) {
+            err = big_set_nonzero(&E[i], exponents[i]);
+        }
+    }
+    for (size_t k = 0; err == 0 && k + 1 < levels; k++) {
+        for (size_t j = 0; err == 0 && j < width[k + 1]; j++) {
+            size_t a = offset[k] + 2 * j, b = a + 1, parent = offset[k + 1] + j;
+            if (2 * j + 1 == width[k]) {
+                if ((err = big_copy(&V[parent], &V[a])) == 0) {
+                    err = big_copy(&E[parent], &E[a]);
+                }
+                continue;
+            }
+            // Exponents with a common factor have no U
+            if ((err = big_inv_mod(&U[parent], &E[b], &E[a])) == 0 &&
+                (err = rsa_exp_mod_n(ctx, &V[parent], &V[a], &E[b])) == 0 &&
+                (err = rsa_exp_mod_n(ctx, &T, &V[b], &E[a])) == 0 &&
+                (err = big_mul(&V[parent], &V[parent], &T)) == 0 &&
+                (err = big_mod(&V[parent], &V[parent], &ctx->N)) == 0) {
+                err = big_mul(&E[parent], &E[a], &E[b]);
+            }
+        }
+    }
+
+    // The root of the top node, blinded as in rsa_private with R^E; E
+    // must be invertible mod r - 1 for every prime r
+    for (size_t i = 0; err == 0 && i < ctx->num_other + 2; i++) {
+        err = rsa_root_exponent(&D[i], &E[top], rsa_prime(ctx, i));
+    }
+    if (err == 0 &&
+        (err = rsa_blinding_value(ctx, &R, &VF)) == 0 &&
+        (err = rsa_exp_mod_n(ctx, &T, &R, &E[top])) == 0 &&
+        (err = big_mul(&T, &T, &V[top])) == 0 &&
+        (err = big_mod(&T, &T, &ctx->N)) == 0 &&
+        (err = rsa_crt_exp(ctx, &S[top], &T, Dp)) == 0 &&
+        (err = big_mul(&S[top], &S[top], &VF)) == 0) {
+        err = big_mod(&S[top], &S[top], &ctx->N);
+    }
+
+    // Down the tree, from the pairs of children of level k: num and den
+    // go to S of the children and are inverted as a whole in frac
+    for (size_t k = levels - 1; err == 0 && k > 0; k--) {
+        size_t pairs = width[k - 1] / 2;
+        for (size_t j = 0; err == 0 && j < pairs; j++) {
+            size_t a = offset[k - 1] + 2 * j, b = a + 1, parent = offset[k] + j;
+            if ((err = big_mul(&X, &E[b], &U[parent])) == 0 &&
+                (err = rsa_exp_mod_n(ctx, &S[a], &S[parent], &X)) == 0 &&
+                (err = big_sub(&X, &X, &one)) == 0 &&
+                (err = big_divexact(&X, &X, &E[a])) == 0 &&
+                (err = rsa_exp_mod_n(ctx, &S[b], &V[a], &X)) == 0 &&
+                (err = rsa_exp_mod_n(ctx, &T, &V[b], &U[parent])) == 0 &&
+                (err = big_mul(&S[b], &S[b], &T)) == 0 &&
+                (err = big_mod(&S[b], &S[b], &ctx->N)) == 0 &&
+                (err = big_copy(&frac[2 * j], &S[a])) == 0) {
+                err = big_copy(&frac[2 * j + 1], &S[b]);
+            }
         }
+        if (err == 0 && pairs > 0) {
+            err = rsa_batch_inverse(ctx, frac, prefix, 2 * pairs);
+        }
+        for (size_t j = 0; err == 0 && j < pairs; j++) {
+            size_t a = offset[k - 1] + 2 * j, b = a + 1, parent = offset[k] + j;
+            if ((err = big_mul(&S[a], &S[a], &frac[2 * j + 1])) == 0 &&
+                (err = big_mod(&S[a], &S[a], &ctx->N)) == 0 &&
+                (err = big_mul(&S[b], &S[b], &S[parent])) == 0 &&
+                (err = big_mod(&S[b], &S[b], &ctx->N)) == 0 &&
+                (err = big_mul(&S[b], &S[b], &frac[2 * j])) == 0) {
+                err = big_mod(&S[b], &S[b], &ctx->N);
+            }
+        }
+        if (err == 0 && width[k - 1] % 2 == 1) {
+            err = big_copy(&S[offset[k] - 1], &S[offset[k] + width[k] - 1]);
+        }
+    }
+    for (size_t i = 0; err == 0 && i < count; i++) {
+        err = big_copy(&out[i], &S[i]);
+    }
+    // A missing inverse means shared exponent factors, an exponent that
+    // is not coprime to some r - 1 or an input that is not coprime to N
+    if (err == ERR_BIGINT_NOT_ACCEPTABLE) {
+        err = ERR_BIGINT_BAD_INPUT_DATA;
+    }
 
-        big_mod(&ctx->DP, &ctx->D, &p_minus_1);
-        big_mod(&ctx->DQ, &ctx->D, &q_minus_1);
-        big_inv_mod(&ctx->QP, &ctx->Q, &ctx->P);
+    for (size_t i = 0; i < 4 * total + 2 * count; i++) {
+        big_free(&V[i]);
     }
-    return 0;
+    free(V);
+    big_free(&one);
+    big_free(&X);
+    big_free(&T);
+    big_free(&R);
+    big_free(&VF);
+    for (size_t i = 0; i < RSA_MAX_PRIMES; i++) {
+        big_free(&D[i]);
+    }
+    return err;
 }
 
-int rsa_write_public_key(const rsa_context *ctx, FILE *file) {
-    // (length = 7, 'ssh-rsa', len(e), e, len(n), n)
-    
-    // allocate uint8_t * buffer to hold all this
-    // encode it in base 64 -> string
-    // concat it with "ssh-rsa " in human readable format
-    // write this all to `file`
-    size_t size = 3 * sizeof(uint64_t);
-    size_t e_len_bits = big_bitlen(&ctx->E);
-    size_t n_len_bits = big_bitlen(&ctx->N);
+// Pairwise consistency check of a new key (FIPS 140-3 IG 10.3.A): a random
+// message signed with the private key must come back under E
+static int rsa_check_pairwise(rsa_context *ctx) {
+    bigint M, S, V;
+    big_init(&M);
+    big_init(&S);
+    big_init(&V);
+
+    int err;
+    if ((err = big_fill_random(&M, ctx->len)) == 0 &&
+        (err = big_mod(&M, &M, &ctx->N)) == 0 &&
+        (err = rsa_private(ctx, &M, &S)) == 0 &&
+        (err = rsa_public(ctx, &S, &V)) == 0 &&
+        big_cmp(&V, &M) != 0) {
+        err = RSA_KEY_CHECK_ERROR;
+    }
+
+    big_free(&M);
+    big_free(&S);
+    big_free(&V);
+    return err;
+}
+
+// One prime factor searched on its own thread
+typedef struct {
+    bigint *X;
+    size_t nbits;
+    const big_prime_ctx *prime_ctx;
+    int err;
+    int seeded;                    /*!<  continue a deterministic stream */
+    uint8_t seed[DRBG_KEY_SIZE];
+} rsa_prime_job;
+
+static void *rsa_prime_job_run(void *arg) {
+    rsa_prime_job *job = arg;
+    job->err = big_gen_prime_ctx(job->X, job->nbits, job->prime_ctx);
+    return NULL;
+}
+
+static void *rsa_prime_thread_run(void *arg) {
+    rsa_prime_job *job = arg;
+    if (job->seeded) {
+        drbg_thread_seed(job->seed);
+    }
+    return rsa_prime_job_run(job);
+}
+
+/*
+ * Generates the primes with gcd(r - 1, E) = 1 built into the prime search,
+ * so the coprimality of E and the totient never has to be checked
+ * afterwards. The searches are independent, so every prime but the last
+ * is drawn on a thread of its own while the caller draws the last one.
+ * When a later check fails, only the prime at fault is regenerated; the
+ * others and every buffer are kept.
+ */
+int rsa_gen_key_multi(rsa_context *ctx, size_t nbits, size_t nprimes,
+                      big_uint exponent) {
+    if (nprimes < 2 || nprimes > RSA_MAX_PRIMES || nbits / nprimes < 64 ||
+        exponent < 3 || (exponent & 1) == 0) {
+        return ERR_BIGINT_BAD_INPUT_DATA;
+    }
+
+    bigint ONE, R1, G, L, T;
+    big_init(&ONE);
+    big_init(&R1);
+    big_init(&G);
+    big_init(&L);
+    big_init(&T);
+
+    big_prime_ctx prime_ctx;
+    big_prime_ctx_init(&prime_ctx);
+    prime_ctx.e = exponent;
+
+    // P, Q and the other primes in order; the first nbits % nprimes of
+    // them get one bit more
+    ctx->ver = nprimes > 2;
+    ctx->num_other = nprimes - 2;
+    bigint *primes[RSA_MAX_PRIMES] = {&ctx->P, &ctx->Q};
+    size_t bits[RSA_MAX_PRIMES];
+    for (size_t i = 0; i < nprimes; i++) {
+        if (i >= 2) {
+            primes[i] = &ctx->other[i - 2].R;
+        }
+        bits[i] = nbits / nprimes + (i < nbits % nprimes);
+    }
+    size_t last = nprimes - 1;
 
-    size_t e_len_bytes = e_len_bits / 8 + (e_len_bits % 8 == 0 ? 0 : 1);
-    size_t n_len_bytes = n_len_bits / 8 + (n_len_bits % 8 == 0 ? 0 : 1);
+    int err = big_set_nonzero(&ONE, 1);
+    if (err == 0) {
+        err = big_set_nonzero(&ctx->E, exponent);
+    }
+    if (err == 0) {
+        // Without a thread, a prime is simply drawn in turn
+        rsa_prime_job jobs[RSA_MAX_PRIMES - 1];
+        pthread_t threads[RSA_MAX_PRIMES - 1];
+        bool threaded[RSA_MAX_PRIMES - 1];
+        for (size_t i = 0; i < last; i++) {
+            jobs[i] = (rsa_prime_job){.X = primes[i], .nbits = bits[i],
+                                      .prime_ctx = &prime_ctx};
+            jobs[i].seeded = drbg_thread_derive_seed(jobs[i].seed);
+            threaded[i] = pthread_create(&threads[i], NULL, rsa_prime_thread_run,
+                                         &jobs[i]) == 0;
+            if (!threaded[i]) {
+                rsa_prime_job_run(&jobs[i]);
+            }
+        }
+        err = big_gen_prime_ctx(primes[last], bits[last], &prime_ctx);
+        for (size_t i = 0; i < last; i++) {
+            if (threaded[i]) {
+                pthread_join(threads[i], NULL);
+            }
+            if (err == 0) {
+                err = jobs[i].err;
+            }
+        }
+    }
 
-    size += e_len_bytes + n_len_bytes;
-    size += 7; // ssh-rsa
+    size_t min_diff_bits = bits[last] > 100 ? bits[last] - 100 : 0;
+    size_t redo = last;
+    bool complete = false;
+    for (bool fresh = true; err == 0 && !complete; fresh = false) {
+        if (!fresh) {
+            err = big_gen_prime_ctx(primes[redo], bits[redo], &prime_ctx);
+            if (err != 0) {
+                break;
+            }
+        }
+        redo = last;
+
+        // |r_i - r_j| > 2^(nbits / nprimes - 100) for every pair (FIPS
+        // 186-5 A.1.3 for two primes); the later prime is retried
+        bool close = false;
+        for (size_t j = 1; err == 0 && !close && j < nprimes; j++) {
+            for (size_t i = 0; err == 0 && !close && i < j; i++) {
+                if ((err = big_sub(&T, primes[i], primes[j])) == 0 &&
+                    big_bitlen(&T) <= min_diff_bits) {
+                    close = true;
+                    redo = j;
+                }
+            }
+        }
+        if (err != 0) {
+            break;
+        }
+        if (close) {
+            continue;
+        }
 
-    uint8_t *buf = calloc(size, sizeof(uint8_t));
+        // N must have exactly nbits bits; retry the smallest prime, which
+        // is the one that brought the product short. With three or more
+        // primes the others may be too small for any prime of its size
+        // to make up the difference (N / r has fewer than nbits - bits
+        // bits); the smallest prime that can still do it goes instead,
+        // or, if there is none, the smallest after all.
+        if ((err = big_mul(&ctx->N, primes[0], primes[1])) != 0) {
+            break;
+        }
+        for (size_t i = 2; err == 0 && i < nprimes; i++) {
+            err = big_mul(&ctx->N, &ctx->N, primes[i]);
+        }
+        if (err != 0) {
+            break;
+        }
+        if (big_bitlen(&ctx->N) != nbits) {
+            size_t smallest = 0;
+            redo = nprimes;
+            for (size_t i = 0; err == 0 && i < nprimes; i++) {
+                if (big_cmp(primes[i], primes[smallest]) <= 0) {
+                    smallest = i;
+                }
+                if ((err = big_divexact(&T, &ctx->N, primes[i])) == 0 &&
+                    big_bitlen(&T) + bits[i] >= nbits &&
+                    (redo == nprimes || big_cmp(primes[i], primes[redo]) <= 0)) {
+                    redo = i;
+                }
+            }
+            if (redo == nprimes) {
+                redo = smallest;
+            }
+            continue;
+        }
 
-    // set first 8 bytes to 0x07
-    uint64_t *first_buf = (uint64_t *)buf; 
-    *first_buf = 7;
+        // D = E^-1 mod L, L = LCM(r_1 - 1, ..., r_k - 1), built up as
+        // LCM(L, r - 1) = L / gcd(L, r - 1) * (r - 1), where the gcd
+        // divides L, so this is an exact division
+        err = big_sub(&L, primes[0], &ONE);
+        for (size_t i = 1; err == 0 && i < nprimes; i++) {
+            if ((err = big_sub(&R1, primes[i], &ONE)) == 0 &&
+                (err = big_gcd(&G, &L, &R1)) == 0 &&
+                (err = big_divexact(&L, &L, &G)) == 0) {
+                err = big_mul(&L, &L, &R1);
+            }
+        }
+        if (err != 0 || (err = big_inv_mod(&ctx->D, &ctx->E, &L)) != 0) {
+            break;
+        }
 
-    // set next 7 bytes to 'ssh-rsa' in ASCII
-    char *str = (char *)(&buf[8]);
-    strcpy(str, "ssh-rsa");
+        // D > 2^(nbits / 2) (FIPS 186-5 A.1.1); practically never fails
+        if (big_bitlen(&ctx->D) <= nbits / 2) {
+            continue;
+        }
 
-    uint64_t *second_len = (uint64_t *)(&buf[7 + 8]); 
-    *second_len = e_len_bytes;
+        if ((err = big_sub(&R1, &ctx->P, &ONE)) != 0 ||
+            (err = big_mod(&ctx->DP, &ctx->D, &R1)) != 0 ||
+            (err = big_sub(&R1, &ctx->Q, &ONE)) != 0 ||
+            (err = big_mod(&ctx->DQ, &ctx->D, &R1)) != 0 ||
+            (err = big_inv_mod(&ctx->QP, &ctx->Q, &ctx->P)) != 0) {
+            break;
+        }
 
-    uint8_t *e_buf = &buf[7 + 8 + 8];
-    big_write_binary(&ctx->E, buf, e_len_bytes);
+        // The other primes: D_r = D mod (r - 1), T_r = 1 / (P * Q * ...) mod r
+        // over the primes before r
+        if (nprimes > 2) {
+            err = big_mul(&T, &ctx->P, &ctx->Q);
+        }
+        for (size_t i = 0; err == 0 && i < ctx->num_other; i++) {
+            rsa_prime_info *info = &ctx->other[i];
+            if ((err = big_sub(&R1, &info->R, &ONE)) == 0 &&
+                (err = big_mod(&info->D, &ctx->D, &R1)) == 0 &&
+                (err = big_inv_mod(&info->T, &T, &info->R)) == 0) {
+                err = big_mul(&T, &T, &info->R);
+            }
+        }
+        if (err != 0) {
+            break;
+        }
+        ctx->len = (nbits + 7) / 8;
+        ctx->deterministic = drbg_thread_is_deterministic();
+        complete = true;
+    }
+    if (err == 0) {
+        err = rsa_precompute(ctx);
+    }
+    if (err == 0) {
+        err = rsa_check_pairwise(ctx);
+    }
 
-    uint64_t *third_len = (uint64_t *)(&buf[7 + 8 + 8 + e_len_bytes]); 
-    *third_len = n_len_bytes;
+    big_free(&ONE);
+    big_free(&R1);
+    big_free(&G);
+    big_free(&L);
+    big_free(&T);
+    return err;
+}
 
-    uint8_t *n_buf = (uint8_t *)(&buf[7 + 8 + 8 + e_len_bytes + 8]); 
-    big_write_binary(&ctx->N, buf, n_len_bytes);
+int rsa_gen_key(rsa_context *ctx, size_t nbits, big_uint exponent) {
+    return rsa_gen_key_multi(ctx, nbits, 2, exponent);
+}
 
-    size_t olen;
-    char base64out[256];
-    base64_encode(base64out, 256, &olen, buf, size);
+// Appends the 32-bit big-endian length prefix of an SSH string or mpint
+// (RFC 4253 Section 5); buffer may be NULL to only advance the index
+static void write_ssh_length(size_t length, uint8_t *buffer, size_t *index) {
+    if (buffer != NULL) {
+        for (int i = 0; i < 4; i++) {
+            buffer[*index + i] = (uint8_t)(length >> (8 * (3 - i)));
+        }
+    }
+    *index += 4;
+}
 
-    fwrite("ssh-rsa ", strlen("ssh-rsa") - 1, 1, file);
-    fwrite(base64out, olen, 1, file);
+static void write_ssh_string(const char *s, uint8_t *buffer, size_t *index) {
+    size_t length = strlen(s);
+    write_ssh_length(length, buffer, index);
+    if (buffer != NULL) {
+        memcpy(&buffer[*index], s, length);
+    }
+    *index += length;
+}
 
+// A non-negative mpint gets a leading zero byte when its top bit is set,
+// and zero has no bytes at all
+static int write_ssh_mpint(const bigint *x, uint8_t *buffer, size_t *index) {
+    size_t length = big_size(x);
+    size_t pad = length != 0 && big_bitlen(x) % 8 == 0;
+    write_ssh_length(pad + length, buffer, index);
+    if (buffer != NULL) {
+        if (pad) {
+            buffer[*index] = 0;
+        }
+        int err = big_write_binary(x, &buffer[*index + pad], length);
+        if (err != 0) {
+            return err;
+        }
+    }
+    *index += pad + length;
     return 0;
 }
+
+int rsa_write_public_key(const rsa_context *ctx, FILE *file) {
+    // "ssh-rsa " followed by the base64 of (string "ssh-rsa", mpint e,
+    // mpint n), measured first and then written into one buffer
+    size_t size = 0;
+    write_ssh_string("ssh-rsa", NULL, &size);
+    write_ssh_mpint(&ctx->E, NULL, &size);
+    write_ssh_mpint(&ctx->N, NULL, &size);
+
+    uint8_t *buf = malloc(size);
+    if (buf == NULL) {
+        return RSA_KEY_WRITE_ERROR;
+    }
+    size_t index = 0;
+    write_ssh_string("ssh-rsa", buf, &index);
+    int err = write_ssh_mpint(&ctx->E, buf, &index);
+    if (err == 0) {
+        err = write_ssh_mpint(&ctx->N, buf, &index);
+    }
+
+    size_t olen = base64_size(size);
+    unsigned char *base64out = malloc(olen);
+    if (err != 0 || base64out == NULL ||
+        base64_encode(base64out, olen, &olen, buf, size) != 0) {
+        free(buf);
+        free(base64out);
+        return RSA_KEY_WRITE_ERROR;
+    }
+
+    // The comment field marks keys from a seeded test RNG
+    int result = fputs("ssh-rsa ", file) < 0 ||
+                 fwrite(base64out, 1, olen, file) != olen ||
+                 (ctx->deterministic && fputs(" " RSA_DETERMINISTIC_COMMENT, file) < 0) ||
+                 fputc('\n', file) < 0 ? RSA_KEY_WRITE_ERROR : 0;
+    free(buf);
+    free(base64out);
+    return result;
+}
@@ -39,19 +39,59 @@ void write_asn_length(size_t length, uint8_t *buffer, size_t *index) {
 }
 
 void write_asn_integer(const bigint *x, uint8_t *buffer, size_t *index) {
+    // DER integers are two's complement: a value with its top bit set
+    // needs a leading zero byte, and zero is a single zero byte
     size_t length = big_size(x);
+    size_t pad = length == 0 || big_bitlen(x) % 8 == 0;
     if (buffer != NULL) buffer[*index] = INTEGER_TAG;
     (*index)++;
-    write_asn_length(length, buffer, index);
+    write_asn_length(pad + length, buffer, index);
     if (buffer != NULL) {
-        int result = big_write_binary(x, &buffer[*index], length);
+        if (pad) buffer[*index] = 0;
+        int result = big_write_binary(x, &buffer[*index + pad], length);
         assert(result == 0);
     }
-    *index += length;
+    *index += pad + length;
+}
+
+// Tag and length of a SEQUENCE with contents_length bytes of contents
+static void write_asn_sequence(size_t contents_length, uint8_t *buffer, size_t *index) {
+    if (buffer != NULL) buffer[*index] = SEQUENCE_TAG;
+    (*index)++;
+    write_asn_length(contents_length, buffer, index);
+}
+
+static size_t other_prime_info_length(const rsa_prime_info *info) {
+    size_t length = 0;
+    write_asn_integer(&info->R, NULL, &length);
+    write_asn_integer(&info->D, NULL, &length);
+    write_asn_integer(&info->T, NULL, &length);
+    return length;
+}
+
+// otherPrimeInfos (RFC 8017 Appendix A.1.2): a SEQUENCE of
+// OtherPrimeInfo ::= SEQUENCE { prime, exponent, coefficient }
+static void write_asn_other_primes(const rsa_context *rsa, uint8_t *buffer, size_t *index) {
+    size_t infos_length = 0;
+    for (size_t i = 0; i < rsa->num_other; i++) {
+        size_t length = other_prime_info_length(&rsa->other[i]);
+        write_asn_sequence(length, NULL, &infos_length);
+        infos_length += length;
+    }
+    write_asn_sequence(infos_length, buffer, index);
+    for (size_t i = 0; i < rsa->num_other; i++) {
+        write_asn_sequence(other_prime_info_length(&rsa->other[i]), buffer, index);
+        write_asn_integer(&rsa->other[i].R, buffer, index);
+        write_asn_integer(&rsa->other[i].D, buffer, index);
+        write_asn_integer(&rsa->other[i].T, buffer, index);
+    }
 }
 
 int rsa_write_private_key(const rsa_context *rsa, FILE *file) {
+    // Version 1 announces the otherPrimeInfos of a multi-prime key
     bigint version = BIG_VERSION;
+    if (rsa->ver != 0 && big_set_nonzero(&version, rsa->ver) != 0)
+        return RSA_KEY_WRITE_ERROR;
     size_t sequence_length = 0;
     write_asn_integer(&version, NULL, &sequence_length);
     write_asn_integer(&rsa->N, NULL, &sequence_length);
@@ -62,6 +102,8 @@ int rsa_write_private_key(const rsa_context *rsa, FILE *file) {
     write_asn_integer(&rsa->DP, NULL, &sequence_length);
     write_asn_integer(&rsa->DQ, NULL, &sequence_length);
     write_asn_integer(&rsa->QP, NULL, &sequence_length);
+    if (rsa->num_other > 0)
+        write_asn_other_primes(rsa, NULL, &sequence_length);
     size_t contents_length = 1;
     write_asn_length(sequence_length, NULL, &contents_length);
     uint8_t contents[contents_length + sequence_length];
@@ -77,6 +119,8 @@ int rsa_write_private_key(const rsa_context *rsa, FILE *file) {
     write_asn_integer(&rsa->DP, contents, &contents_index);
     write_asn_integer(&rsa->DQ, contents, &contents_index);
     write_asn_integer(&rsa->QP, contents, &contents_index);
+    if (rsa->num_other > 0)
+        write_asn_other_primes(rsa, contents, &contents_index);
     big_free(&version);
 
     uint8_t base64_encoded[base64_size(sizeof(contents))];
@@ -88,6 +132,9 @@ int rsa_write_private_key(const rsa_context *rsa, FILE *file) {
     );
     assert(result == 0);
     size_t base64_length = sizeof(base64_encoded) - 1;
+    // PEM readers skip text before the header line
+    if (rsa->deterministic && fputs(RSA_DETERMINISTIC_WARNING, file) < 0)
+        return RSA_KEY_WRITE_ERROR;
     if (fputs(PRIVATE_KEY_HEADER, file) < 0)
         return RSA_KEY_WRITE_ERROR;
 
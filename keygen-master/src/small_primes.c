@@ -0,0 +1,2847 @@
+/* Generated by tests/generate_small_primes.py; do not edit. */
+#include "small_primes.h"
+
+const uint16_t SMALL_PRIMES[NUM_SMALL_PRIMES] = {
+        3,     5,     7,    11,    13,    17,    19,    23,    29,    31,    37,    41,
+       43,    47,    53,    59,    61,    67,    71,    73,    79,    83,    89,    97,
+      101,   103,   107,   109,   113,   127,   131,   137,   139,   149,   151,   157,
+      163,   167,   173,   179,   181,   191,   193,   197,   199,   211,   223,   227,
+      229,   233,   239,   241,   251,   257,   263,   269,   271,   277,   281,   283,
+      293,   307,   311,   313,   317,   331,   337,   347,   349,   353,   359,   367,
+      373,   379,   383,   389,   397,   401,   409,   419,   421,   431,   433,   439,
+      443,   449,   457,   461,   463,   467,   479,   487,   491,   499,   503,   509,
+      521,   523,   541,   547,   557,   563,   569,   571,   577,   587,   593,   599,
+      601,   607,   613,   617,   619,   631,   641,   643,   647,   653,   659,   661,
+      673,   677,   683,   691,   701,   709,   719,   727,   733,   739,   743,   751,
+      757,   761,   769,   773,   787,   797,   809,   811,   821,   823,   827,   829,
+      839,   853,   857,   859,   863,   877,   881,   883,   887,   907,   911,   919,
+      929,   937,   941,   947,   953,   967,   971,   977,   983,   991,   997,  1009,
+     1013,  1019,  1021,  1031,  1033,  1039,  1049,  1051,  1061,  1063,  1069,  1087,
+     1091,  1093,  1097,  1103,  1109,  1117,  1123,  1129,  1151,  1153,  1163,  1171,
+     1181,  1187,  1193,  1201,  1213,  1217,  1223,  1229,  1231,  1237,  1249,  1259,
+     1277,  1279,  1283,  1289,  1291,  1297,  1301,  1303,  1307,  1319,  1321,  1327,
+     1361,  1367,  1373,  1381,  1399,  1409,  1423,  1427,  1429,  1433,  1439,  1447,
+     1451,  1453,  1459,  1471,  1481,  1483,  1487,  1489,  1493,  1499,  1511,  1523,
+     1531,  1543,  1549,  1553,  1559,  1567,  1571,  1579,  1583,  1597,  1601,  1607,
+     1609,  1613,  1619,  1621,  1627,  1637,  1657,  1663,  1667,  1669,  1693,  1697,
+     1699,  1709,  1721,  1723,  1733,  1741,  1747,  1753,  1759,  1777,  1783,  1787,
+     1789,  1801,  1811,  1823,  1831,  1847,  1861,  1867,  1871,  1873,  1877,  1879,
+     1889,  1901,  1907,  1913,  1931,  1933,  1949,  1951,  1973,  1979,  1987,  1993,
+     1997,  1999,  2003,  2011,  2017,  2027,  2029,  2039,  2053,  2063,  2069,  2081,
+     2083,  2087,  2089,  2099,  2111,  2113,  2129,  2131,  2137,  2141,  2143,  2153,
+     2161,  2179,  2203,  2207,  2213,  2221,  2237,  2239,  2243,  2251,  2267,  2269,
+     2273,  2281,  2287,  2293,  2297,  2309,  2311,  2333,  2339,  2341,  2347,  2351,
+     2357,  2371,  2377,  2381,  2383,  2389,  2393,  2399,  2411,  2417,  2423,  2437,
+     2441,  2447,  2459,  2467,  2473,  2477,  2503,  2521,  2531,  2539,  2543,  2549,
+     2551,  2557,  2579,  2591,  2593,  2609,  2617,  2621,  2633,  2647,  2657,  2659,
+     2663,  2671,  2677,  2683,  2687,  2689,  2693,  2699,  2707,  2711,  2713,  2719,
+     2729,  2731,  2741,  2749,  2753,  2767,  2777,  2789,  2791,  2797,  2801,  2803,
+     2819,  2833,  2837,  2843,  2851,  2857,  2861,  2879,  2887,  2897,  2903,  2909,
+     2917,  2927,  2939,  2953,  2957,  2963,  2969,  2971,  2999,  3001,  3011,  3019,
+     3023,  3037,  3041,  3049,  3061,  3067,  3079,  3083,  3089,  3109,  3119,  3121,
+     3137,  3163,  3167,  3169,  3181,  3187,  3191,  3203,  3209,  3217,  3221,  3229,
+     3251,  3253,  3257,  3259,  3271,  3299,  3301,  3307,  3313,  3319,  3323,  3329,
+     3331,  3343,  3347,  3359,  3361,  3371,  3373,  3389,  3391,  3407,  3413,  3433,
+     3449,  3457,  3461,  3463,  3467,  3469,  3491,  3499,  3511,  3517,  3527,  3529,
+     3533,  3539,  3541,  3547,  3557,  3559,  3571,  3581,  3583,  3593,  3607,  3613,
+     3617,  3623,  3631,  3637,  3643,  3659,  3671,  3673,  3677,  3691,  3697,  3701,
+     3709,  3719,  3727,  3733,  3739,  3761,  3767,  3769,  3779,  3793,  3797,  3803,
+     3821,  3823,  3833,  3847,  3851,  3853,  3863,  3877,  3881,  3889,  3907,  3911,
+     3917,  3919,  3923,  3929,  3931,  3943,  3947,  3967,  3989,  4001,  4003,  4007,
+     4013,  4019,  4021,  4027,  4049,  4051,  4057,  4073,  4079,  4091,  4093,  4099,
+     4111,  4127,  4129,  4133,  4139,  4153,  4157,  4159,  4177,  4201,  4211,  4217,
+     4219,  4229,  4231,  4241,  4243,  4253,  4259,  4261,  4271,  4273,  4283,  4289,
+     4297,  4327,  4337,  4339,  4349,  4357,  4363,  4373,  4391,  4397,  4409,  4421,
+     4423,  4441,  4447,  4451,  4457,  4463,  4481,  4483,  4493,  4507,  4513,  4517,
+     4519,  4523,  4547,  4549,  4561,  4567,  4583,  4591,  4597,  4603,  4621,  4637,
+     4639,  4643,  4649,  4651,  4657,  4663,  4673,  4679,  4691,  4703,  4721,  4723,
+     4729,  4733,  4751,  4759,  4783,  4787,  4789,  4793,  4799,  4801,  4813,  4817,
+     4831,  4861,  4871,  4877,  4889,  4903,  4909,  4919,  4931,  4933,  4937,  4943,
+     4951,  4957,  4967,  4969,  4973,  4987,  4993,  4999,  5003,  5009,  5011,  5021,
+     5023,  5039,  5051,  5059,  5077,  5081,  5087,  5099,  5101,  5107,  5113,  5119,
+     5147,  5153,  5167,  5171,  5179,  5189,  5197,  5209,  5227,  5231,  5233,  5237,
+     5261,  5273,  5279,  5281,  5297,  5303,  5309,  5323,  5333,  5347,  5351,  5381,
+     5387,  5393,  5399,  5407,  5413,  5417,  5419,  5431,  5437,  5441,  5443,  5449,
+     5471,  5477,  5479,  5483,  5501,  5503,  5507,  5519,  5521,  5527,  5531,  5557,
+     5563,  5569,  5573,  5581,  5591,  5623,  5639,  5641,  5647,  5651,  5653,  5657,
+     5659,  5669,  5683,  5689,  5693,  5701,  5711,  5717,  5737,  5741,  5743,  5749,
+     5779,  5783,  5791,  5801,  5807,  5813,  5821,  5827,  5839,  5843,  5849,  5851,
+     5857,  5861,  5867,  5869,  5879,  5881,  5897,  5903,  5923,  5927,  5939,  5953,
+     5981,  5987,  6007,  6011,  6029,  6037,  6043,  6047,  6053,  6067,  6073,  6079,
+     6089,  6091,  6101,  6113,  6121,  6131,  6133,  6143,  6151,  6163,  6173,  6197,
+     6199,  6203,  6211,  6217,  6221,  6229,  6247,  6257,  6263,  6269,  6271,  6277,
+     6287,  6299,  6301,  6311,  6317,  6323,  6329,  6337,  6343,  6353,  6359,  6361,
+     6367,  6373,  6379,  6389,  6397,  6421,  6427,  6449,  6451,  6469,  6473,  6481,
+     6491,  6521,  6529,  6547,  6551,  6553,  6563,  6569,  6571,  6577,  6581,  6599,
+     6607,  6619,  6637,  6653,  6659,  6661,  6673,  6679,  6689,  6691,  6701,  6703,
+     6709,  6719,  6733,  6737,  6761,  6763,  6779,  6781,  6791,  6793,  6803,  6823,
+     6827,  6829,  6833,  6841,  6857,  6863,  6869,  6871,  6883,  6899,  6907,  6911,
+     6917,  6947,  6949,  6959,  6961,  6967,  6971,  6977,  6983,  6991,  6997,  7001,
+     7013,  7019,  7027,  7039,  7043,  7057,  7069,  7079,  7103,  7109,  7121,  7127,
+     7129,  7151,  7159,  7177,  7187,  7193,  7207,  7211,  7213,  7219,  7229,  7237,
+     7243,  7247,  7253,  7283,  7297,  7307,  7309,  7321,  7331,  7333,  7349,  7351,
+     7369,  7393,  7411,  7417,  7433,  7451,  7457,  7459,  7477,  7481,  7487,  7489,
+     7499,  7507,  7517,  7523,  7529,  7537,  7541,  7547,  7549,  7559,  7561,  7573,
+     7577,  7583,  7589,  7591,  7603,  7607,  7621,  7639,  7643,  7649,  7669,  7673,
+     7681,  7687,  7691,  7699,  7703,  7717,  7723,  7727,  7741,  7753,  7757,  7759,
+     7789,  7793,  7817,  7823,  7829,  7841,  7853,  7867,  7873,  7877,  7879,  7883,
+     7901,  7907,  7919,  7927,  7933,  7937,  7949,  7951,  7963,  7993,  8009,  8011,
+     8017,  8039,  8053,  8059,  8069,  8081,  8087,  8089,  8093,  8101,  8111,  8117,
+     8123,  8147,  8161,  8167,  8171,  8179,  8191,  8209,  8219,  8221,  8231,  8233,
+     8237,  8243,  8263,  8269,  8273,  8287,  8291,  8293,  8297,  8311,  8317,  8329,
+     8353,  8363,  8369,  8377,  8387,  8389,  8419,  8423,  8429,  8431,  8443,  8447,
+     8461,  8467,  8501,  8513,  8521,  8527,  8537,  8539,  8543,  8563,  8573,  8581,
+     8597,  8599,  8609,  8623,  8627,  8629,  8641,  8647,  8663,  8669,  8677,  8681,
+     8689,  8693,  8699,  8707,  8713,  8719,  8731,  8737,  8741,  8747,  8753,  8761,
+     8779,  8783,  8803,  8807,  8819,  8821,  8831,  8837,  8839,  8849,  8861,  8863,
+     8867,  8887,  8893,  8923,  8929,  8933,  8941,  8951,  8963,  8969,  8971,  8999,
+     9001,  9007,  9011,  9013,  9029,  9041,  9043,  9049,  9059,  9067,  9091,  9103,
+     9109,  9127,  9133,  9137,  9151,  9157,  9161,  9173,  9181,  9187,  9199,  9203,
+     9209,  9221,  9227,  9239,  9241,  9257,  9277,  9281,  9283,  9293,  9311,  9319,
+     9323,  9337,  9341,  9343,  9349,  9371,  9377,  9391,  9397,  9403,  9413,  9419,
+     9421,  9431,  9433,  9437,  9439,  9461,  9463,  9467,  9473,  9479,  9491,  9497,
+     9511,  9521,  9533,  9539,  9547,  9551,  9587,  9601,  9613,  9619,  9623,  9629,
+     9631,  9643,  9649,  9661,  9677,  9679,  9689,  9697,  9719,  9721,  9733,  9739,
+     9743,  9749,  9767,  9769,  9781,  9787,  9791,  9803,  9811,  9817,  9829,  9833,
+     9839,  9851,  9857,  9859,  9871,  9883,  9887,  9901,  9907,  9923,  9929,  9931,
+     9941,  9949,  9967,  9973, 10007, 10009, 10037, 10039, 10061, 10067, 10069, 10079,
+    10091, 10093, 10099, 10103, 10111, 10133, 10139, 10141, 10151, 10159, 10163, 10169,
+    10177, 10181, 10193, 10211, 10223, 10243, 10247, 10253, 10259, 10267, 10271, 10273,
+    10289, 10301, 10303, 10313, 10321, 10331, 10333, 10337, 10343, 10357, 10369, 10391,
+    10399, 10427, 10429, 10433, 10453, 10457, 10459, 10463, 10477, 10487, 10499, 10501,
+    10513, 10529, 10531, 10559, 10567, 10589, 10597, 10601, 10607, 10613, 10627, 10631,
+    10639, 10651, 10657, 10663, 10667, 10687, 10691, 10709, 10711, 10723, 10729, 10733,
+    10739, 10753, 10771, 10781, 10789, 10799, 10831, 10837, 10847, 10853, 10859, 10861,
+    10867, 10883, 10889, 10891, 10903, 10909, 10937, 10939, 10949, 10957, 10973, 10979,
+    10987, 10993, 11003, 11027, 11047, 11057, 11059, 11069, 11071, 11083, 11087, 11093,
+    11113, 11117, 11119, 11131, 11149, 11159, 11161, 11171, 11173, 11177, 11197, 11213,
+    11239, 11243, 11251, 11257, 11261, 11273, 11279, 11287, 11299, 11311, 11317, 11321,
+    11329, 11351, 11353, 11369, 11383, 11393, 11399, 11411, 11423, 11437, 11443, 11447,
+    11467, 11471, 11483, 11489, 11491, 11497, 11503, 11519, 11527, 11549, 11551, 11579,
+    11587, 11593, 11597, 11617, 11621, 11633, 11657, 11677, 11681, 11689, 11699, 11701,
+    11717, 11719, 11731, 11743, 11777, 11779, 11783, 11789, 11801, 11807, 11813, 11821,
+    11827, 11831, 11833, 11839, 11863, 11867, 11887, 11897, 11903, 11909, 11923, 11927,
+    11933, 11939, 11941, 11953, 11959, 11969, 11971, 11981, 11987, 12007, 12011, 12037,
+    12041, 12043, 12049, 12071, 12073, 12097, 12101, 12107, 12109, 12113, 12119, 12143,
+    12149, 12157, 12161, 12163, 12197, 12203, 12211, 12227, 12239, 12241, 12251, 12253,
+    12263, 12269, 12277, 12281, 12289, 12301, 12323, 12329, 12343, 12347, 12373, 12377,
+    12379, 12391, 12401, 12409, 12413, 12421, 12433, 12437, 12451, 12457, 12473, 12479,
+    12487, 12491, 12497, 12503, 12511, 12517, 12527, 12539, 12541, 12547, 12553, 12569,
+    12577, 12583, 12589, 12601, 12611, 12613, 12619, 12637, 12641, 12647, 12653, 12659,
+    12671, 12689, 12697, 12703, 12713, 12721, 12739, 12743, 12757, 12763, 12781, 12791,
+    12799, 12809, 12821, 12823, 12829, 12841, 12853, 12889, 12893, 12899, 12907, 12911,
+    12917, 12919, 12923, 12941, 12953, 12959, 12967, 12973, 12979, 12983, 13001, 13003,
+    13007, 13009, 13033, 13037, 13043, 13049, 13063, 13093, 13099, 13103, 13109, 13121,
+    13127, 13147, 13151, 13159, 13163, 13171, 13177, 13183, 13187, 13217, 13219, 13229,
+    13241, 13249, 13259, 13267, 13291, 13297, 13309, 13313, 13327, 13331, 13337, 13339,
+    13367, 13381, 13397, 13399, 13411, 13417, 13421, 13441, 13451, 13457, 13463, 13469,
+    13477, 13487, 13499, 13513, 13523, 13537, 13553, 13567, 13577, 13591, 13597, 13613,
+    13619, 13627, 13633, 13649, 13669, 13679, 13681, 13687, 13691, 13693, 13697, 13709,
+    13711, 13721, 13723, 13729, 13751, 13757, 13759, 13763, 13781, 13789, 13799, 13807,
+    13829, 13831, 13841, 13859, 13873, 13877, 13879, 13883, 13901, 13903, 13907, 13913,
+    13921, 13931, 13933, 13963, 13967, 13997, 13999, 14009, 14011, 14029, 14033, 14051,
+    14057, 14071, 14081, 14083, 14087, 14107, 14143, 14149, 14153, 14159, 14173, 14177,
+    14197, 14207, 14221, 14243, 14249, 14251, 14281, 14293, 14303, 14321, 14323, 14327,
+    14341, 14347, 14369, 14387, 14389, 14401, 14407, 14411, 14419, 14423, 14431, 14437,
+    14447, 14449, 14461, 14479, 14489, 14503, 14519, 14533, 14537, 14543, 14549, 14551,
+    14557, 14561, 14563, 14591, 14593, 14621, 14627, 14629, 14633, 14639, 14653, 14657,
+    14669, 14683, 14699, 14713, 14717, 14723, 14731, 14737, 14741, 14747, 14753, 14759,
+    14767, 14771, 14779, 14783, 14797, 14813, 14821, 14827, 14831, 14843, 14851, 14867,
+    14869, 14879, 14887, 14891, 14897, 14923, 14929, 14939, 14947, 14951, 14957, 14969,
+    14983, 15013, 15017, 15031, 15053, 15061, 15073, 15077, 15083, 15091, 15101, 15107,
+    15121, 15131, 15137, 15139, 15149, 15161, 15173, 15187, 15193, 15199, 15217, 15227,
+    15233, 15241, 15259, 15263, 15269, 15271, 15277, 15287, 15289, 15299, 15307, 15313,
+    15319, 15329, 15331, 15349, 15359, 15361, 15373, 15377, 15383, 15391, 15401, 15413,
+    15427, 15439, 15443, 15451, 15461, 15467, 15473, 15493, 15497, 15511, 15527, 15541,
+    15551, 15559, 15569, 15581, 15583, 15601, 15607, 15619, 15629, 15641, 15643, 15647,
+    15649, 15661, 15667, 15671, 15679, 15683, 15727, 15731, 15733, 15737, 15739, 15749,
+    15761, 15767, 15773, 15787, 15791, 15797, 15803, 15809, 15817, 15823, 15859, 15877,
+    15881, 15887, 15889, 15901, 15907, 15913, 15919, 15923, 15937, 15959, 15971, 15973,
+    15991, 16001, 16007, 16033, 16057, 16061, 16063, 16067, 16069, 16073, 16087, 16091,
+    16097, 16103, 16111, 16127, 16139, 16141, 16183, 16187, 16189, 16193, 16217, 16223,
+    16229, 16231, 16249, 16253, 16267, 16273, 16301, 16319, 16333, 16339, 16349, 16361,
+    16363, 16369, 16381, 16411, 16417, 16421, 16427, 16433, 16447, 16451, 16453, 16477,
+    16481, 16487, 16493, 16519, 16529, 16547, 16553, 16561, 16567, 16573, 16603, 16607,
+    16619, 16631, 16633, 16649, 16651, 16657, 16661, 16673, 16691, 16693, 16699, 16703,
+    16729, 16741, 16747, 16759, 16763, 16787, 16811, 16823, 16829, 16831, 16843, 16871,
+    16879, 16883, 16889, 16901, 16903, 16921, 16927, 16931, 16937, 16943, 16963, 16979,
+    16981, 16987, 16993, 17011, 17021, 17027, 17029, 17033, 17041, 17047, 17053, 17077,
+    17093, 17099, 17107, 17117, 17123, 17137, 17159, 17167, 17183, 17189, 17191, 17203,
+    17207, 17209, 17231, 17239, 17257, 17291, 17293, 17299, 17317, 17321, 17327, 17333,
+    17341, 17351, 17359, 17377, 17383, 17387, 17389, 17393, 17401, 17417, 17419, 17431,
+    17443, 17449, 17467, 17471, 17477, 17483, 17489, 17491, 17497, 17509, 17519, 17539,
+    17551, 17569, 17573, 17579, 17581, 17597, 17599, 17609, 17623, 17627, 17657, 17659,
+    17669, 17681, 17683, 17707, 17713, 17729, 17737, 17747, 17749, 17761, 17783, 17789,
+    17791, 17807, 17827, 17837, 17839, 17851, 17863, 17881, 17891, 17903, 17909, 17911,
+    17921, 17923, 17929, 17939, 17957, 17959, 17971, 17977, 17981, 17987, 17989, 18013,
+    18041, 18043, 18047, 18049, 18059, 18061, 18077, 18089, 18097, 18119, 18121, 18127,
+    18131, 18133, 18143, 18149, 18169, 18181, 18191, 18199, 18211, 18217, 18223, 18229,
+    18233, 18251, 18253, 18257, 18269, 18287, 18289, 18301, 18307, 18311, 18313, 18329,
+    18341, 18353, 18367, 18371, 18379, 18397, 18401, 18413, 18427, 18433, 18439, 18443,
+    18451, 18457, 18461, 18481, 18493, 18503, 18517, 18521, 18523, 18539, 18541, 18553,
+    18583, 18587, 18593, 18617, 18637, 18661, 18671, 18679, 18691, 18701, 18713, 18719,
+    18731, 18743, 18749, 18757, 18773, 18787, 18793, 18797, 18803, 18839, 18859, 18869,
+    18899, 18911, 18913, 18917, 18919, 18947, 18959, 18973, 18979, 19001, 19009, 19013,
+    19031, 19037, 19051, 19069, 19073, 19079, 19081, 19087, 19121, 19139, 19141, 19157,
+    19163, 19181, 19183, 19207, 19211, 19213, 19219, 19231, 19237, 19249, 19259, 19267,
+    19273, 19289, 19301, 19309, 19319, 19333, 19373, 19379, 19381, 19387, 19391, 19403,
+    19417, 19421, 19423, 19427, 19429, 19433, 19441, 19447, 19457, 19463, 19469, 19471,
+    19477, 19483, 19489, 19501, 19507, 19531, 19541, 19543, 19553, 19559, 19571, 19577,
+    19583, 19597, 19603, 19609, 19661, 19681, 19687, 19697, 19699, 19709, 19717, 19727,
+    19739, 19751, 19753, 19759, 19763, 19777, 19793, 19801, 19813, 19819, 19841, 19843,
+    19853, 19861, 19867, 19889, 19891, 19913, 19919, 19927, 19937, 19949, 19961, 19963,
+    19973, 19979, 19991, 19993, 19997, 20011, 20021, 20023, 20029, 20047, 20051, 20063,
+    20071, 20089, 20101, 20107, 20113, 20117, 20123, 20129, 20143, 20147, 20149, 20161,
+    20173, 20177, 20183, 20201, 20219, 20231, 20233, 20249, 20261, 20269, 20287, 20297,
+    20323, 20327, 20333, 20341, 20347, 20353, 20357, 20359, 20369, 20389, 20393, 20399,
+    20407, 20411, 20431, 20441, 20443, 20477, 20479, 20483, 20507, 20509, 20521, 20533,
+    20543, 20549, 20551, 20563, 20593, 20599, 20611, 20627, 20639, 20641, 20663, 20681,
+    20693, 20707, 20717, 20719, 20731, 20743, 20747, 20749, 20753, 20759, 20771, 20773,
+    20789, 20807, 20809, 20849, 20857, 20873, 20879, 20887, 20897, 20899, 20903, 20921,
+    20929, 20939, 20947, 20959, 20963, 20981, 20983, 21001, 21011, 21013, 21017, 21019,
+    21023, 21031, 21059, 21061, 21067, 21089, 21101, 21107, 21121, 21139, 21143, 21149,
+    21157, 21163, 21169, 21179, 21187, 21191, 21193, 21211, 21221, 21227, 21247, 21269,
+    21277, 21283, 21313, 21317, 21319, 21323, 21341, 21347, 21377, 21379, 21383, 21391,
+    21397, 21401, 21407, 21419, 21433, 21467, 21481, 21487, 21491, 21493, 21499, 21503,
+    21517, 21521, 21523, 21529, 21557, 21559, 21563, 21569, 21577, 21587, 21589, 21599,
+    21601, 21611, 21613, 21617, 21647, 21649, 21661, 21673, 21683, 21701, 21713, 21727,
+    21737, 21739, 21751, 21757, 21767, 21773, 21787, 21799, 21803, 21817, 21821, 21839,
+    21841, 21851, 21859, 21863, 21871, 21881, 21893, 21911, 21929, 21937, 21943, 21961,
+    21977, 21991, 21997, 22003, 22013, 22027, 22031, 22037, 22039, 22051, 22063, 22067,
+    22073, 22079, 22091, 22093, 22109, 22111, 22123, 22129, 22133, 22147, 22153, 22157,
+    22159, 22171, 22189, 22193, 22229, 22247, 22259, 22271, 22273, 22277, 22279, 22283,
+    22291, 22303, 22307, 22343, 22349, 22367, 22369, 22381, 22391, 22397, 22409, 22433,
+    22441, 22447, 22453, 22469, 22481, 22483, 22501, 22511, 22531, 22541, 22543, 22549,
+    22567, 22571, 22573, 22613, 22619, 22621, 22637, 22639, 22643, 22651, 22669, 22679,
+    22691, 22697, 22699, 22709, 22717, 22721, 22727, 22739, 22741, 22751, 22769, 22777,
+    22783, 22787, 22807, 22811, 22817, 22853, 22859, 22861, 22871, 22877, 22901, 22907,
+    22921, 22937, 22943, 22961, 22963, 22973, 22993, 23003, 23011, 23017, 23021, 23027,
+    23029, 23039, 23041, 23053, 23057, 23059, 23063, 23071, 23081, 23087, 23099, 23117,
+    23131, 23143, 23159, 23167, 23173, 23189, 23197, 23201, 23203, 23209, 23227, 23251,
+    23269, 23279, 23291, 23293, 23297, 23311, 23321, 23327, 23333, 23339, 23357, 23369,
+    23371, 23399, 23417, 23431, 23447, 23459, 23473, 23497, 23509, 23531, 23537, 23539,
+    23549, 23557, 23561, 23563, 23567, 23581, 23593, 23599, 23603, 23609, 23623, 23627,
+    23629, 23633, 23663, 23669, 23671, 23677, 23687, 23689, 23719, 23741, 23743, 23747,
+    23753, 23761, 23767, 23773, 23789, 23801, 23813, 23819, 23827, 23831, 23833, 23857,
+    23869, 23873, 23879, 23887, 23893, 23899, 23909, 23911, 23917, 23929, 23957, 23971,
+    23977, 23981, 23993, 24001, 24007, 24019, 24023, 24029, 24043, 24049, 24061, 24071,
+    24077, 24083, 24091, 24097, 24103, 24107, 24109, 24113, 24121, 24133, 24137, 24151,
+    24169, 24179, 24181, 24197, 24203, 24223, 24229, 24239, 24247, 24251, 24281, 24317,
+    24329, 24337, 24359, 24371, 24373, 24379, 24391, 24407, 24413, 24419, 24421, 24439,
+    24443, 24469, 24473, 24481, 24499, 24509, 24517, 24527, 24533, 24547, 24551, 24571,
+    24593, 24611, 24623, 24631, 24659, 24671, 24677, 24683, 24691, 24697, 24709, 24733,
+    24749, 24763, 24767, 24781, 24793, 24799, 24809, 24821, 24841, 24847, 24851, 24859,
+    24877, 24889, 24907, 24917, 24919, 24923, 24943, 24953, 24967, 24971, 24977, 24979,
+    24989, 25013, 25031, 25033, 25037, 25057, 25073, 25087, 25097, 25111, 25117, 25121,
+    25127, 25147, 25153, 25163, 25169, 25171, 25183, 25189, 25219, 25229, 25237, 25243,
+    25247, 25253, 25261, 25301, 25303, 25307, 25309, 25321, 25339, 25343, 25349, 25357,
+    25367, 25373, 25391, 25409, 25411, 25423, 25439, 25447, 25453, 25457, 25463, 25469,
+    25471, 25523, 25537, 25541, 25561, 25577, 25579, 25583, 25589, 25601, 25603, 25609,
+    25621, 25633, 25639, 25643, 25657, 25667, 25673, 25679, 25693, 25703, 25717, 25733,
+    25741, 25747, 25759, 25763, 25771, 25793, 25799, 25801, 25819, 25841, 25847, 25849,
+    25867, 25873, 25889, 25903, 25913, 25919, 25931, 25933, 25939, 25943, 25951, 25969,
+    25981, 25997, 25999, 26003, 26017, 26021, 26029, 26041, 26053, 26083, 26099, 26107,
+    26111, 26113, 26119, 26141, 26153, 26161, 26171, 26177, 26183, 26189, 26203, 26209,
+    26227, 26237, 26249, 26251, 26261, 26263, 26267, 26293, 26297, 26309, 26317, 26321,
+    26339, 26347, 26357, 26371, 26387, 26393, 26399, 26407, 26417, 26423, 26431, 26437,
+    26449, 26459, 26479, 26489, 26497, 26501, 26513, 26539, 26557, 26561, 26573, 26591,
+    26597, 26627, 26633, 26641, 26647, 26669, 26681, 26683, 26687, 26693, 26699, 26701,
+    26711, 26713, 26717, 26723, 26729, 26731, 26737, 26759, 26777, 26783, 26801, 26813,
+    26821, 26833, 26839, 26849, 26861, 26863, 26879, 26881, 26891, 26893, 26903, 26921,
+    26927, 26947, 26951, 26953, 26959, 26981, 26987, 26993, 27011, 27017, 27031, 27043,
+    27059, 27061, 27067, 27073, 27077, 27091, 27103, 27107, 27109, 27127, 27143, 27179,
+    27191, 27197, 27211, 27239, 27241, 27253, 27259, 27271, 27277, 27281, 27283, 27299,
+    27329, 27337, 27361, 27367, 27397, 27407, 27409, 27427, 27431, 27437, 27449, 27457,
+    27479, 27481, 27487, 27509, 27527, 27529, 27539, 27541, 27551, 27581, 27583, 27611,
+    27617, 27631, 27647, 27653, 27673, 27689, 27691, 27697, 27701, 27733, 27737, 27739,
+    27743, 27749, 27751, 27763, 27767, 27773, 27779, 27791, 27793, 27799, 27803, 27809,
+    27817, 27823, 27827, 27847, 27851, 27883, 27893, 27901, 27917, 27919, 27941, 27943,
+    27947, 27953, 27961, 27967, 27983, 27997, 28001, 28019, 28027, 28031, 28051, 28057,
+    28069, 28081, 28087, 28097, 28099, 28109, 28111, 28123, 28151, 28163, 28181, 28183,
+    28201, 28211, 28219, 28229, 28277, 28279, 28283, 28289, 28297, 28307, 28309, 28319,
+    28349, 28351, 28387, 28393, 28403, 28409, 28411, 28429, 28433, 28439, 28447, 28463,
+    28477, 28493, 28499, 28513, 28517, 28537, 28541, 28547, 28549, 28559, 28571, 28573,
+    28579, 28591, 28597, 28603, 28607, 28619, 28621, 28627, 28631, 28643, 28649, 28657,
+    28661, 28663, 28669, 28687, 28697, 28703, 28711, 28723, 28729, 28751, 28753, 28759,
+    28771, 28789, 28793, 28807, 28813, 28817, 28837, 28843, 28859, 28867, 28871, 28879,
+    28901, 28909, 28921, 28927, 28933, 28949, 28961, 28979, 29009, 29017, 29021, 29023,
+    29027, 29033, 29059, 29063, 29077, 29101, 29123, 29129, 29131, 29137, 29147, 29153,
+    29167, 29173, 29179, 29191, 29201, 29207, 29209, 29221, 29231, 29243, 29251, 29269,
+    29287, 29297, 29303, 29311, 29327, 29333, 29339, 29347, 29363, 29383, 29387, 29389,
+    29399, 29401, 29411, 29423, 29429, 29437, 29443, 29453, 29473, 29483, 29501, 29527,
+    29531, 29537, 29567, 29569, 29573, 29581, 29587, 29599, 29611, 29629, 29633, 29641,
+    29663, 29669, 29671, 29683, 29717, 29723, 29741, 29753, 29759, 29761, 29789, 29803,
+    29819, 29833, 29837, 29851, 29863, 29867, 29873, 29879, 29881, 29917, 29921, 29927,
+    29947, 29959, 29983, 29989, 30011, 30013, 30029, 30047, 30059, 30071, 30089, 30091,
+    30097, 30103, 30109, 30113, 30119, 30133, 30137, 30139, 30161, 30169, 30181, 30187,
+    30197, 30203, 30211, 30223, 30241, 30253, 30259, 30269, 30271, 30293, 30307, 30313,
+    30319, 30323, 30341, 30347, 30367, 30389, 30391, 30403, 30427, 30431, 30449, 30467,
+    30469, 30491, 30493, 30497, 30509, 30517, 30529, 30539, 30553, 30557, 30559, 30577,
+    30593, 30631, 30637, 30643, 30649, 30661, 30671, 30677, 30689, 30697, 30703, 30707,
+    30713, 30727, 30757, 30763, 30773, 30781, 30803, 30809, 30817, 30829, 30839, 30841,
+    30851, 30853, 30859, 30869, 30871, 30881, 30893, 30911, 30931, 30937, 30941, 30949,
+    30971, 30977, 30983, 31013, 31019, 31033, 31039, 31051, 31063, 31069, 31079, 31081,
+    31091, 31121, 31123, 31139, 31147, 31151, 31153, 31159, 31177, 31181, 31183, 31189,
+    31193, 31219, 31223, 31231, 31237, 31247, 31249, 31253, 31259, 31267, 31271, 31277,
+    31307, 31319, 31321, 31327, 31333, 31337, 31357, 31379, 31387, 31391, 31393, 31397,
+    31469, 31477, 31481, 31489, 31511, 31513, 31517, 31531, 31541, 31543, 31547, 31567,
+    31573, 31583, 31601, 31607, 31627, 31643, 31649, 31657, 31663, 31667, 31687, 31699,
+    31721, 31723, 31727, 31729, 31741, 31751, 31769, 31771, 31793, 31799, 31817, 31847,
+    31849, 31859, 31873, 31883, 31891, 31907, 31957, 31963, 31973, 31981, 31991, 32003,
+    32009, 32027, 32029, 32051, 32057, 32059, 32063, 32069, 32077, 32083, 32089, 32099,
+    32117, 32119, 32141, 32143, 32159, 32173, 32183, 32189, 32191, 32203, 32213, 32233,
+    32237, 32251, 32257, 32261, 32297, 32299, 32303, 32309, 32321, 32323, 32327, 32341,
+    32353, 32359, 32363, 32369, 32371, 32377, 32381, 32401, 32411, 32413, 32423, 32429,
+    32441, 32443, 32467, 32479, 32491, 32497, 32503, 32507, 32531, 32533, 32537, 32561,
+    32563, 32569, 32573, 32579, 32587, 32603, 32609, 32611, 32621, 32633, 32647, 32653,
+    32687, 32693, 32707, 32713, 32717, 32719, 32749, 32771, 32779, 32783, 32789, 32797,
+    32801, 32803, 32831, 32833, 32839, 32843, 32869, 32887, 32909, 32911, 32917, 32933,
+    32939, 32941, 32957, 32969, 32971, 32983, 32987, 32993, 32999, 33013, 33023, 33029,
+    33037, 33049, 33053, 33071, 33073, 33083, 33091, 33107, 33113, 33119, 33149, 33151,
+    33161, 33179, 33181, 33191, 33199, 33203, 33211, 33223, 33247, 33287, 33289, 33301,
+    33311, 33317, 33329, 33331, 33343, 33347, 33349, 33353, 33359, 33377, 33391, 33403,
+    33409, 33413, 33427, 33457, 33461, 33469, 33479, 33487, 33493, 33503, 33521, 33529,
+    33533, 33547, 33563, 33569, 33577, 33581, 33587, 33589, 33599, 33601, 33613, 33617,
+    33619, 33623, 33629, 33637, 33641, 33647, 33679, 33703, 33713, 33721, 33739, 33749,
+    33751, 33757, 33767, 33769, 33773, 33791, 33797, 33809, 33811, 33827, 33829, 33851,
+    33857, 33863, 33871, 33889, 33893, 33911, 33923, 33931, 33937, 33941, 33961, 33967,
+    33997, 34019, 34031, 34033, 34039, 34057, 34061, 34123, 34127, 34129, 34141, 34147,
+    34157, 34159, 34171, 34183, 34211, 34213, 34217, 34231, 34253, 34259, 34261, 34267,
+    34273, 34283, 34297, 34301, 34303, 34313, 34319, 34327, 34337, 34351, 34361, 34367,
+    34369, 34381, 34403, 34421, 34429, 34439, 34457, 34469, 34471, 34483, 34487, 34499,
+    34501, 34511, 34513, 34519, 34537, 34543, 34549, 34583, 34589, 34591, 34603, 34607,
+    34613, 34631, 34649, 34651, 34667, 34673, 34679, 34687, 34693, 34703, 34721, 34729,
+    34739, 34747, 34757, 34759, 34763, 34781, 34807, 34819, 34841, 34843, 34847, 34849,
+    34871, 34877, 34883, 34897, 34913, 34919, 34939, 34949, 34961, 34963, 34981, 35023,
+    35027, 35051, 35053, 35059, 35069, 35081, 35083, 35089, 35099, 35107, 35111, 35117,
+    35129, 35141, 35149, 35153, 35159, 35171, 35201, 35221, 35227, 35251, 35257, 35267,
+    35279, 35281, 35291, 35311, 35317, 35323, 35327, 35339, 35353, 35363, 35381, 35393,
+    35401, 35407, 35419, 35423, 35437, 35447, 35449, 35461, 35491, 35507, 35509, 35521,
+    35527, 35531, 35533, 35537, 35543, 35569, 35573, 35591, 35593, 35597, 35603, 35617,
+    35671, 35677, 35729, 35731, 35747, 35753, 35759, 35771, 35797, 35801, 35803, 35809,
+    35831, 35837, 35839, 35851, 35863, 35869, 35879, 35897, 35899, 35911, 35923, 35933,
+    35951, 35963, 35969, 35977, 35983, 35993, 35999, 36007, 36011, 36013, 36017, 36037,
+    36061, 36067, 36073, 36083, 36097, 36107, 36109, 36131, 36137, 36151, 36161, 36187,
+    36191, 36209, 36217, 36229, 36241, 36251, 36263, 36269, 36277, 36293, 36299, 36307,
+    36313, 36319, 36341, 36343, 36353, 36373, 36383, 36389, 36433, 36451, 36457, 36467,
+    36469, 36473, 36479, 36493, 36497, 36523, 36527, 36529, 36541, 36551, 36559, 36563,
+    36571, 36583, 36587, 36599, 36607, 36629, 36637, 36643, 36653, 36671, 36677, 36683,
+    36691, 36697, 36709, 36713, 36721, 36739, 36749, 36761, 36767, 36779, 36781, 36787,
+    36791, 36793, 36809, 36821, 36833, 36847, 36857, 36871, 36877, 36887, 36899, 36901,
+    36913, 36919, 36923, 36929, 36931, 36943, 36947, 36973, 36979, 36997, 37003, 37013,
+    37019, 37021, 37039, 37049, 37057, 37061, 37087, 37097, 37117, 37123, 37139, 37159,
+    37171, 37181, 37189, 37199, 37201, 37217, 37223, 37243, 37253, 37273, 37277, 37307,
+    37309, 37313, 37321, 37337, 37339, 37357, 37361, 37363, 37369, 37379, 37397, 37409,
+    37423, 37441, 37447, 37463, 37483, 37489, 37493, 37501, 37507, 37511, 37517, 37529,
+    37537, 37547, 37549, 37561, 37567, 37571, 37573, 37579, 37589, 37591, 37607, 37619,
+    37633, 37643, 37649, 37657, 37663, 37691, 37693, 37699, 37717, 37747, 37781, 37783,
+    37799, 37811, 37813, 37831, 37847, 37853, 37861, 37871, 37879, 37889, 37897, 37907,
+    37951, 37957, 37963, 37967, 37987, 37991, 37993, 37997, 38011, 38039, 38047, 38053,
+    38069, 38083, 38113, 38119, 38149, 38153, 38167, 38177, 38183, 38189, 38197, 38201,
+    38219, 38231, 38237, 38239, 38261, 38273, 38281, 38287, 38299, 38303, 38317, 38321,
+    38327, 38329, 38333, 38351, 38371, 38377, 38393, 38431, 38447, 38449, 38453, 38459,
+    38461, 38501, 38543, 38557, 38561, 38567, 38569, 38593, 38603, 38609, 38611, 38629,
+    38639, 38651, 38653, 38669, 38671, 38677, 38693, 38699, 38707, 38711, 38713, 38723,
+    38729, 38737, 38747, 38749, 38767, 38783, 38791, 38803, 38821, 38833, 38839, 38851,
+    38861, 38867, 38873, 38891, 38903, 38917, 38921, 38923, 38933, 38953, 38959, 38971,
+    38977, 38993, 39019, 39023, 39041, 39043, 39047, 39079, 39089, 39097, 39103, 39107,
+    39113, 39119, 39133, 39139, 39157, 39161, 39163, 39181, 39191, 39199, 39209, 39217,
+    39227, 39229, 39233, 39239, 39241, 39251, 39293, 39301, 39313, 39317, 39323, 39341,
+    39343, 39359, 39367, 39371, 39373, 39383, 39397, 39409, 39419, 39439, 39443, 39451,
+    39461, 39499, 39503, 39509, 39511, 39521, 39541, 39551, 39563, 39569, 39581, 39607,
+    39619, 39623, 39631, 39659, 39667, 39671, 39679, 39703, 39709, 39719, 39727, 39733,
+    39749, 39761, 39769, 39779, 39791, 39799, 39821, 39827, 39829, 39839, 39841, 39847,
+    39857, 39863, 39869, 39877, 39883, 39887, 39901, 39929, 39937, 39953, 39971, 39979,
+    39983, 39989, 40009, 40013, 40031, 40037, 40039, 40063, 40087, 40093, 40099, 40111,
+    40123, 40127, 40129, 40151, 40153, 40163, 40169, 40177, 40189, 40193, 40213, 40231,
+    40237, 40241, 40253, 40277, 40283, 40289, 40343, 40351, 40357, 40361, 40387, 40423,
+    40427, 40429, 40433, 40459, 40471, 40483, 40487, 40493, 40499, 40507, 40519, 40529,
+    40531, 40543, 40559, 40577, 40583, 40591, 40597, 40609, 40627, 40637, 40639, 40693,
+    40697, 40699, 40709, 40739, 40751, 40759, 40763, 40771, 40787, 40801, 40813, 40819,
+    40823, 40829, 40841, 40847, 40849, 40853, 40867, 40879, 40883, 40897, 40903, 40927,
+    40933, 40939, 40949, 40961, 40973, 40993, 41011, 41017, 41023, 41039, 41047, 41051,
+    41057, 41077, 41081, 41113, 41117, 41131, 41141, 41143, 41149, 41161, 41177, 41179,
+    41183, 41189, 41201, 41203, 41213, 41221, 41227, 41231, 41233, 41243, 41257, 41263,
+    41269, 41281, 41299, 41333, 41341, 41351, 41357, 41381, 41387, 41389, 41399, 41411,
+    41413, 41443, 41453, 41467, 41479, 41491, 41507, 41513, 41519, 41521, 41539, 41543,
+    41549, 41579, 41593, 41597, 41603, 41609, 41611, 41617, 41621, 41627, 41641, 41647,
+    41651, 41659, 41669, 41681, 41687, 41719, 41729, 41737, 41759, 41761, 41771, 41777,
+    41801, 41809, 41813, 41843, 41849, 41851, 41863, 41879, 41887, 41893, 41897, 41903,
+    41911, 41927, 41941, 41947, 41953, 41957, 41959, 41969, 41981, 41983, 41999, 42013,
+    42017, 42019, 42023, 42043, 42061, 42071, 42073, 42083, 42089, 42101, 42131, 42139,
+    42157, 42169, 42179, 42181, 42187, 42193, 42197, 42209, 42221, 42223, 42227, 42239,
+    42257, 42281, 42283, 42293, 42299, 42307, 42323, 42331, 42337, 42349, 42359, 42373,
+    42379, 42391, 42397, 42403, 42407, 42409, 42433, 42437, 42443, 42451, 42457, 42461,
+    42463, 42467, 42473, 42487, 42491, 42499, 42509, 42533, 42557, 42569, 42571, 42577,
+    42589, 42611, 42641, 42643, 42649, 42667, 42677, 42683, 42689, 42697, 42701, 42703,
+    42709, 42719, 42727, 42737, 42743, 42751, 42767, 42773, 42787, 42793, 42797, 42821,
+    42829, 42839, 42841, 42853, 42859, 42863, 42899, 42901, 42923, 42929, 42937, 42943,
+    42953, 42961, 42967, 42979, 42989, 43003, 43013, 43019, 43037, 43049, 43051, 43063,
+    43067, 43093, 43103, 43117, 43133, 43151, 43159, 43177, 43189, 43201, 43207, 43223,
+    43237, 43261, 43271, 43283, 43291, 43313, 43319, 43321, 43331, 43391, 43397, 43399,
+    43403, 43411, 43427, 43441, 43451, 43457, 43481, 43487, 43499, 43517, 43541, 43543,
+    43573, 43577, 43579, 43591, 43597, 43607, 43609, 43613, 43627, 43633, 43649, 43651,
+    43661, 43669, 43691, 43711, 43717, 43721, 43753, 43759, 43777, 43781, 43783, 43787,
+    43789, 43793, 43801, 43853, 43867, 43889, 43891, 43913, 43933, 43943, 43951, 43961,
+    43963, 43969, 43973, 43987, 43991, 43997, 44017, 44021, 44027, 44029, 44041, 44053,
+    44059, 44071, 44087, 44089, 44101, 44111, 44119, 44123, 44129, 44131, 44159, 44171,
+    44179, 44189, 44201, 44203, 44207, 44221, 44249, 44257, 44263, 44267, 44269, 44273,
+    44279, 44281, 44293, 44351, 44357, 44371, 44381, 44383, 44389, 44417, 44449, 44453,
+    44483, 44491, 44497, 44501, 44507, 44519, 44531, 44533, 44537, 44543, 44549, 44563,
+    44579, 44587, 44617, 44621, 44623, 44633, 44641, 44647, 44651, 44657, 44683, 44687,
+    44699, 44701, 44711, 44729, 44741, 44753, 44771, 44773, 44777, 44789, 44797, 44809,
+    44819, 44839, 44843, 44851, 44867, 44879, 44887, 44893, 44909, 44917, 44927, 44939,
+    44953, 44959, 44963, 44971, 44983, 44987, 45007, 45013, 45053, 45061, 45077, 45083,
+    45119, 45121, 45127, 45131, 45137, 45139, 45161, 45179, 45181, 45191, 45197, 45233,
+    45247, 45259, 45263, 45281, 45289, 45293, 45307, 45317, 45319, 45329, 45337, 45341,
+    45343, 45361, 45377, 45389, 45403, 45413, 45427, 45433, 45439, 45481, 45491, 45497,
+    45503, 45523, 45533, 45541, 45553, 45557, 45569, 45587, 45589, 45599, 45613, 45631,
+    45641, 45659, 45667, 45673, 45677, 45691, 45697, 45707, 45737, 45751, 45757, 45763,
+    45767, 45779, 45817, 45821, 45823, 45827, 45833, 45841, 45853, 45863, 45869, 45887,
+    45893, 45943, 45949, 45953, 45959, 45971, 45979, 45989, 46021, 46027, 46049, 46051,
+    46061, 46073, 46091, 46093, 46099, 46103, 46133, 46141, 46147, 46153, 46171, 46181,
+    46183, 46187, 46199, 46219, 46229, 46237, 46261, 46271, 46273, 46279, 46301, 46307,
+    46309, 46327, 46337, 46349, 46351, 46381, 46399, 46411, 46439, 46441, 46447, 46451,
+    46457, 46471, 46477, 46489, 46499, 46507, 46511, 46523, 46549, 46559, 46567, 46573,
+    46589, 46591, 46601, 46619, 46633, 46639, 46643, 46649, 46663, 46679, 46681, 46687,
+    46691, 46703, 46723, 46727, 46747, 46751, 46757, 46769, 46771, 46807, 46811, 46817,
+    46819, 46829, 46831, 46853, 46861, 46867, 46877, 46889, 46901, 46919, 46933, 46957,
+    46993, 46997, 47017, 47041, 47051, 47057, 47059, 47087, 47093, 47111, 47119, 47123,
+    47129, 47137, 47143, 47147, 47149, 47161, 47189, 47207, 47221, 47237, 47251, 47269,
+    47279, 47287, 47293, 47297, 47303, 47309, 47317, 47339, 47351, 47353, 47363, 47381,
+    47387, 47389, 47407, 47417, 47419, 47431, 47441, 47459, 47491, 47497, 47501, 47507,
+    47513, 47521, 47527, 47533, 47543, 47563, 47569, 47581, 47591, 47599, 47609, 47623,
+    47629, 47639, 47653, 47657, 47659, 47681, 47699, 47701, 47711, 47713, 47717, 47737,
+    47741, 47743, 47777, 47779, 47791, 47797, 47807, 47809, 47819, 47837, 47843, 47857,
+    47869, 47881, 47903, 47911, 47917, 47933, 47939, 47947, 47951, 47963, 47969, 47977,
+    47981, 48017, 48023, 48029, 48049, 48073, 48079, 48091, 48109, 48119, 48121, 48131,
+    48157, 48163, 48179, 48187, 48193, 48197, 48221, 48239, 48247, 48259, 48271, 48281,
+    48299, 48311, 48313, 48337, 48341, 48353, 48371, 48383, 48397, 48407, 48409, 48413,
+    48437, 48449, 48463, 48473, 48479, 48481, 48487, 48491, 48497, 48523, 48527, 48533,
+    48539, 48541, 48563, 48571, 48589, 48593, 48611, 48619, 48623, 48647, 48649, 48661,
+    48673, 48677, 48679, 48731, 48733, 48751, 48757, 48761, 48767, 48779, 48781, 48787,
+    48799, 48809, 48817, 48821, 48823, 48847, 48857, 48859, 48869, 48871, 48883, 48889,
+    48907, 48947, 48953, 48973, 48989, 48991, 49003, 49009, 49019, 49031, 49033, 49037,
+    49043, 49057, 49069, 49081, 49103, 49109, 49117, 49121, 49123, 49139, 49157, 49169,
+    49171, 49177, 49193, 49199, 49201, 49207, 49211, 49223, 49253, 49261, 49277, 49279,
+    49297, 49307, 49331, 49333, 49339, 49363, 49367, 49369, 49391, 49393, 49409, 49411,
+    49417, 49429, 49433, 49451, 49459, 49463, 49477, 49481, 49499, 49523, 49529, 49531,
+    49537, 49547, 49549, 49559, 49597, 49603, 49613, 49627, 49633, 49639, 49663, 49667,
+    49669, 49681, 49697, 49711, 49727, 49739, 49741, 49747, 49757, 49783, 49787, 49789,
+    49801, 49807, 49811, 49823, 49831, 49843, 49853, 49871, 49877, 49891, 49919, 49921,
+    49927, 49937, 49939, 49943, 49957, 49991, 49993, 49999, 50021, 50023, 50033, 50047,
+    50051, 50053, 50069, 50077, 50087, 50093, 50101, 50111, 50119, 50123, 50129, 50131,
+    50147, 50153, 50159, 50177, 50207, 50221, 50227, 50231, 50261, 50263, 50273, 50287,
+    50291, 50311, 50321, 50329, 50333, 50341, 50359, 50363, 50377, 50383, 50387, 50411,
+    50417, 50423, 50441, 50459, 50461, 50497, 50503, 50513, 50527, 50539, 50543, 50549,
+    50551, 50581, 50587, 50591, 50593, 50599, 50627, 50647, 50651, 50671, 50683, 50707,
+    50723, 50741, 50753, 50767, 50773, 50777, 50789, 50821, 50833, 50839, 50849, 50857,
+    50867, 50873, 50891, 50893, 50909, 50923, 50929, 50951, 50957, 50969, 50971, 50989,
+    50993, 51001, 51031, 51043, 51047, 51059, 51061, 51071, 51109, 51131, 51133, 51137,
+    51151, 51157, 51169, 51193, 51197, 51199, 51203, 51217, 51229, 51239, 51241, 51257,
+    51263, 51283, 51287, 51307, 51329, 51341, 51343, 51347, 51349, 51361, 51383, 51407,
+    51413, 51419, 51421, 51427, 51431, 51437, 51439, 51449, 51461, 51473, 51479, 51481,
+    51487, 51503, 51511, 51517, 51521, 51539, 51551, 51563, 51577, 51581, 51593, 51599,
+    51607, 51613, 51631, 51637, 51647, 51659, 51673, 51679, 51683, 51691, 51713, 51719,
+    51721, 51749, 51767, 51769, 51787, 51797, 51803, 51817, 51827, 51829, 51839, 51853,
+    51859, 51869, 51871, 51893, 51899, 51907, 51913, 51929, 51941, 51949, 51971, 51973,
+    51977, 51991, 52009, 52021, 52027, 52051, 52057, 52067, 52069, 52081, 52103, 52121,
+    52127, 52147, 52153, 52163, 52177, 52181, 52183, 52189, 52201, 52223, 52237, 52249,
+    52253, 52259, 52267, 52289, 52291, 52301, 52313, 52321, 52361, 52363, 52369, 52379,
+    52387, 52391, 52433, 52453, 52457, 52489, 52501, 52511, 52517, 52529, 52541, 52543,
+    52553, 52561, 52567, 52571, 52579, 52583, 52609, 52627, 52631, 52639, 52667, 52673,
+    52691, 52697, 52709, 52711, 52721, 52727, 52733, 52747, 52757, 52769, 52783, 52807,
+    52813, 52817, 52837, 52859, 52861, 52879, 52883, 52889, 52901, 52903, 52919, 52937,
+    52951, 52957, 52963, 52967, 52973, 52981, 52999, 53003, 53017, 53047, 53051, 53069,
+    53077, 53087, 53089, 53093, 53101, 53113, 53117, 53129, 53147, 53149, 53161, 53171,
+    53173, 53189, 53197, 53201, 53231, 53233, 53239, 53267, 53269, 53279, 53281, 53299,
+    53309, 53323, 53327, 53353, 53359, 53377, 53381, 53401, 53407, 53411, 53419, 53437,
+    53441, 53453, 53479, 53503, 53507, 53527, 53549, 53551, 53569, 53591, 53593, 53597,
+    53609, 53611, 53617, 53623, 53629, 53633, 53639, 53653, 53657, 53681, 53693, 53699,
+    53717, 53719, 53731, 53759, 53773, 53777, 53783, 53791, 53813, 53819, 53831, 53849,
+    53857, 53861, 53881, 53887, 53891, 53897, 53899, 53917, 53923, 53927, 53939, 53951,
+    53959, 53987, 53993, 54001, 54011, 54013, 54037, 54049, 54059, 54083, 54091, 54101,
+    54121, 54133, 54139, 54151, 54163, 54167, 54181, 54193, 54217, 54251, 54269, 54277,
+    54287, 54293, 54311, 54319, 54323, 54331, 54347, 54361, 54367, 54371, 54377, 54401,
+    54403, 54409, 54413, 54419, 54421, 54437, 54443, 54449, 54469, 54493, 54497, 54499,
+    54503, 54517, 54521, 54539, 54541, 54547, 54559, 54563, 54577, 54581, 54583, 54601,
+    54617, 54623, 54629, 54631, 54647, 54667, 54673, 54679, 54709, 54713, 54721, 54727,
+    54751, 54767, 54773, 54779, 54787, 54799, 54829, 54833, 54851, 54869, 54877, 54881,
+    54907, 54917, 54919, 54941, 54949, 54959, 54973, 54979, 54983, 55001, 55009, 55021,
+    55049, 55051, 55057, 55061, 55073, 55079, 55103, 55109, 55117, 55127, 55147, 55163,
+    55171, 55201, 55207, 55213, 55217, 55219, 55229, 55243, 55249, 55259, 55291, 55313,
+    55331, 55333, 55337, 55339, 55343, 55351, 55373, 55381, 55399, 55411, 55439, 55441,
+    55457, 55469, 55487, 55501, 55511, 55529, 55541, 55547, 55579, 55589, 55603, 55609,
+    55619, 55621, 55631, 55633, 55639, 55661, 55663, 55667, 55673, 55681, 55691, 55697,
+    55711, 55717, 55721, 55733, 55763, 55787, 55793, 55799, 55807, 55813, 55817, 55819,
+    55823, 55829, 55837, 55843, 55849, 55871, 55889, 55897, 55901, 55903, 55921, 55927,
+    55931, 55933, 55949, 55967, 55987, 55997, 56003, 56009, 56039, 56041, 56053, 56081,
+    56087, 56093, 56099, 56101, 56113, 56123, 56131, 56149, 56167, 56171, 56179, 56197,
+    56207, 56209, 56237, 56239, 56249, 56263, 56267, 56269, 56299, 56311, 56333, 56359,
+    56369, 56377, 56383, 56393, 56401, 56417, 56431, 56437, 56443, 56453, 56467, 56473,
+    56477, 56479, 56489, 56501, 56503, 56509, 56519, 56527, 56531, 56533, 56543, 56569,
+    56591, 56597, 56599, 56611, 56629, 56633, 56659, 56663, 56671, 56681, 56687, 56701,
+    56711, 56713, 56731, 56737, 56747, 56767, 56773, 56779, 56783, 56807, 56809, 56813,
+    56821, 56827, 56843, 56857, 56873, 56891, 56893, 56897, 56909, 56911, 56921, 56923,
+    56929, 56941, 56951, 56957, 56963, 56983, 56989, 56993, 56999, 57037, 57041, 57047,
+    57059, 57073, 57077, 57089, 57097, 57107, 57119, 57131, 57139, 57143, 57149, 57163,
+    57173, 57179, 57191, 57193, 57203, 57221, 57223, 57241, 57251, 57259, 57269, 57271,
+    57283, 57287, 57301, 57329, 57331, 57347, 57349, 57367, 57373, 57383, 57389, 57397,
+    57413, 57427, 57457, 57467, 57487, 57493, 57503, 57527, 57529, 57557, 57559, 57571,
+    57587, 57593, 57601, 57637, 57641, 57649, 57653, 57667, 57679, 57689, 57697, 57709,
+    57713, 57719, 57727, 57731, 57737, 57751, 57773, 57781, 57787, 57791, 57793, 57803,
+    57809, 57829, 57839, 57847, 57853, 57859, 57881, 57899, 57901, 57917, 57923, 57943,
+    57947, 57973, 57977, 57991, 58013, 58027, 58031, 58043, 58049, 58057, 58061, 58067,
+    58073, 58099, 58109, 58111, 58129, 58147, 58151, 58153, 58169, 58171, 58189, 58193,
+    58199, 58207, 58211, 58217, 58229, 58231, 58237, 58243, 58271, 58309, 58313, 58321,
+    58337, 58363, 58367, 58369, 58379, 58391, 58393, 58403, 58411, 58417, 58427, 58439,
+    58441, 58451, 58453, 58477, 58481, 58511, 58537, 58543, 58549, 58567, 58573, 58579,
+    58601, 58603, 58613, 58631, 58657, 58661, 58679, 58687, 58693, 58699, 58711, 58727,
+    58733, 58741, 58757, 58763, 58771, 58787, 58789, 58831, 58889, 58897, 58901, 58907,
+    58909, 58913, 58921, 58937, 58943, 58963, 58967, 58979, 58991, 58997, 59009, 59011,
+    59021, 59023, 59029, 59051, 59053, 59063, 59069, 59077, 59083, 59093, 59107, 59113,
+    59119, 59123, 59141, 59149, 59159, 59167, 59183, 59197, 59207, 59209, 59219, 59221,
+    59233, 59239, 59243, 59263, 59273, 59281, 59333, 59341, 59351, 59357, 59359, 59369,
+    59377, 59387, 59393, 59399, 59407, 59417, 59419, 59441, 59443, 59447, 59453, 59467,
+    59471, 59473, 59497, 59509, 59513, 59539, 59557, 59561, 59567, 59581, 59611, 59617,
+    59621, 59627, 59629, 59651, 59659, 59663, 59669, 59671, 59693, 59699, 59707, 59723,
+    59729, 59743, 59747, 59753, 59771, 59779, 59791, 59797, 59809, 59833, 59863, 59879,
+    59887, 59921, 59929, 59951, 59957, 59971, 59981, 59999, 60013, 60017, 60029, 60037,
+    60041, 60077, 60083, 60089, 60091, 60101, 60103, 60107, 60127, 60133, 60139, 60149,
+    60161, 60167, 60169, 60209, 60217, 60223, 60251, 60257, 60259, 60271, 60289, 60293,
+    60317, 60331, 60337, 60343, 60353, 60373, 60383, 60397, 60413, 60427, 60443, 60449,
+    60457, 60493, 60497, 60509, 60521, 60527, 60539, 60589, 60601, 60607, 60611, 60617,
+    60623, 60631, 60637, 60647, 60649, 60659, 60661, 60679, 60689, 60703, 60719, 60727,
+    60733, 60737, 60757, 60761, 60763, 60773, 60779, 60793, 60811, 60821, 60859, 60869,
+    60887, 60889, 60899, 60901, 60913, 60917, 60919, 60923, 60937, 60943, 60953, 60961,
+    61001, 61007, 61027, 61031, 61043, 61051, 61057, 61091, 61099, 61121, 61129, 61141,
+    61151, 61153, 61169, 61211, 61223, 61231, 61253, 61261, 61283, 61291, 61297, 61331,
+    61333, 61339, 61343, 61357, 61363, 61379, 61381, 61403, 61409, 61417, 61441, 61463,
+    61469, 61471, 61483, 61487, 61493, 61507, 61511, 61519, 61543, 61547, 61553, 61559,
+    61561, 61583, 61603, 61609, 61613, 61627, 61631, 61637, 61643, 61651, 61657, 61667,
+    61673, 61681, 61687, 61703, 61717, 61723, 61729, 61751, 61757, 61781, 61813, 61819,
+    61837, 61843, 61861, 61871, 61879, 61909, 61927, 61933, 61949, 61961, 61967, 61979,
+    61981, 61987, 61991, 62003, 62011, 62017, 62039, 62047, 62053, 62057, 62071, 62081,
+    62099, 62119, 62129, 62131, 62137, 62141, 62143, 62171, 62189, 62191, 62201, 62207,
+    62213, 62219, 62233, 62273, 62297, 62299, 62303, 62311, 62323, 62327, 62347, 62351,
+    62383, 62401, 62417, 62423, 62459, 62467, 62473, 62477, 62483, 62497, 62501, 62507,
+    62533, 62539, 62549, 62563, 62581, 62591, 62597, 62603, 62617, 62627, 62633, 62639,
+    62653, 62659, 62683, 62687, 62701, 62723, 62731, 62743, 62753, 62761, 62773, 62791,
+    62801, 62819, 62827, 62851, 62861, 62869, 62873, 62897, 62903, 62921, 62927, 62929,
+    62939, 62969, 62971, 62981, 62983, 62987, 62989, 63029, 63031, 63059, 63067, 63073,
+    63079, 63097, 63103, 63113, 63127, 63131, 63149, 63179, 63197, 63199, 63211, 63241,
+    63247, 63277, 63281, 63299, 63311, 63313, 63317, 63331, 63337, 63347, 63353, 63361,
+    63367, 63377, 63389, 63391, 63397, 63409, 63419, 63421, 63439, 63443, 63463, 63467,
+    63473, 63487, 63493, 63499, 63521, 63527, 63533, 63541, 63559, 63577, 63587, 63589,
+    63599, 63601, 63607, 63611, 63617, 63629, 63647, 63649, 63659, 63667, 63671, 63689,
+    63691, 63697, 63703, 63709, 63719, 63727, 63737, 63743, 63761, 63773, 63781, 63793,
+    63799, 63803, 63809, 63823, 63839, 63841, 63853, 63857, 63863, 63901, 63907, 63913,
+    63929, 63949, 63977, 63997, 64007, 64013, 64019, 64033, 64037, 64063, 64067, 64081,
+    64091, 64109, 64123, 64151, 64153, 64157, 64171, 64187, 64189, 64217, 64223, 64231,
+    64237, 64271, 64279, 64283, 64301, 64303, 64319, 64327, 64333, 64373, 64381, 64399,
+    64403, 64433, 64439, 64451, 64453, 64483, 64489, 64499, 64513, 64553, 64567, 64577,
+    64579, 64591, 64601, 64609, 64613, 64621, 64627, 64633, 64661, 64663, 64667, 64679,
+    64693, 64709, 64717, 64747, 64763, 64781, 64783, 64793, 64811, 64817, 64849, 64853,
+    64871, 64877, 64879, 64891, 64901, 64919, 64921, 64927, 64937, 64951, 64969, 64997,
+    65003, 65011, 65027, 65029, 65033, 65053, 65063, 65071, 65089, 65099, 65101, 65111,
+    65119, 65123, 65129, 65141, 65147, 65167, 65171, 65173, 65179, 65183, 65203, 65213,
+    65239, 65257, 65267, 65269, 65287, 65293, 65309, 65323, 65327, 65353, 65357, 65371,
+    65381, 65393, 65407, 65413, 65419, 65423, 65437, 65447, 65449, 65479, 65497, 65519,
+    65521,
+};
+
+const uint32_t SMALL_PRIME_BARRETT[NUM_SMALL_PRIMES] = {
+    0x55555555, 0x33333333, 0x24924924, 0x1745d174, 0x13b13b13, 0x0f0f0f0f,
+    0x0d79435e, 0x0b21642c, 0x08d3dcb0, 0x08421084, 0x06eb3e45, 0x063e7063,
+    0x05f417d0, 0x0572620a, 0x04d4873e, 0x0456c797, 0x04325c53, 0x03d22635,
+    0x039b0ad1, 0x0381c0e0, 0x033d91d2, 0x03159721, 0x02e05c0b, 0x02a3a0fd,
+    0x0288df0c, 0x027c4597, 0x02647c69, 0x02593f69, 0x0243f6f0, 0x02040810,
+    0x01f44659, 0x01de5d6e, 0x01d77b65, 0x01b7d6c3, 0x01b20364, 0x01a16d3f,
+    0x01920fb4, 0x01886e5f, 0x017ad220, 0x016e1f76, 0x016a13cd, 0x01571ed3,
+    0x01539094, 0x014cab88, 0x0149539e, 0x013698df, 0x0125e227, 0x0120b470,
+    0x011e2ef3, 0x01194538, 0x0112358e, 0x010fef01, 0x0105197f, 0x00ff00ff,
+    0x00f92fb2, 0x00f3a0d5, 0x00f1d48b, 0x00ec9791, 0x00e93965, 0x00e79372,
+    0x00dfac1f, 0x00d578e9, 0x00d2ba08, 0x00d16154, 0x00cebcf8, 0x00c5fe74,
+    0x00c27806, 0x00bcdd53, 0x00bbc840, 0x00b9a786, 0x00b68d31, 0x00b2927c,
+    0x00afb321, 0x00aceb0f, 0x00ab1cbd, 0x00a87917, 0x00a513fd, 0x00a36e71,
+    0x00a03c16, 0x009c6916, 0x009baade, 0x00980e41, 0x00975a75, 0x009548e4,
+    0x0093efd1, 0x0091f5bc, 0x008f67a1, 0x008e2917, 0x008d8be3, 0x008c5584,
+    0x0088d180, 0x00869222, 0x0085797b, 0x008355ac, 0x00824a4e, 0x0080c121,
+    0x007dc9f3, 0x007d4ece, 0x0079237d, 0x0077cf53, 0x0075a8ac, 0x007467ac,
+    0x00732d70, 0x0072c62a, 0x007194a1, 0x006fa549, 0x006e8419, 0x006d68b5,
+    0x006d0b80, 0x006bf790, 0x006ae907, 0x006a3799, 0x0069dfbd, 0x0067dc4c,
+    0x00663d80, 0x0065ec17, 0x00654ac8, 0x00645c85, 0x00637299, 0x00632591,
+    0x006160ff, 0x0060cdb5, 0x005ff401, 0x005ed79e, 0x005d7d42, 0x005c6f35,
+    0x005b2618, 0x005a2553, 0x0059686c, 0x0058ae97, 0x0058345f, 0x005743d5,
+    0x005692c4, 0x00561e46, 0x005538ed, 0x0054c807, 0x005345ef, 0x00523a75,
+    0x00510237, 0x0050cf12, 0x004fd319, 0x004fa170, 0x004f3ed6, 0x004f0de5,
+    0x004e1cae, 0x004cd47b, 0x004c78ae, 0x004c4b19, 0x004bf093, 0x004aba3c,
+    0x004a6360, 0x004a383e, 0x0049e28f, 0x0048417b, 0x0047f043, 0x00474ff2,
+    0x00468b6f, 0x0045f13f, 0x0045a522, 0x0045342c, 0x0044c4a2, 0x0043c5c2,
+    0x00437e49, 0x0043142d, 0x0042ab5c, 0x00422195, 0x0041bbb2, 0x0040f391,
+    0x0040b1e9, 0x00405064, 0x00403024, 0x003f90c2, 0x003f7141, 0x003f1377,
+    0x003e7988, 0x003e5b19, 0x003dc4a5, 0x003da6e4, 0x003d4e4f, 0x003c4a6b,
+    0x003c11d5, 0x003bf5b1, 0x003bbdb9, 0x003b6a88, 0x003b183c, 0x003aabe3,
+    0x003a5ba3, 0x003a0c3e, 0x0038f035, 0x0038d6ec, 0x003859cf, 0x0037f741,
+    0x00377df0, 0x00373622, 0x0036ef0c, 0x0036915f, 0x0036072c, 0x0035d9b7,
+    0x00359615, 0x0035531c, 0x00353cee, 0x0034fad3, 0x00347884, 0x00340dd3,
+    0x003351fd, 0x00333d72, 0x0033148d, 0x0032d7ae, 0x0032c385, 0x00328766,
+    0x00325fa1, 0x00324bd6, 0x0032246e, 0x0031afa5, 0x00319c63, 0x003162f7,
+    0x0030271f, 0x002ff104, 0x002fbb62, 0x002f7499, 0x002ed84a, 0x002e832d,
+    0x002e0e08, 0x002decfb, 0x002ddc87, 0x002dbbc1, 0x002d8af0, 0x002d4a7b,
+    0x002d2a85, 0x002d1a9a, 0x002ceb1e, 0x002c8d50, 0x002c404d, 0x002c3106,
+    0x002c1297, 0x002c0370, 0x002be540, 0x002bb845, 0x002b5f62, 0x002b07e6,
+    0x002ace56, 0x002a791d, 0x002a4eff, 0x002a3319, 0x002a0986, 0x0029d295,
+    0x0029b752, 0x00298137, 0x0029665e, 0x00290975, 0x0028ef35, 0x0028c815,
+    0x0028bb1b, 0x0028a13f, 0x00287ab3, 0x00286dea, 0x002847bf, 0x002808c1,
+    0x00278d0e, 0x00276886, 0x00275051, 0x00274441, 0x0026b5c1, 0x00269e65,
+    0x002692c2, 0x002658fa, 0x00261487, 0x00260936, 0x0025d106, 0x0025a48a,
+    0x00258371, 0x00256292, 0x002541ed, 0x0024e150, 0x0024c18b, 0x0024ac7b,
+    0x0024a1fc, 0x00246380, 0x0024300f, 0x0023f314, 0x0023cade, 0x00237b7e,
+    0x00233729, 0x00231a30, 0x002306fa, 0x0022fd67, 0x0022ea50, 0x0022e0cc,
+    0x0022b188, 0x00227977, 0x00225db3, 0x0022421b, 0x0021f05b, 0x0021e75d,
+    0x0021a01d, 0x0021974a, 0x00213767, 0x00211d9f, 0x0020fb7d, 0x0020e212,
+    0x0020d135, 0x0020c8cd, 0x0020b80b, 0x002096b9, 0x00207de7, 0x002054de,
+    0x00204cb6, 0x00202428, 0x001fec0c, 0x001fc46f, 0x001facda, 0x001f7e17,
+    0x001f765a, 0x001f66ea, 0x001f5f38, 0x001f38f4, 0x001f0b85, 0x001f03ff,
+    0x001ec853, 0x001ec0ee, 0x001eaad3, 0x001e9c28, 0x001e94d8, 0x001e707b,
+    0x001e53a2, 0x001e1380, 0x001dbf9f, 0x001db1d1, 0x001d9d35, 0x001d81e6,
+    0x001d4bdf, 0x001d452c, 0x001d37cf, 0x001d1d3a, 0x001ce89f, 0x001ce219,
+    0x001cd516, 0x001cbb33, 0x001ca7e7, 0x001c94b5, 0x001c87f7, 0x001c6202,
+    0x001c5bb8, 0x001c1743, 0x001c04d0, 0x001bfeb0, 0x001bec5d, 0x001be034,
+    0x001bce09, 0x001ba402, 0x001b9225, 0x001b864a, 0x001b8060, 0x001b6eb1,
+    0x001b62f4, 0x001b516b, 0x001b2e9c, 0x001b1d56, 0x001b0c26, 0x001ae45f,
+    0x001ad917, 0x001ac83d, 0x001aa6c7, 0x001a90a7, 0x001a8027, 0x001a7533,
+    0x001a2ed7, 0x0019fefc, 0x0019e4b0, 0x0019cfcd, 0x0019c569, 0x0019b5e1,
+    0x0019b0b8, 0x0019a149, 0x00196951, 0x00194b30, 0x00194631, 0x00191e84,
+    0x00190adb, 0x00190113, 0x0018e3e6, 0x0018c233, 0x0018aa58, 0x0018a598,
+    0x00189c1e, 0x0018893f, 0x00187b2b, 0x00186d27, 0x001863d8, 0x00185f33,
+    0x001855ef, 0x00184816, 0x001835b7, 0x00182c92, 0x00182802, 0x00181a5c,
+    0x001803c0, 0x0017ff40, 0x0017e8d6, 0x0017d706, 0x0017ce28, 0x0017af52,
+    0x0017997d, 0x00177f7e, 0x00177b2f, 0x00176e4a, 0x001765b9, 0x00176173,
+    0x00173f7a, 0x00172211, 0x001719b7, 0x00170d3c, 0x0016fcad, 0x0016f051,
+    0x0016e81b, 0x0016c372, 0x0016b34c, 0x00169f3c, 0x00169344, 0x00168759,
+    0x00167787, 0x001663e1, 0x00164c7a, 0x0016316a, 0x001629ba, 0x00161e3d,
+    0x001612cc, 0x00160efe, 0x0015da45, 0x0015d68a, 0x0015c3f9, 0x0015b535,
+    0x0015addb, 0x00159445, 0x00158d01, 0x00157e87, 0x001568f5, 0x00155e3c,
+    0x001548ea, 0x001541d8, 0x00153747, 0x00151456, 0x00150309, 0x0014ff97,
+    0x0014e42c, 0x0014b835, 0x0014b182, 0x0014ae2a, 0x00149a32, 0x00149044,
+    0x001489aa, 0x001475f8, 0x00146c2c, 0x00145f2c, 0x001458b2, 0x00144bcb,
+    0x001428a1, 0x00142575, 0x00141f20, 0x00141bf6, 0x00140914, 0x0013dd8b,
+    0x0013da76, 0x0013d13e, 0x0013c80e, 0x0013bee6, 0x0013b8d0, 0x0013afb7,
+    0x0013acb0, 0x00139a9c, 0x0013949c, 0x001382b4, 0x00137fbb, 0x001370ec,
+    0x00136df9, 0x0013567d, 0x00135392, 0x00133c56, 0x001333ae, 0x0013170a,
+    0x0013005f, 0x0012f51d, 0x0012ef81, 0x0012ecb4, 0x0012e71d, 0x0012e453,
+    0x0012c5d9, 0x0012badc, 0x0012aa78, 0x0012a251, 0x001294cb, 0x00129219,
+    0x00128cb7, 0x001284aa, 0x001281fc, 0x001279f9, 0x00126cad, 0x00126a06,
+    0x00125a2f, 0x00124d10, 0x00124a73, 0x00123d6a, 0x00122b4b, 0x00122391,
+    0x00121e6f, 0x001216c0, 0x00120c8c, 0x001204ed, 0x0011fd54, 0x0011e931,
+    0x0011da34, 0x0011d7b6, 0x0011d2be, 0x0011c170, 0x0011ba0f, 0x0011b528,
+    0x0011ab61, 0x00119f37, 0x00119588, 0x00118e4c, 0x00118716, 0x00116cd6,
+    0x001165bb, 0x0011635e, 0x00115797, 0x00114734, 0x0011428b, 0x00113b92,
+    0x001126ca, 0x0011247e, 0x0011190b, 0x0011091d, 0x00110496, 0x00110253,
+    0x0010f70d, 0x0010e75e, 0x0010e2e9, 0x0010da04, 0x0010c624, 0x0010c1c0,
+    0x0010bb2e, 0x0010b8fe, 0x0010b4a1, 0x0010ae19, 0x0010abec, 0x00109eef,
+    0x00109a9f, 0x00108531, 0x00106dde, 0x00106141, 0x00105f29, 0x00105afa,
+    0x001054b7, 0x00104e79, 0x00104c66, 0x0010462e, 0x00102f8b, 0x00102d7f,
+    0x0010275f, 0x00101721, 0x00101112, 0x00100501, 0x00100300, 0x000ffd00,
+    0x000ff10e, 0x000fe13b, 0x000fdf43, 0x000fdb54, 0x000fd572, 0x000fc7c8,
+    0x000fc3e5, 0x000fc1f4, 0x000fb092, 0x000f999f, 0x000f9023, 0x000f8a78,
+    0x000f8895, 0x000f7f2e, 0x000f7d4e, 0x000f73f5, 0x000f7217, 0x000f68cb,
+    0x000f633d, 0x000f6163, 0x000f582b, 0x000f5654, 0x000f4d2a, 0x000f47af,
+    0x000f4066, 0x000f2555, 0x000f1c64, 0x000f1a9b, 0x000f11b7, 0x000f0aa2,
+    0x000f0556, 0x000efc8b, 0x000eecd1, 0x000ee79a, 0x000edd38, 0x000ed2e4,
+    0x000ed12c, 0x000ec1cd, 0x000ebcb4, 0x000eb950, 0x000eb43d, 0x000eaf2d,
+    0x000ea014, 0x000e9e68, 0x000e9614, 0x000e8a7a, 0x000e8587, 0x000e823d,
+    0x000e8098, 0x000e7d4f, 0x000e69bb, 0x000e681c, 0x000e5e68, 0x000e5993,
+    0x000e4cbf, 0x000e465e, 0x000e4199, 0x000e3cd8, 0x000e2ea5, 0x000e221e,
+    0x000e208f, 0x000e1d71, 0x000e18c7, 0x000e173a, 0x000e1294, 0x000e0df1,
+    0x000e063e, 0x000e01a4, 0x000df878, 0x000def57, 0x000de1bd, 0x000de03c,
+    0x000ddbba, 0x000dd8bb, 0x000dcb4d, 0x000dc55d, 0x000db3ad, 0x000db0be,
+    0x000daf48, 0x000dac5b, 0x000da7fb, 0x000da686, 0x000d9dd0, 0x000d9aeb,
+    0x000d90d3, 0x000d7b64, 0x000d744e, 0x000d7011, 0x000d67a0, 0x000d5dd3,
+    0x000d59a4, 0x000d52b2, 0x000d4a65, 0x000d4904, 0x000d4642, 0x000d4222,
+    0x000d3ca6, 0x000d388c, 0x000d31bc, 0x000d3060, 0x000d2da9, 0x000d2430,
+    0x000d2025, 0x000d1c1d, 0x000d196e, 0x000d156a, 0x000d1413, 0x000d0d68,
+    0x000d0c14, 0x000d0179, 0x000cf990, 0x000cf44f, 0x000ce88d, 0x000ce5f3,
+    0x000ce20e, 0x000cda4b, 0x000cd901, 0x000cd524, 0x000cd149, 0x000ccd70,
+    0x000cbb9c, 0x000cb7d0, 0x000caefe, 0x000cac7b, 0x000ca778, 0x000ca13a,
+    0x000c9c40, 0x000c94d0, 0x000c89b8, 0x000c8744, 0x000c860a, 0x000c8397,
+    0x000c74fa, 0x000c6db8, 0x000c6a1a, 0x000c68e6, 0x000c5f4e, 0x000c5bb8,
+    0x000c5825, 0x000c4fd5, 0x000c49ec, 0x000c41b0, 0x000c3f57, 0x000c2ddc,
+    0x000c2a63, 0x000c26ec, 0x000c2377, 0x000c1ede, 0x000c1b6e, 0x000c1924,
+    0x000c17ff, 0x000c1128, 0x000c0dbf, 0x000c0b7a, 0x000c0a58, 0x000c06f4,
+    0x000bfa92, 0x000bf736, 0x000bf618, 0x000bf3dc, 0x000be9d9, 0x000be8bd,
+    0x000be686, 0x000bdfe6, 0x000bdecc, 0x000bdb80, 0x000bd94e, 0x000bcb1d,
+    0x000bc7db, 0x000bc49b, 0x000bc272, 0x000bbe21, 0x000bb8c1, 0x000ba7ad,
+    0x000b9f36, 0x000b9e28, 0x000b9aff, 0x000b98e4, 0x000b97d7, 0x000b95be,
+    0x000b94b2, 0x000b8f77, 0x000b882d, 0x000b850f, 0x000b82fd, 0x000b7eda,
+    0x000b79b3, 0x000b769e, 0x000b6c63, 0x000b6a59, 0x000b6955, 0x000b6648,
+    0x000b5722, 0x000b5520, 0x000b511e, 0x000b4c1f, 0x000b4922, 0x000b4627,
+    0x000b4230, 0x000b3f38, 0x000b394d, 0x000b3756, 0x000b3463, 0x000b3368,
+    0x000b3078, 0x000b2e84, 0x000b2b97, 0x000b2a9d, 0x000b25c0, 0x000b24c8,
+    0x000b1d0a, 0x000b1a26, 0x000b108d, 0x000b0ea4, 0x000b08ec, 0x000b0247,
+    0x000af515, 0x000af246, 0x000ae8f1, 0x000ae715, 0x000adec0, 0x000adb10,
+    0x000ad84e, 0x000ad678, 0x000ad3b8, 0x000acd52, 0x000aca97, 0x000ac7dd,
+    0x000ac354, 0x000ac26d, 0x000abde9, 0x000ab883, 0x000ab4ed, 0x000ab074,
+    0x000aaf90, 0x000aab1c, 0x000aa78f, 0x000aa23f, 0x000a9dd6, 0x000a9350,
+    0x000a9270, 0x000a90b1, 0x000a8d35, 0x000a8a9a, 0x000a88de, 0x000a8567,
+    0x000a7da4, 0x000a7959, 0x000a76c8, 0x000a7438, 0x000a735d, 0x000a70ce,
+    0x000a6c8e, 0x000a6779, 0x000a66a0, 0x000a6268, 0x000a5fe2, 0x000a5d5c,
+    0x000a5ad9, 0x000a5780, 0x000a54ff, 0x000a50d5, 0x000a4e57, 0x000a4d83,
+    0x000a4b06, 0x000a488b, 0x000a4611, 0x000a41f4, 0x000a3eab, 0x000a34dd,
+    0x000a326d, 0x000a2985, 0x000a28b7, 0x000a217a, 0x000a1fe0, 0x000a1cad,
+    0x000a18b0, 0x000a0ccc, 0x000a09a5, 0x000a0294, 0x000a0104, 0x000a003c,
+    0x0009fc55, 0x0009f9ff, 0x0009f938, 0x0009f6e4, 0x0009f557, 0x0009ee63,
+    0x0009eb4f, 0x0009e6b4, 0x0009dfd4, 0x0009d9c0, 0x0009d77a, 0x0009d6b9,
+    0x0009d231, 0x0009cfef, 0x0009cc2e, 0x0009cb6e, 0x0009c7b0, 0x0009c6f0,
+    0x0009c4b3, 0x0009c0fb, 0x0009bbca, 0x0009ba4f, 0x0009b178, 0x0009b0bc,
+    0x0009aae1, 0x0009aa26, 0x0009a681, 0x0009a5c7, 0x0009a226, 0x00099aeb,
+    0x0009997a, 0x000998c2, 0x00099752, 0x00099473, 0x00098eba, 0x00098c96,
+    0x00098a74, 0x000989be, 0x0009857c, 0x00097fd5, 0x00097d04, 0x00097b9c,
+    0x00097981, 0x00096f07, 0x00096e55, 0x00096add, 0x00096a2c, 0x00096818,
+    0x000966b7, 0x000964a5, 0x00096294, 0x00095fd4, 0x00095dc5, 0x00095c67,
+    0x0009584d, 0x00095641, 0x00095389, 0x00094f77, 0x00094e1c, 0x00094962,
+    0x00094559, 0x000941ff, 0x000939fd, 0x000937ff, 0x00093405, 0x00093209,
+    0x00093160, 0x00092a22, 0x00092783, 0x000921a2, 0x00091e62, 0x00091c6f,
+    0x000917e7, 0x0009169d, 0x000915f8, 0x00091409, 0x000910d2, 0x00090e41,
+    0x00090c55, 0x00090b0e, 0x00090924, 0x0008ff9d, 0x0008fb31, 0x0008f80c,
+    0x0008f76b, 0x0008f3a8, 0x0008f087, 0x0008efe7, 0x0008eaec, 0x0008ea4d,
+    0x0008e4ba, 0x0008dd56, 0x0008d7d3, 0x0008d5fe, 0x0008d120, 0x0008cbac,
+    0x0008c9dc, 0x0008c942, 0x0008c3d7, 0x0008c2a4, 0x0008c0d8, 0x0008c03f,
+    0x0008bd42, 0x0008bae0, 0x0008b7e7, 0x0008b61f, 0x0008b458, 0x0008b1fb,
+    0x0008b0cc, 0x0008af07, 0x0008ae71, 0x0008ab80, 0x0008aaea, 0x0008a766,
+    0x0008a63a, 0x0008a47a, 0x0008a2ba, 0x0008a225, 0x00089ea8, 0x00089d7f,
+    0x00089972, 0x00089442, 0x0008931b, 0x00089163, 0x00088baa, 0x00088a86,
+    0x0008883f, 0x0008868b, 0x00088568, 0x00088324, 0x00088202, 0x00087e0f,
+    0x00087c5e, 0x00087b3e, 0x00087751, 0x000873f6, 0x000872d9, 0x0008724a,
+    0x000869f6, 0x000868db, 0x0008623f, 0x00086099, 0x00085ef5, 0x00085bad,
+    0x00085868, 0x0008549b, 0x000852fb, 0x000851e6, 0x0008515b, 0x00085047,
+    0x00084b6d, 0x000849d1, 0x0008469a, 0x00084476, 0x000842dd, 0x000841cc,
+    0x00083e9b, 0x00083e13, 0x00083ae5, 0x000832fd, 0x00082ecb, 0x00082e45,
+    0x00082cb4, 0x000826fa, 0x00082359, 0x000821cc, 0x00081f37, 0x00081c21,
+    0x00081a97, 0x00081a13, 0x0008190d, 0x00081701, 0x00081473, 0x000812ec,
+    0x00081165, 0x00080b4f, 0x000807c7, 0x00080644, 0x00080543, 0x00080341,
+    0x00080040, 0x0007fbc2, 0x0007f945, 0x0007f8c6, 0x0007f64b, 0x0007f5cd,
+    0x0007f4cf, 0x0007f354, 0x0007ee67, 0x0007eced, 0x0007ebf2, 0x0007e885,
+    0x0007e78b, 0x0007e70e, 0x0007e615, 0x0007e2ad, 0x0007e138, 0x0007de50,
+    0x0007d886, 0x0007d61f, 0x0007d4af, 0x0007d2c5, 0x0007d062, 0x0007cfe8,
+    0x0007c8c7, 0x0007c7d5, 0x0007c66a, 0x0007c5f1, 0x0007c31d, 0x0007c22c,
+    0x0007bee3, 0x0007bd7b, 0x0007b58e, 0x0007b2c6, 0x0007b0ec, 0x0007af8a,
+    0x0007ad3c, 0x0007acc6, 0x0007abda, 0x0007a744, 0x0007a4fb, 0x0007a328,
+    0x00079f85, 0x00079f10, 0x00079ccc, 0x000799a2, 0x000798bb, 0x00079848,
+    0x00079595, 0x0007943c, 0x000790a6, 0x00078f4f, 0x00078d86, 0x00078ca2,
+    0x00078adb, 0x000789f7, 0x000788a3, 0x000786dd, 0x00078589, 0x00078436,
+    0x00078191, 0x0007803f, 0x00077f5e, 0x00077e0d, 0x00077cbd, 0x00077afd,
+    0x0007770f, 0x00077631, 0x000771da, 0x000770fc, 0x00076e64, 0x00076df6,
+    0x00076bcf, 0x00076a84, 0x00076a16, 0x000767f1, 0x00076560, 0x000764f3,
+    0x00076418, 0x00075fd6, 0x00075e90, 0x00075838, 0x000756f5, 0x0007561d,
+    0x0007546f, 0x00075257, 0x00074fd4, 0x00074e94, 0x00074e29, 0x00074857,
+    0x000747ed, 0x000746af, 0x000745dc, 0x00074572, 0x00074225, 0x00073fae,
+    0x00073f45, 0x00073e0a, 0x00073bfe, 0x00073a5c, 0x00073579, 0x0007330a,
+    0x000731d4, 0x00072e32, 0x00072cfd, 0x00072c2f, 0x00072960, 0x0007282c,
+    0x0007275f, 0x000724fa, 0x00072362, 0x00072230, 0x00071fcf, 0x00071f04,
+    0x00071dd4, 0x00071b75, 0x00071a46, 0x000717e9, 0x00071785, 0x00071461,
+    0x00071079, 0x00070fb1, 0x00070f4e, 0x00070d5c, 0x000709de, 0x00070852,
+    0x0007078d, 0x000704da, 0x00070415, 0x000703b2, 0x0007028b, 0x0006fe55,
+    0x0006fd30, 0x0006fa85, 0x0006f961, 0x0006f83d, 0x0006f658, 0x0006f535,
+    0x0006f4d4, 0x0006f2f1, 0x0006f290, 0x0006f1cf, 0x0006f16f, 0x0006ed4d,
+    0x0006eced, 0x0006ec2d, 0x0006eb0e, 0x0006e9ef, 0x0006e7b2, 0x0006e694,
+    0x0006e3fa, 0x0006e220, 0x0006dfe8, 0x0006decd, 0x0006dd54, 0x0006dc97,
+    0x0006d5ff, 0x0006d371, 0x0006d143, 0x0006d02c, 0x0006cf73, 0x0006ce5c,
+    0x0006ce00, 0x0006cbd5, 0x0006cac0, 0x0006c897, 0x0006c5b8, 0x0006c55c,
+    0x0006c392, 0x0006c225, 0x0006be3a, 0x0006bddf, 0x0006bbbe, 0x0006baaf,
+    0x0006b9f9, 0x0006b8ea, 0x0006b5be, 0x0006b564, 0x0006b349, 0x0006b23c,
+    0x0006b188, 0x0006af6f, 0x0006ae0a, 0x0006acff, 0x0006aae8, 0x0006aa37,
+    0x0006a92c, 0x0006a719, 0x0006a60f, 0x0006a5b7, 0x0006a3a5, 0x0006a195,
+    0x0006a0e5, 0x00069e7f, 0x00069d78, 0x00069abd, 0x000699b7, 0x00069960,
+    0x000697ad, 0x00069652, 0x00069346, 0x00069243, 0x00068c8c, 0x00068c36,
+    0x00068789, 0x00068734, 0x0006838c, 0x0006828e, 0x00068239, 0x00068092,
+    0x00067e97, 0x00067e43, 0x00067d46, 0x00067c9e, 0x00067b4d, 0x000677b3,
+    0x000676b8, 0x00067665, 0x000674c3, 0x00067376, 0x000672d0, 0x000671d6,
+    0x0006708a, 0x00066fe5, 0x00066df4, 0x00066b0d, 0x0006691f, 0x000665eb,
+    0x00066547, 0x00066452, 0x0006635d, 0x00066217, 0x00066174, 0x00066123,
+    0x00065e98, 0x00065cb2, 0x00065c61, 0x00065acd, 0x0006598a, 0x000657f7,
+    0x000657a7, 0x00065706, 0x00065615, 0x000653e4, 0x00065204, 0x00064e97,
+    0x00064d59, 0x00064904, 0x000648b5, 0x00064817, 0x00064503, 0x00064466,
+    0x00064417, 0x0006437a, 0x00064156, 0x00063fcf, 0x00063dfb, 0x00063dad,
+    0x00063bda, 0x0006396d, 0x00063920, 0x000634e6, 0x000633b2, 0x00063066,
+    0x00062f34, 0x00062e9b, 0x00062db6, 0x00062cd1, 0x00062abc, 0x00062a24,
+    0x000628f4, 0x0006272d, 0x0006264a, 0x00062567, 0x000624d0, 0x000621df,
+    0x00062148, 0x00061ea5, 0x00061e5a, 0x00061c99, 0x00061bb9, 0x00061b24,
+    0x00061a45, 0x0006183c, 0x000615a0, 0x0006142f, 0x00061307, 0x00061196,
+    0x00060cff, 0x00060c24, 0x00060ab7, 0x000609dc, 0x00060901, 0x000608b8,
+    0x000607de, 0x00060599, 0x000604bf, 0x00060477, 0x000602c5, 0x000601ec,
+    0x0005fdfc, 0x0005fdb4, 0x0005fc4e, 0x0005fb2f, 0x0005f8f4, 0x0005f81e,
+    0x0005f701, 0x0005f62c, 0x0005f4c9, 0x0005f177, 0x0005eeb6, 0x0005ed56,
+    0x0005ed10, 0x0005ebb1, 0x0005eb6b, 0x0005e9c7, 0x0005e93b, 0x0005e86a,
+    0x0005e5b1, 0x0005e526, 0x0005e4e0, 0x0005e340, 0x0005e0d1, 0x0005df78,
+    0x0005df33, 0x0005ddda, 0x0005dd95, 0x0005dd0c, 0x0005da5d, 0x0005d83a,
+    0x0005d4c4, 0x0005d43c, 0x0005d32c, 0x0005d261, 0x0005d1d9, 0x0005d043,
+    0x0005cf79, 0x0005ce6b, 0x0005ccd7, 0x0005cb43, 0x0005ca7a, 0x0005c9f4,
+    0x0005c8e8, 0x0005c609, 0x0005c5c7, 0x0005c3b2, 0x0005c1e2, 0x0005c096,
+    0x0005bfd0, 0x0005be44, 0x0005bcb8, 0x0005baec, 0x0005ba27, 0x0005b9a4,
+    0x0005b716, 0x0005b693, 0x0005b50c, 0x0005b448, 0x0005b407, 0x0005b344,
+    0x0005b282, 0x0005b07b, 0x0005af78, 0x0005acb2, 0x0005ac72, 0x0005a8ef,
+    0x0005a7ef, 0x0005a72f, 0x0005a6af, 0x0005a431, 0x0005a3b2, 0x0005a235,
+    0x00059f3d, 0x00059cc6, 0x00059c48, 0x00059b4c, 0x00059a12, 0x000599d3,
+    0x000597de, 0x000597a0, 0x00059629, 0x000594b3, 0x00059093, 0x00059055,
+    0x00058fd9, 0x00058f1f, 0x00058dad, 0x00058cf4, 0x00058c3b, 0x00058b45,
+    0x00058a8d, 0x00058a12, 0x000589d5, 0x0005891d, 0x0005863f, 0x000585c5,
+    0x00058364, 0x00058234, 0x0005817e, 0x000580c8, 0x00057f21, 0x00057ea8,
+    0x00057df3, 0x00057d3e, 0x00057d02, 0x00057b99, 0x00057ae5, 0x000579b8,
+    0x0005797c, 0x00057851, 0x0005779e, 0x00057549, 0x000574d2, 0x000571cd,
+    0x00057157, 0x0005711b, 0x0005706a, 0x00056de0, 0x00056da5, 0x00056ae4,
+    0x00056a6e, 0x000569be, 0x00056984, 0x0005690f, 0x0005685f, 0x000565a3,
+    0x000564f4, 0x0005640b, 0x00056397, 0x0005635d, 0x00055f85, 0x00055ed7,
+    0x00055df1, 0x00055c25, 0x00055acc, 0x00055a93, 0x00055974, 0x0005593b,
+    0x0005581d, 0x00055772, 0x0005568e, 0x0005561c, 0x00055538, 0x000553e3,
+    0x00055174, 0x000550ca, 0x00054f3f, 0x00054ecf, 0x00054bf4, 0x00054b83,
+    0x00054b4b, 0x000549fb, 0x000548e4, 0x00054805, 0x00054795, 0x000546b6,
+    0x00054568, 0x000544f9, 0x00054375, 0x000542cf, 0x00054115, 0x0005406f,
+    0x00053f93, 0x00053f24, 0x00053e7f, 0x00053dda, 0x00053cff, 0x00053c5a,
+    0x00053b48, 0x00053a00, 0x000539ca, 0x00053926, 0x00053882, 0x000536cf,
+    0x000535f5, 0x00053552, 0x000534b0, 0x0005336b, 0x0005325d, 0x00053227,
+    0x00053185, 0x00052fa0, 0x00052f34, 0x00052e93, 0x00052df2, 0x00052d51,
+    0x00052c10, 0x00052a2f, 0x0005295a, 0x000528ba, 0x000527b0, 0x000526dc,
+    0x000524ff, 0x00052495, 0x00052323, 0x00052285, 0x000520ab, 0x00051fa4,
+    0x00051ed2, 0x00051dcc, 0x00051c92, 0x00051c5e, 0x00051bc1, 0x00051a88,
+    0x00051950, 0x000515ab, 0x00051543, 0x000514a9, 0x000513da, 0x00051373,
+    0x000512d9, 0x000512a5, 0x0005123e, 0x00051070, 0x00050f3c, 0x00050ea3,
+    0x00050dd6, 0x00050d3d, 0x00050ca4, 0x00050c3e, 0x00050a74, 0x00050a41,
+    0x000509dc, 0x000509a9, 0x00050749, 0x000506e4, 0x0005064c, 0x000505b5,
+    0x00050454, 0x00050163, 0x000500cd, 0x00050069, 0x0004ffd3, 0x0004fea7,
+    0x0004fe11, 0x0004fc20, 0x0004fbbc, 0x0004faf6, 0x0004fa92, 0x0004f9cc,
+    0x0004f938, 0x0004f8a3, 0x0004f841, 0x0004f55d, 0x0004f52c, 0x0004f437,
+    0x0004f310, 0x0004f24c, 0x0004f158, 0x0004f095, 0x0004ee4c, 0x0004edba,
+    0x0004ec97, 0x0004ec36, 0x0004eae3, 0x0004ea82, 0x0004e9f1, 0x0004e9c1,
+    0x0004e71f, 0x0004e5cf, 0x0004e44f, 0x0004e41f, 0x0004e301, 0x0004e271,
+    0x0004e212, 0x0004e036, 0x0004df48, 0x0004deba, 0x0004de2c, 0x0004dd9d,
+    0x0004dce0, 0x0004dbf4, 0x0004dad9, 0x0004d98f, 0x0004d8a4, 0x0004d75c,
+    0x0004d5e5, 0x0004d49e, 0x0004d3b5, 0x0004d26f, 0x0004d1e4, 0x0004d070,
+    0x0004cfe5, 0x0004cf2c, 0x0004cea1, 0x0004cd30, 0x0004cb64, 0x0004ca7e,
+    0x0004ca50, 0x0004c9c7, 0x0004c96b, 0x0004c93d, 0x0004c8e1, 0x0004c7cf,
+    0x0004c7a1, 0x0004c6bd, 0x0004c68f, 0x0004c607, 0x0004c412, 0x0004c38a,
+    0x0004c35c, 0x0004c302, 0x0004c16a, 0x0004c0b5, 0x0004bfd4, 0x0004bf1f,
+    0x0004bd30, 0x0004bd03, 0x0004bc23, 0x0004ba90, 0x0004b957, 0x0004b8fe,
+    0x0004b8d1, 0x0004b878, 0x0004b6e8, 0x0004b6bb, 0x0004b662, 0x0004b5dd,
+    0x0004b52c, 0x0004b44e, 0x0004b422, 0x0004b18c, 0x0004b134, 0x0004aea1,
+    0x0004ae75, 0x0004ad9a, 0x0004ad6e, 0x0004abe5, 0x0004ab8d, 0x0004aa05,
+    0x0004a983, 0x0004a853, 0x0004a77a, 0x0004a74f, 0x0004a6f8, 0x0004a548,
+    0x0004a241, 0x0004a1c0, 0x0004a16a, 0x0004a0ea, 0x00049fbe, 0x00049f69,
+    0x00049dbe, 0x00049ce9, 0x00049bbf, 0x000499ed, 0x0004996e, 0x00049944,
+    0x000496ca, 0x000495ce, 0x000494fc, 0x00049382, 0x00049359, 0x00049305,
+    0x000491e0, 0x00049163, 0x00048f99, 0x00048e23, 0x00048df9, 0x00048d00,
+    0x00048c84, 0x00048c31, 0x00048b8c, 0x00048b39, 0x00048a94, 0x00048a19,
+    0x0004894b, 0x00048922, 0x0004882b, 0x000486ba, 0x000485ed, 0x000484cf,
+    0x00048389, 0x0004826c, 0x0004821a, 0x000481a0, 0x00048127, 0x000480fe,
+    0x00048084, 0x00048033, 0x0004800b, 0x00047dd5, 0x00047dac, 0x00047b79,
+    0x00047b00, 0x00047ad8, 0x00047a88, 0x00047a10, 0x000478f7, 0x000478a7,
+    0x000477b8, 0x000476a0, 0x00047562, 0x0004744c, 0x000473fd, 0x00047386,
+    0x000472e7, 0x00047271, 0x00047222, 0x000471ab, 0x00047135, 0x000470be,
+    0x00047021, 0x00046fd2, 0x00046f34, 0x00046ee6, 0x00046dd3, 0x00046c99,
+    0x00046bfd, 0x00046b88, 0x00046b39, 0x00046a4f, 0x000469b3, 0x0004687c,
+    0x00046855, 0x00046793, 0x000466f8, 0x000466ab, 0x00046636, 0x00046440,
+    0x000463cc, 0x0004630c, 0x00046272, 0x00046225, 0x000461b2, 0x000460cc,
+    0x00045fc0, 0x00045d83, 0x00045d37, 0x00045c2c, 0x00045a8b, 0x000459f3,
+    0x00045910, 0x000458c4, 0x00045853, 0x000457bc, 0x00045700, 0x0004568f,
+    0x00045587, 0x000454cc, 0x0004545b, 0x00045436, 0x0004537a, 0x0004529a,
+    0x000451ba, 0x000450b5, 0x00045045, 0x00044fd6, 0x00044e87, 0x00044dce,
+    0x00044d5f, 0x00044ccb, 0x00044b7f, 0x00044b35, 0x00044ac6, 0x00044aa1,
+    0x00044a33, 0x0004497b, 0x00044956, 0x0004489f, 0x0004480c, 0x0004479e,
+    0x00044730, 0x00044679, 0x00044655, 0x0004450c, 0x00044456, 0x00044432,
+    0x00044357, 0x0004430f, 0x000442a2, 0x00044211, 0x0004415b, 0x00044082,
+    0x00043f85, 0x00043ead, 0x00043e65, 0x00043dd5, 0x00043d21, 0x00043cb5,
+    0x00043c4a, 0x00043ae3, 0x00043a9c, 0x000439a2, 0x00043884, 0x0004378b,
+    0x000436d9, 0x0004364b, 0x0004359a, 0x000434c6, 0x000434a2, 0x00043364,
+    0x000432fa, 0x00043227, 0x00043177, 0x000430a4, 0x00043081, 0x0004303b,
+    0x00043018, 0x00042f46, 0x00042edd, 0x00042e97, 0x00042e0b, 0x00042dc5,
+    0x00042ac7, 0x00042a81, 0x00042a5e, 0x00042a19, 0x000429f6, 0x00042949,
+    0x0004287a, 0x00042812, 0x000427aa, 0x000426b9, 0x00042674, 0x0004260c,
+    0x000425a5, 0x0004253e, 0x000424b5, 0x0004244e, 0x000421e6, 0x000420b3,
+    0x0004206e, 0x00042008, 0x00041fe6, 0x00041f1a, 0x00041eb4, 0x00041e4f,
+    0x00041de9, 0x00041da5, 0x00041cb8, 0x00041b45, 0x00041a7a, 0x00041a59,
+    0x0004192a, 0x00041882, 0x0004181e, 0x0004166a, 0x000414da, 0x00041497,
+    0x00041476, 0x00041434, 0x00041412, 0x000413d0, 0x000412e7, 0x000412a5,
+    0x00041241, 0x000411de, 0x0004115a, 0x00041051, 0x00040f8b, 0x00040f6a,
+    0x00040cb7, 0x00040c76, 0x00040c55, 0x00040c14, 0x00040a8b, 0x00040a29,
+    0x000409c7, 0x000409a7, 0x00040881, 0x00040840, 0x0004075d, 0x000406fc,
+    0x00040536, 0x00040414, 0x00040332, 0x000402d1, 0x00040231, 0x00040170,
+    0x00040150, 0x000400f0, 0x00040030, 0x0003fe50, 0x0003fdf1, 0x0003fdb1,
+    0x0003fd51, 0x0003fcf2, 0x0003fc13, 0x0003fbd4, 0x0003fbb4, 0x0003fa38,
+    0x0003f9f9, 0x0003f99a, 0x0003f93b, 0x0003f7a1, 0x0003f704, 0x0003f5e9,
+    0x0003f58b, 0x0003f50e, 0x0003f4b0, 0x0003f452, 0x0003f27e, 0x0003f23f,
+    0x0003f185, 0x0003f0ca, 0x0003f0ab, 0x0003efb3, 0x0003ef94, 0x0003ef37,
+    0x0003eef9, 0x0003ee40, 0x0003ed2a, 0x0003ed0b, 0x0003ecaf, 0x0003ec71,
+    0x0003eae1, 0x0003ea29, 0x0003e9cd, 0x0003e916, 0x0003e8d9, 0x0003e76a,
+    0x0003e5fd, 0x0003e547, 0x0003e4ec, 0x0003e4cd, 0x0003e418, 0x0003e270,
+    0x0003e1f8, 0x0003e1bb, 0x0003e161, 0x0003e0ad, 0x0003e08e, 0x0003df80,
+    0x0003df26, 0x0003deea, 0x0003de90, 0x0003de37, 0x0003dd0c, 0x0003dc1d,
+    0x0003dbff, 0x0003dba6, 0x0003db4d, 0x0003da41, 0x0003d9ad, 0x0003d954,
+    0x0003d936, 0x0003d8fb, 0x0003d885, 0x0003d82c, 0x0003d7d3, 0x0003d671,
+    0x0003d586, 0x0003d52e, 0x0003d4b8, 0x0003d426, 0x0003d3ce, 0x0003d301,
+    0x0003d1c0, 0x0003d14b, 0x0003d062, 0x0003d00b, 0x0003cfee, 0x0003cf3f,
+    0x0003cf05, 0x0003cee8, 0x0003cdaa, 0x0003cd36, 0x0003cc32, 0x0003ca49,
+    0x0003ca2c, 0x0003c9d6, 0x0003c8d4, 0x0003c89b, 0x0003c845, 0x0003c7ef,
+    0x0003c77d, 0x0003c6ee, 0x0003c67c, 0x0003c57b, 0x0003c526, 0x0003c4ed,
+    0x0003c4d1, 0x0003c498, 0x0003c427, 0x0003c344, 0x0003c327, 0x0003c27e,
+    0x0003c1d4, 0x0003c180, 0x0003c082, 0x0003c04a, 0x0003bff5, 0x0003bfa1,
+    0x0003bf4d, 0x0003bf30, 0x0003bedc, 0x0003be34, 0x0003bda8, 0x0003bc90,
+    0x0003bbe9, 0x0003baee, 0x0003bab7, 0x0003ba63, 0x0003ba47, 0x0003b969,
+    0x0003b94e, 0x0003b8c3, 0x0003b801, 0x0003b7ca, 0x0003b62c, 0x0003b610,
+    0x0003b587, 0x0003b4e2, 0x0003b4c6, 0x0003b37d, 0x0003b32b, 0x0003b250,
+    0x0003b1e3, 0x0003b15a, 0x0003b13f, 0x0003b09c, 0x0003af70, 0x0003af1f,
+    0x0003af04, 0x0003ae2b, 0x0003ad1c, 0x0003ac95, 0x0003ac7a, 0x0003abd8,
+    0x0003ab37, 0x0003aa45, 0x0003a9bf, 0x0003a91e, 0x0003a8cd, 0x0003a8b2,
+    0x0003a82d, 0x0003a812, 0x0003a7c2, 0x0003a73c, 0x0003a64c, 0x0003a632,
+    0x0003a592, 0x0003a542, 0x0003a50d, 0x0003a4bd, 0x0003a4a3, 0x0003a365,
+    0x0003a1f3, 0x0003a1d8, 0x0003a1a3, 0x0003a189, 0x0003a105, 0x0003a0eb,
+    0x0003a018, 0x00039f7b, 0x00039f12, 0x00039df2, 0x00039dd8, 0x00039d89,
+    0x00039d55, 0x00039d3b, 0x00039cb8, 0x00039c6a, 0x00039b65, 0x00039ac9,
+    0x00039a47, 0x000399e0, 0x00039944, 0x000398f6, 0x000398a9, 0x0003985b,
+    0x00039828, 0x0003973f, 0x00039725, 0x000396f2, 0x00039657, 0x00039570,
+    0x00039556, 0x000394bc, 0x0003946f, 0x0003943c, 0x00039423, 0x00039356,
+    0x000392bd, 0x00039223, 0x00039171, 0x0003913e, 0x000390d8, 0x00038ff4,
+    0x00038fc1, 0x00038f29, 0x00038e78, 0x00038e2c, 0x00038de0, 0x00038dad,
+    0x00038d48, 0x00038cfd, 0x00038cca, 0x00038bcf, 0x00038b38, 0x00038aba,
+    0x00038a0b, 0x000389d9, 0x000389c0, 0x000388f8, 0x000388df, 0x00038849,
+    0x000386d3, 0x000386a1, 0x00038657, 0x0003852d, 0x00038435, 0x0003830d,
+    0x00038292, 0x0003822f, 0x0003819b, 0x00038121, 0x0003808d, 0x00038044,
+    0x00037fb1, 0x00037f1e, 0x00037ed5, 0x00037e73, 0x00037db0, 0x00037d05,
+    0x00037cbc, 0x00037c8c, 0x00037c43, 0x00037a8e, 0x0003799c, 0x00037924,
+    0x000377ba, 0x0003772a, 0x00037712, 0x000376e2, 0x000376ca, 0x0003757b,
+    0x000374eb, 0x00037444, 0x000373fd, 0x000372f7, 0x00037297, 0x00037268,
+    0x00037192, 0x0003714b, 0x000370a5, 0x00036fd0, 0x00036fa1, 0x00036f5a,
+    0x00036f43, 0x00036efc, 0x00036d6c, 0x00036c99, 0x00036c81, 0x00036bc6,
+    0x00036b80, 0x00036aad, 0x00036a96, 0x0003697e, 0x00036950, 0x00036938,
+    0x000368f3, 0x00036867, 0x00036821, 0x00036796, 0x00036722, 0x000366c6,
+    0x00036680, 0x000365c8, 0x0003653d, 0x000364e1, 0x0003646e, 0x000363cd,
+    0x00036202, 0x000361bd, 0x000361a7, 0x00036162, 0x00036134, 0x000360ab,
+    0x0003600c, 0x00035fde, 0x00035fc7, 0x00035f9a, 0x00035f83, 0x00035f56,
+    0x00035efb, 0x00035eb7, 0x00035e45, 0x00035e01, 0x00035dbd, 0x00035da6,
+    0x00035d62, 0x00035d1e, 0x00035cdb, 0x00035c53, 0x00035c0f, 0x00035b01,
+    0x00035a90, 0x00035a7a, 0x00035a09, 0x000359c6, 0x0003593f, 0x000358fc,
+    0x000358b9, 0x0003581c, 0x000357d9, 0x00035796, 0x00035553, 0x00035475,
+    0x00035432, 0x000353c3, 0x000353ad, 0x0003533f, 0x000352e6, 0x00035278,
+    0x000351f3, 0x0003516f, 0x00035159, 0x00035117, 0x000350eb, 0x00035051,
+    0x00034fa2, 0x00034f4a, 0x00034ec7, 0x00034e85, 0x00034d95, 0x00034d7f,
+    0x00034d12, 0x00034cbb, 0x00034c7a, 0x00034b8a, 0x00034b75, 0x00034a86,
+    0x00034a45, 0x000349ef, 0x00034982, 0x00034901, 0x0003487f, 0x0003486a,
+    0x000347fe, 0x000347be, 0x0003473d, 0x00034727, 0x000346fc, 0x00034666,
+    0x000345fb, 0x000345e5, 0x000345a5, 0x000344e4, 0x000344ba, 0x0003443a,
+    0x000343e4, 0x00034324, 0x000342a5, 0x00034265, 0x00034225, 0x000341fb,
+    0x000341bb, 0x0003417c, 0x000340e7, 0x000340bd, 0x000340a8, 0x00034029,
+    0x00033faa, 0x00033f80, 0x00033f41, 0x00033e83, 0x00033dc6, 0x00033d48,
+    0x00033d33, 0x00033c8b, 0x00033c0d, 0x00033bba, 0x00033afe, 0x00033a96,
+    0x00033987, 0x0003395d, 0x0003391f, 0x000338cc, 0x0003388e, 0x0003384f,
+    0x00033826, 0x00033811, 0x000337aa, 0x000336db, 0x000336b1, 0x00033673,
+    0x00033621, 0x000335f8, 0x0003352a, 0x000334c3, 0x000334ae, 0x00033351,
+    0x0003333d, 0x00033314, 0x0003321f, 0x0003320a, 0x00033190, 0x00033115,
+    0x000330b0, 0x00033073, 0x0003305e, 0x00032fe4, 0x00032eb4, 0x00032e77,
+    0x00032dfe, 0x00032d5c, 0x00032ce3, 0x00032ccf, 0x00032bf1, 0x00032b3c,
+    0x00032ac4, 0x00032a38, 0x000329d4, 0x000329c0, 0x00032948, 0x000328d0,
+    0x000328a8, 0x00032894, 0x0003286c, 0x00032830, 0x000327b9, 0x000327a5,
+    0x00032706, 0x00032653, 0x0003263f, 0x000324b3, 0x00032464, 0x000323c6,
+    0x0003238b, 0x0003233c, 0x000322da, 0x000322c6, 0x0003229f, 0x000321ee,
+    0x000321a0, 0x0003213e, 0x000320ef, 0x0003207a, 0x00032053, 0x00031fa3,
+    0x00031f8f, 0x00031ee0, 0x00031e7f, 0x00031e6b, 0x00031e44, 0x00031e31,
+    0x00031e0a, 0x00031dbc, 0x00031cad, 0x00031c99, 0x00031c5f, 0x00031b8b,
+    0x00031b17, 0x00031add, 0x00031a56, 0x000319a9, 0x00031982, 0x00031949,
+    0x000318fc, 0x000318c2, 0x00031889, 0x00031829, 0x000317dd, 0x000317b6,
+    0x000317a3, 0x000316f7, 0x00031698, 0x0003165f, 0x000315a0, 0x000314cf,
+    0x00031483, 0x0003144a, 0x0003132e, 0x00031308, 0x000312f5, 0x000312d0,
+    0x00031226, 0x000311ed, 0x000310d3, 0x000310c0, 0x0003109a, 0x0003104f,
+    0x00031017, 0x00030ff2, 0x00030fb9, 0x00030f49, 0x00030ec6, 0x00030d89,
+    0x00030d06, 0x00030cce, 0x00030ca9, 0x00030c96, 0x00030c5f, 0x00030c3a,
+    0x00030bb8, 0x00030b92, 0x00030b80, 0x00030b48, 0x00030a45, 0x00030a33,
+    0x00030a0e, 0x000309d6, 0x0003098d, 0x00030930, 0x0003091e, 0x000308c2,
+    0x000308af, 0x00030853, 0x00030841, 0x0003081c, 0x00030709, 0x000306f7,
+    0x00030689, 0x0003061b, 0x000305bf, 0x0003051b, 0x000304ae, 0x0003042e,
+    0x000303d3, 0x000303c1, 0x00030354, 0x0003031e, 0x000302c3, 0x0003028d,
+    0x0003020e, 0x000301a1, 0x0003017d, 0x000300ff, 0x000300db, 0x00030039,
+    0x00030027, 0x0002ffcd, 0x0002ff85, 0x0002ff61, 0x0002ff19, 0x0002febf,
+    0x0002fe53, 0x0002fdb2, 0x0002fd11, 0x0002fcca, 0x0002fc94, 0x0002fbf4,
+    0x0002fb66, 0x0002fae9, 0x0002fab4, 0x0002fa7f, 0x0002fa26, 0x0002f9aa,
+    0x0002f987, 0x0002f952, 0x0002f940, 0x0002f8d6, 0x0002f86c, 0x0002f849,
+    0x0002f814, 0x0002f7df, 0x0002f775, 0x0002f763, 0x0002f6d7, 0x0002f6c5,
+    0x0002f65c, 0x0002f627, 0x0002f604, 0x0002f589, 0x0002f555, 0x0002f532,
+    0x0002f520, 0x0002f4b8, 0x0002f41a, 0x0002f3f8, 0x0002f2be, 0x0002f222,
+    0x0002f1ba, 0x0002f152, 0x0002f140, 0x0002f11e, 0x0002f10c, 0x0002f0ea,
+    0x0002f0a5, 0x0002f03d, 0x0002f01a, 0x0002eee4, 0x0002eeb1, 0x0002ee16,
+    0x0002ee05, 0x0002ed9e, 0x0002ed48, 0x0002ed15, 0x0002ecae, 0x0002ebe1,
+    0x0002eb9d, 0x0002eb6a, 0x0002eb37, 0x0002eaae, 0x0002ea48, 0x0002ea37,
+    0x0002e99e, 0x0002e94a, 0x0002e8a0, 0x0002e84c, 0x0002e83b, 0x0002e808,
+    0x0002e770, 0x0002e74e, 0x0002e73e, 0x0002e5ed, 0x0002e5bb, 0x0002e5aa,
+    0x0002e524, 0x0002e513, 0x0002e4f1, 0x0002e4ae, 0x0002e418, 0x0002e3c4,
+    0x0002e360, 0x0002e32e, 0x0002e31d, 0x0002e2ca, 0x0002e288, 0x0002e266,
+    0x0002e234, 0x0002e1d1, 0x0002e1c0, 0x0002e16d, 0x0002e0d8, 0x0002e095,
+    0x0002e064, 0x0002e043, 0x0002df9d, 0x0002df7c, 0x0002df4b, 0x0002de22,
+    0x0002ddf1, 0x0002dde1, 0x0002dd8e, 0x0002dd5d, 0x0002dc98, 0x0002dc67,
+    0x0002dbf5, 0x0002db72, 0x0002db41, 0x0002daae, 0x0002da9e, 0x0002da4d,
+    0x0002d9aa, 0x0002d959, 0x0002d918, 0x0002d8e7, 0x0002d8c7, 0x0002d896,
+    0x0002d886, 0x0002d835, 0x0002d825, 0x0002d7c4, 0x0002d7a4, 0x0002d793,
+    0x0002d773, 0x0002d733, 0x0002d6e2, 0x0002d6b2, 0x0002d651, 0x0002d5c0,
+    0x0002d550, 0x0002d4ef, 0x0002d46f, 0x0002d42f, 0x0002d3ff, 0x0002d37f,
+    0x0002d33f, 0x0002d31f, 0x0002d30f, 0x0002d2e0, 0x0002d250, 0x0002d191,
+    0x0002d102, 0x0002d0b3, 0x0002d054, 0x0002d044, 0x0002d025, 0x0002cfb6,
+    0x0002cf67, 0x0002cf38, 0x0002cf08, 0x0002ced9, 0x0002ce4b, 0x0002cded,
+    0x0002cddd, 0x0002cd01, 0x0002cc74, 0x0002cc06, 0x0002cb89, 0x0002cb2b,
+    0x0002cabe, 0x0002ca03, 0x0002c9a6, 0x0002c8fb, 0x0002c8cd, 0x0002c8bd,
+    0x0002c870, 0x0002c832, 0x0002c813, 0x0002c803, 0x0002c7e4, 0x0002c778,
+    0x0002c71c, 0x0002c6ed, 0x0002c6cf, 0x0002c6a0, 0x0002c634, 0x0002c616,
+    0x0002c606, 0x0002c5e8, 0x0002c501, 0x0002c4d3, 0x0002c4c4, 0x0002c496,
+    0x0002c449, 0x0002c43a, 0x0002c355, 0x0002c2ad, 0x0002c29e, 0x0002c27f,
+    0x0002c251, 0x0002c215, 0x0002c1e7, 0x0002c1b9, 0x0002c140, 0x0002c0e5,
+    0x0002c08a, 0x0002c05c, 0x0002c020, 0x0002c002, 0x0002bff2, 0x0002bf3d,
+    0x0002bee3, 0x0002bec4, 0x0002be97, 0x0002be5b, 0x0002be2e, 0x0002be01,
+    0x0002bdb6, 0x0002bda7, 0x0002bd7a, 0x0002bd1f, 0x0002bc4e, 0x0002bbe5,
+    0x0002bbb8, 0x0002bb9a, 0x0002bb41, 0x0002bb05, 0x0002bad8, 0x0002ba7f,
+    0x0002ba61, 0x0002ba34, 0x0002b9cc, 0x0002b9a0, 0x0002b947, 0x0002b8fd,
+    0x0002b8d0, 0x0002b8a4, 0x0002b868, 0x0002b83c, 0x0002b810, 0x0002b7f2,
+    0x0002b7e3, 0x0002b7c6, 0x0002b78b, 0x0002b732, 0x0002b715, 0x0002b6ae,
+    0x0002b629, 0x0002b5e0, 0x0002b5d1, 0x0002b55b, 0x0002b52f, 0x0002b49d,
+    0x0002b471, 0x0002b428, 0x0002b3ed, 0x0002b3d0, 0x0002b2f5, 0x0002b1f0,
+    0x0002b198, 0x0002b15e, 0x0002b0bf, 0x0002b068, 0x0002b05a, 0x0002b02e,
+    0x0002afd8, 0x0002af64, 0x0002af39, 0x0002af0e, 0x0002aeff, 0x0002ae7e,
+    0x0002ae61, 0x0002ada6, 0x0002ad8a, 0x0002ad50, 0x0002accf, 0x0002ac88,
+    0x0002ac4f, 0x0002ac07, 0x0002abdc, 0x0002ab79, 0x0002ab5c, 0x0002aace,
+    0x0002aa31, 0x0002a9b2, 0x0002a95d, 0x0002a924, 0x0002a85e, 0x0002a809,
+    0x0002a7df, 0x0002a7b5, 0x0002a77c, 0x0002a752, 0x0002a6fd, 0x0002a655,
+    0x0002a5e5, 0x0002a582, 0x0002a566, 0x0002a504, 0x0002a4b1, 0x0002a487,
+    0x0002a441, 0x0002a3ed, 0x0002a362, 0x0002a338, 0x0002a31c, 0x0002a2e5,
+    0x0002a268, 0x0002a214, 0x0002a198, 0x0002a152, 0x0002a145, 0x0002a129,
+    0x0002a09f, 0x0002a05a, 0x00029ff9, 0x00029fde, 0x00029fb4, 0x00029fa7,
+    0x00029f62, 0x00029ebd, 0x00029e41, 0x00029e34, 0x00029e18, 0x00029d8f,
+    0x00029d22, 0x00029cc2, 0x00029c7e, 0x00029c1f, 0x00029bf6, 0x00029bdb,
+    0x00029bb2, 0x00029b2a, 0x00029b01, 0x00029abd, 0x00029a95, 0x00029a87,
+    0x00029a36, 0x00029a0d, 0x00029942, 0x000298ff, 0x000298c9, 0x000298a0,
+    0x00029885, 0x0002985d, 0x00029827, 0x0002971a, 0x0002970d, 0x000296f2,
+    0x000296e5, 0x00029694, 0x0002961c, 0x00029601, 0x000295d9, 0x000295a3,
+    0x00029561, 0x00029539, 0x000294c1, 0x00029449, 0x0002943c, 0x000293ec,
+    0x00029381, 0x0002934c, 0x00029325, 0x0002930a, 0x000292e2, 0x000292bb,
+    0x000292ad, 0x00029156, 0x000290fa, 0x000290df, 0x0002905c, 0x00028ff3,
+    0x00028fe5, 0x00028fcb, 0x00028fa4, 0x00028f55, 0x00028f48, 0x00028f21,
+    0x00028ed2, 0x00028e84, 0x00028e5c, 0x00028e42, 0x00028de7, 0x00028da6,
+    0x00028d7f, 0x00028d58, 0x00028cfc, 0x00028cbb, 0x00028c60, 0x00028bf9,
+    0x00028bc5, 0x00028b9e, 0x00028b50, 0x00028b36, 0x00028b02, 0x00028a74,
+    0x00028a4e, 0x00028a41, 0x000289cd, 0x0002893f, 0x00028918, 0x0002890c,
+    0x00028898, 0x00028871, 0x0002880b, 0x000287b1, 0x00028771, 0x0002874b,
+    0x000286fe, 0x000286f1, 0x000286cb, 0x000286b1, 0x0002867e, 0x0002860c,
+    0x000285bf, 0x0002855a, 0x0002854d, 0x00028533, 0x000284db, 0x000284c1,
+    0x0002848f, 0x00028442, 0x000283f6, 0x00028339, 0x000282d4, 0x000282a2,
+    0x00028288, 0x0002827c, 0x00028256, 0x000281cc, 0x00028180, 0x0002814e,
+    0x0002810f, 0x000280ea, 0x000280c4, 0x0002809e, 0x00028047, 0x00028021,
+    0x00027fb1, 0x00027f72, 0x00027f28, 0x00027f1b, 0x00027edd, 0x00027ed0,
+    0x00027eb7, 0x00027e16, 0x00027dfd, 0x00027db2, 0x00027d81, 0x00027d68,
+    0x00027cf8, 0x00027cc7, 0x00027c89, 0x00027c33, 0x00027bd0, 0x00027bab,
+    0x00027b86, 0x00027b55, 0x00027b17, 0x00027af2, 0x00027ac1, 0x00027a9c,
+    0x00027a52, 0x00027a15, 0x0002799a, 0x0002795d, 0x0002792c, 0x00027914,
+    0x000278ca, 0x0002782c, 0x000277be, 0x000277a6, 0x0002775c, 0x000276ef,
+    0x000276cb, 0x00027615, 0x000275f0, 0x000275c0, 0x0002759c, 0x00027517,
+    0x000274ce, 0x000274c2, 0x000274aa, 0x00027486, 0x00027462, 0x00027456,
+    0x00027419, 0x0002740d, 0x000273f5, 0x000273d1, 0x000273ad, 0x000273a1,
+    0x0002737d, 0x000272f9, 0x0002728d, 0x00027269, 0x000271fd, 0x000271b6,
+    0x00027186, 0x0002713e, 0x0002711b, 0x000270df, 0x00027098, 0x0002708c,
+    0x0002702c, 0x00027021, 0x00026fe5, 0x00026fd9, 0x00026f9e, 0x00026f33,
+    0x00026f10, 0x00026e99, 0x00026e82, 0x00026e76, 0x00026e52, 0x00026dd0,
+    0x00026dad, 0x00026d8a, 0x00026d20, 0x00026cfc, 0x00026caa, 0x00026c63,
+    0x00026c06, 0x00026bfa, 0x00026bd7, 0x00026bb3, 0x00026b9c, 0x00026b4a,
+    0x00026b04, 0x00026aec, 0x00026ae1, 0x00026a78, 0x00026a1a, 0x00026949,
+    0x00026903, 0x000268e0, 0x0002688f, 0x000267ed, 0x000267e1, 0x0002679c,
+    0x00026779, 0x00026734, 0x00026711, 0x000266fa, 0x000266ee, 0x00026692,
+    0x000265e5, 0x000265b7, 0x0002652e, 0x0002650b, 0x0002645f, 0x00026426,
+    0x0002641b, 0x000263b4, 0x0002639d, 0x0002637b, 0x00026336, 0x00026309,
+    0x0002628b, 0x00026280, 0x0002625e, 0x000261e1, 0x0002617b, 0x00026170,
+    0x00026137, 0x0002612c, 0x000260f3, 0x00026049, 0x0002603e, 0x00025fa0,
+    0x00025f7e, 0x00025f30, 0x00025ed6, 0x00025eb4, 0x00025e44, 0x00025dea,
+    0x00025ddf, 0x00025dbd, 0x00025da7, 0x00025cf4, 0x00025cde, 0x00025cd2,
+    0x00025cbc, 0x00025c9b, 0x00025c90, 0x00025c4d, 0x00025c36, 0x00025c15,
+    0x00025bf4, 0x00025bb1, 0x00025ba6, 0x00025b84, 0x00025b6e, 0x00025b4d,
+    0x00025b20, 0x00025aff, 0x00025ae9, 0x00025a7a, 0x00025a64, 0x000259b3,
+    0x0002597c, 0x0002594f, 0x000258f7, 0x000258ec, 0x00025873, 0x00025868,
+    0x00025852, 0x00025831, 0x00025805, 0x000257e4, 0x0002578c, 0x00025740,
+    0x0002572a, 0x000256c7, 0x0002569b, 0x00025686, 0x00025618, 0x000255f8,
+    0x000255b6, 0x00025575, 0x00025554, 0x0002551e, 0x00025513, 0x000254dc,
+    0x000254d2, 0x00025490, 0x000253f8, 0x000253b7, 0x00025356, 0x0002534b,
+    0x000252ea, 0x000252b4, 0x00025289, 0x00025253, 0x00025151, 0x00025146,
+    0x00025130, 0x00025110, 0x000250e5, 0x000250b0, 0x000250a5, 0x0002506f,
+    0x00024fcf, 0x00024fc4, 0x00024f04, 0x00024ee4, 0x00024eaf, 0x00024e8f,
+    0x00024e84, 0x00024e24, 0x00024e0f, 0x00024def, 0x00024dc5, 0x00024d70,
+    0x00024d26, 0x00024cd1, 0x00024cb1, 0x00024c67, 0x00024c52, 0x00024be9,
+    0x00024bd4, 0x00024bb4, 0x00024ba9, 0x00024b75, 0x00024b36, 0x00024b2b,
+    0x00024b0c, 0x00024acc, 0x00024aad, 0x00024a8d, 0x00024a78, 0x00024a39,
+    0x00024a2f, 0x00024a10, 0x000249fb, 0x000249bc, 0x0002499c, 0x00024972,
+    0x0002495e, 0x00024953, 0x00024934, 0x000248d6, 0x000248a2, 0x00024882,
+    0x00024859, 0x0002481a, 0x000247fb, 0x00024788, 0x0002477e, 0x0002475f,
+    0x00024721, 0x000246c3, 0x000246af, 0x00024666, 0x00024647, 0x00024632,
+    0x000245cb, 0x000245ac, 0x00024559, 0x00024530, 0x0002451c, 0x000244f2,
+    0x00024481, 0x00024458, 0x0002441a, 0x000243fc, 0x000243dd, 0x0002438b,
+    0x0002434d, 0x000242f1, 0x00024258, 0x0002422f, 0x0002421b, 0x00024210,
+    0x000241fc, 0x000241dd, 0x00024159, 0x00024145, 0x000240fe, 0x00024084,
+    0x00024014, 0x00023ff6, 0x00023fec, 0x00023fcd, 0x00023f9b, 0x00023f7d,
+    0x00023f36, 0x00023f18, 0x00023ef9, 0x00023ebd, 0x00023e8a, 0x00023e6c,
+    0x00023e62, 0x00023e26, 0x00023df3, 0x00023db7, 0x00023d8f, 0x00023d35,
+    0x00023cda, 0x00023ca8, 0x00023c8a, 0x00023c62, 0x00023c12, 0x00023bf5,
+    0x00023bd7, 0x00023baf, 0x00023b5f, 0x00023afb, 0x00023ae7, 0x00023ade,
+    0x00023aac, 0x00023aa2, 0x00023a70, 0x00023a35, 0x00023a17, 0x000239ef,
+    0x000239d1, 0x000239a0, 0x0002393d, 0x0002390c, 0x000238b3, 0x00023832,
+    0x0002381f, 0x00023801, 0x0002376e, 0x00023764, 0x00023750, 0x00023729,
+    0x0002370c, 0x000236d1, 0x00023696, 0x0002363e, 0x0002362a, 0x00023603,
+    0x00023598, 0x0002357a, 0x00023571, 0x00023536, 0x00023490, 0x00023473,
+    0x0002341c, 0x000233e2, 0x000233c4, 0x000233bb, 0x00023333, 0x000232ef,
+    0x000232a2, 0x0002325e, 0x0002324b, 0x00023208, 0x000231ce, 0x000231bb,
+    0x0002319e, 0x00023181, 0x00023177, 0x000230ca, 0x000230b7, 0x0002309a,
+    0x0002303a, 0x00023001, 0x00022f8e, 0x00022f72, 0x00022f09, 0x00022eff,
+    0x00022eb3, 0x00022e5d, 0x00022e24, 0x00022deb, 0x00022d96, 0x00022d8c,
+    0x00022d70, 0x00022d53, 0x00022d37, 0x00022d24, 0x00022d07, 0x00022cc5,
+    0x00022cb2, 0x00022ca9, 0x00022c41, 0x00022c1b, 0x00022be2, 0x00022bc6,
+    0x00022b97, 0x00022b7b, 0x00022b55, 0x00022b1d, 0x00022ac8, 0x00022a90,
+    0x00022a74, 0x00022a45, 0x00022a3b, 0x000229d4, 0x00022993, 0x00022977,
+    0x0002295b, 0x00022948, 0x000228f4, 0x000228d8, 0x0002287b, 0x00022814,
+    0x0002280b, 0x000227d3, 0x00022764, 0x00022751, 0x000226fe, 0x000226ab,
+    0x000226a1, 0x0002263c, 0x00022632, 0x00022620, 0x000225e9, 0x000225c4,
+    0x0002258c, 0x0002255e, 0x0002251e, 0x0002250b, 0x00022502, 0x000224af,
+    0x00022466, 0x000223b8, 0x0002239c, 0x00022381, 0x00022366, 0x0002232f,
+    0x00022301, 0x000222e6, 0x000222af, 0x0002228a, 0x0002226f, 0x0002225d,
+    0x00022241, 0x00022202, 0x00022179, 0x0002215e, 0x00022131, 0x0002210d,
+    0x000220a9, 0x0002208e, 0x0002206a, 0x00022033, 0x00022006, 0x00021ffd,
+    0x00021fd0, 0x00021fc7, 0x00021fac, 0x00021f7f, 0x00021f76, 0x00021f49,
+    0x00021f13, 0x00021ec2, 0x00021e68, 0x00021e4d, 0x00021e3b, 0x00021e17,
+    0x00021db5, 0x00021d9a, 0x00021d7f, 0x00021cf9, 0x00021cde, 0x00021ca0,
+    0x00021c85, 0x00021c4f, 0x00021c1a, 0x00021bff, 0x00021bd3, 0x00021bca,
+    0x00021b9d, 0x00021b18, 0x00021b0f, 0x00021ac8, 0x00021aa5, 0x00021a93,
+    0x00021a8a, 0x00021a70, 0x00021a20, 0x00021a0f, 0x00021a06, 0x000219eb,
+    0x000219da, 0x00021967, 0x00021955, 0x00021932, 0x00021918, 0x000218ec,
+    0x000218e3, 0x000218d1, 0x000218b7, 0x00021894, 0x00021882, 0x00021868,
+    0x000217e4, 0x000217b0, 0x000217a7, 0x0002178d, 0x00021772, 0x00021761,
+    0x00021709, 0x000216a9, 0x00021687, 0x00021675, 0x0002166c, 0x0002165b,
+    0x00021522, 0x000214ff, 0x000214ee, 0x000214cb, 0x0002146c, 0x00021463,
+    0x00021452, 0x00021416, 0x000213ea, 0x000213e2, 0x000213d1, 0x0002137a,
+    0x00021360, 0x00021335, 0x000212e8, 0x000212ce, 0x00021278, 0x00021233,
+    0x0002121a, 0x000211f7, 0x000211de, 0x000211cd, 0x00021177, 0x00021144,
+    0x000210e6, 0x000210dd, 0x000210cc, 0x000210c4, 0x00021090, 0x00021066,
+    0x00021019, 0x00021011, 0x00020fb3, 0x00020f9a, 0x00020f4d, 0x00020ece,
+    0x00020ec6, 0x00020e9b, 0x00020e60, 0x00020e36, 0x00020e14, 0x00020dd0,
+    0x00020cfe, 0x00020ce5, 0x00020cbb, 0x00020c99, 0x00020c6f, 0x00020c3d,
+    0x00020c23, 0x00020bd8, 0x00020bd0, 0x00020b74, 0x00020b5b, 0x00020b52,
+    0x00020b42, 0x00020b28, 0x00020b07, 0x00020aee, 0x00020ad5, 0x00020aab,
+    0x00020a60, 0x00020a58, 0x000209fc, 0x000209f4, 0x000209b2, 0x00020978,
+    0x0002094e, 0x00020935, 0x0002092d, 0x000208fb, 0x000208d2, 0x0002087f,
+    0x0002086e, 0x00020835, 0x0002081c, 0x0002080b, 0x00020777, 0x0002076f,
+    0x0002075e, 0x00020746, 0x00020714, 0x0002070c, 0x000206fc, 0x000206c2,
+    0x00020691, 0x00020678, 0x00020668, 0x0002064f, 0x00020647, 0x0002062e,
+    0x0002061e, 0x000205cc, 0x000205a3, 0x0002059b, 0x00020572, 0x0002055a,
+    0x00020529, 0x00020521, 0x000204bf, 0x0002048e, 0x0002045d, 0x00020445,
+    0x0002042c, 0x0002041c, 0x000203ba, 0x000203b2, 0x000203a2, 0x00020341,
+    0x00020339, 0x00020320, 0x00020310, 0x000202f8, 0x000202d8, 0x00020297,
+    0x0002027f, 0x00020277, 0x0002024e, 0x0002021e, 0x000201e5, 0x000201cd,
+    0x00020144, 0x0002012c, 0x000200f4, 0x000200dc, 0x000200cc, 0x000200c4,
+    0x0002004c, 0x0001fff4, 0x0001ffd4, 0x0001ffc4, 0x0001ffac, 0x0001ff8c,
+    0x0001ff7c, 0x0001ff74, 0x0001ff04, 0x0001fefc, 0x0001fee4, 0x0001fed4,
+    0x0001fe6d, 0x0001fe25, 0x0001fdce, 0x0001fdc6, 0x0001fdae, 0x0001fd6f,
+    0x0001fd57, 0x0001fd4f, 0x0001fd10, 0x0001fce0, 0x0001fcd8, 0x0001fca9,
+    0x0001fc99, 0x0001fc82, 0x0001fc6a, 0x0001fc33, 0x0001fc0b, 0x0001fbf4,
+    0x0001fbd4, 0x0001fba5, 0x0001fb95, 0x0001fb4f, 0x0001fb47, 0x0001fb1f,
+    0x0001fb00, 0x0001fac1, 0x0001faaa, 0x0001fa92, 0x0001fa1d, 0x0001fa15,
+    0x0001f9ee, 0x0001f9a8, 0x0001f9a0, 0x0001f979, 0x0001f95a, 0x0001f94a,
+    0x0001f92b, 0x0001f8fc, 0x0001f89f, 0x0001f804, 0x0001f7fc, 0x0001f7ce,
+    0x0001f7a7, 0x0001f790, 0x0001f761, 0x0001f75a, 0x0001f72b, 0x0001f71c,
+    0x0001f714, 0x0001f705, 0x0001f6ed, 0x0001f6a8, 0x0001f672, 0x0001f644,
+    0x0001f62d, 0x0001f61d, 0x0001f5e7, 0x0001f574, 0x0001f565, 0x0001f546,
+    0x0001f520, 0x0001f501, 0x0001f4ea, 0x0001f4c4, 0x0001f47f, 0x0001f461,
+    0x0001f451, 0x0001f41c, 0x0001f3df, 0x0001f3c8, 0x0001f3a9, 0x0001f39a,
+    0x0001f383, 0x0001f37c, 0x0001f356, 0x0001f34e, 0x0001f320, 0x0001f311,
+    0x0001f30a, 0x0001f2fa, 0x0001f2e4, 0x0001f2c5, 0x0001f2b6, 0x0001f29f,
+    0x0001f226, 0x0001f1cb, 0x0001f1a5, 0x0001f187, 0x0001f143, 0x0001f11e,
+    0x0001f116, 0x0001f0ff, 0x0001f0da, 0x0001f0d2, 0x0001f0c3, 0x0001f07f,
+    0x0001f069, 0x0001f03c, 0x0001f034, 0x0001eff8, 0x0001eff1, 0x0001ef9e,
+    0x0001ef88, 0x0001ef71, 0x0001ef53, 0x0001ef10, 0x0001ef01, 0x0001eebe,
+    0x0001ee91, 0x0001ee73, 0x0001ee5d, 0x0001ee4e, 0x0001ee03, 0x0001eded,
+    0x0001ed7d, 0x0001ed2c, 0x0001ecff, 0x0001ecf8, 0x0001ece1, 0x0001ec9f,
+    0x0001ec90, 0x0001ebab, 0x0001eb9c, 0x0001eb95, 0x0001eb68, 0x0001eb52,
+    0x0001eb2d, 0x0001eb26, 0x0001eafa, 0x0001eace, 0x0001ea67, 0x0001ea60,
+    0x0001ea51, 0x0001ea1e, 0x0001e9cd, 0x0001e9b7, 0x0001e9b0, 0x0001e99a,
+    0x0001e984, 0x0001e95f, 0x0001e92c, 0x0001e91e, 0x0001e916, 0x0001e8f2,
+    0x0001e8dc, 0x0001e8bf, 0x0001e89a, 0x0001e867, 0x0001e843, 0x0001e82d,
+    0x0001e826, 0x0001e7fa, 0x0001e7aa, 0x0001e769, 0x0001e74c, 0x0001e728,
+    0x0001e6e7, 0x0001e6bb, 0x0001e6b4, 0x0001e689, 0x0001e67a, 0x0001e64f,
+    0x0001e648, 0x0001e624, 0x0001e61c, 0x0001e607, 0x0001e5c6, 0x0001e5b0,
+    0x0001e59b, 0x0001e521, 0x0001e50b, 0x0001e504, 0x0001e4d9, 0x0001e4ca,
+    0x0001e4b5, 0x0001e474, 0x0001e434, 0x0001e42d, 0x0001e3f4, 0x0001e3de,
+    0x0001e3c9, 0x0001e3ac, 0x0001e397, 0x0001e373, 0x0001e333, 0x0001e316,
+    0x0001e2f3, 0x0001e2d6, 0x0001e2b3, 0x0001e2ac, 0x0001e29d, 0x0001e25e,
+    0x0001e201, 0x0001e1d7, 0x0001e189, 0x0001e182, 0x0001e174, 0x0001e16d,
+    0x0001e11f, 0x0001e10a, 0x0001e0f4, 0x0001e0c3, 0x0001e08b, 0x0001e076,
+    0x0001e02f, 0x0001e00c, 0x0001dfe2, 0x0001dfdb, 0x0001df9c, 0x0001df08,
+    0x0001defa, 0x0001dea6, 0x0001de9f, 0x0001de8a, 0x0001de67, 0x0001de3e,
+    0x0001de37, 0x0001de22, 0x0001ddff, 0x0001dde3, 0x0001ddd5, 0x0001ddc0,
+    0x0001dd96, 0x0001dd6c, 0x0001dd51, 0x0001dd43, 0x0001dd2e, 0x0001dd04,
+    0x0001dc9c, 0x0001dc57, 0x0001dc42, 0x0001dbef, 0x0001dbda, 0x0001dbb8,
+    0x0001db8e, 0x0001db87, 0x0001db65, 0x0001db20, 0x0001db0b, 0x0001daf7,
+    0x0001dae9, 0x0001dac0, 0x0001da90, 0x0001da6d, 0x0001da2f, 0x0001da06,
+    0x0001d9eb, 0x0001d9d6, 0x0001d9ad, 0x0001d99f, 0x0001d970, 0x0001d94d,
+    0x0001d947, 0x0001d91e, 0x0001d8b7, 0x0001d881, 0x0001d87a, 0x0001d851,
+    0x0001d83d, 0x0001d82f, 0x0001d828, 0x0001d81b, 0x0001d806, 0x0001d7ae,
+    0x0001d7a0, 0x0001d763, 0x0001d75c, 0x0001d74f, 0x0001d73a, 0x0001d70b,
+    0x0001d655, 0x0001d640, 0x0001d591, 0x0001d58a, 0x0001d555, 0x0001d540,
+    0x0001d52c, 0x0001d504, 0x0001d4ad, 0x0001d49f, 0x0001d499, 0x0001d485,
+    0x0001d43b, 0x0001d427, 0x0001d420, 0x0001d3f8, 0x0001d3d0, 0x0001d3bc,
+    0x0001d39a, 0x0001d35e, 0x0001d358, 0x0001d330, 0x0001d308, 0x0001d2e7,
+    0x0001d2ab, 0x0001d283, 0x0001d26f, 0x0001d254, 0x0001d241, 0x0001d21f,
+    0x0001d20b, 0x0001d1f1, 0x0001d1e4, 0x0001d1dd, 0x0001d1d0, 0x0001d18e,
+    0x0001d13e, 0x0001d12b, 0x0001d117, 0x0001d0f6, 0x0001d0c8, 0x0001d0a7,
+    0x0001d0a0, 0x0001d058, 0x0001d044, 0x0001d016, 0x0001cff5, 0x0001cfa0,
+    0x0001cf93, 0x0001cf58, 0x0001cf3d, 0x0001cf16, 0x0001ceef, 0x0001cece,
+    0x0001cea7, 0x0001ce93, 0x0001ce79, 0x0001ce45, 0x0001ce31, 0x0001ce17,
+    0x0001ce04, 0x0001cdf0, 0x0001cda9, 0x0001cda2, 0x0001cd82, 0x0001cd41,
+    0x0001cd20, 0x0001cd0d, 0x0001cc7e, 0x0001cc44, 0x0001cc31, 0x0001cc10,
+    0x0001cc0a, 0x0001cbfd, 0x0001cbea, 0x0001cbbc, 0x0001cbb0, 0x0001cb5c,
+    0x0001cb4f, 0x0001cb48, 0x0001cb22, 0x0001cb02, 0x0001cae8, 0x0001cadb,
+    0x0001cac1, 0x0001ca9b, 0x0001ca8e, 0x0001ca68, 0x0001ca4e, 0x0001ca07,
+    0x0001c9ee, 0x0001c9db, 0x0001c9bb, 0x0001c981, 0x0001c96e, 0x0001c95b,
+    0x0001c941, 0x0001c92e, 0x0001c908, 0x0001c8fb, 0x0001c8e2, 0x0001c8a8,
+    0x0001c889, 0x0001c862, 0x0001c84f, 0x0001c829, 0x0001c823, 0x0001c810,
+    0x0001c803, 0x0001c7fd, 0x0001c7ca, 0x0001c7a4, 0x0001c77e, 0x0001c752,
+    0x0001c732, 0x0001c706, 0x0001c6f3, 0x0001c6d3, 0x0001c6ad, 0x0001c6a7,
+    0x0001c681, 0x0001c66e, 0x0001c662, 0x0001c64f, 0x0001c649, 0x0001c623,
+    0x0001c616, 0x0001c5c4, 0x0001c5b2, 0x0001c579, 0x0001c566, 0x0001c547,
+    0x0001c534, 0x0001c52e, 0x0001c4f5, 0x0001c4d6, 0x0001c4bd, 0x0001c4b1,
+    0x0001c45f, 0x0001c440, 0x0001c402, 0x0001c3ef, 0x0001c3bd, 0x0001c37f,
+    0x0001c35a, 0x0001c33b, 0x0001c322, 0x0001c303, 0x0001c2fd, 0x0001c2cb,
+    0x0001c2b8, 0x0001c27a, 0x0001c25b, 0x0001c21d, 0x0001c211, 0x0001c1b4,
+    0x0001c1ae, 0x0001c1a2, 0x0001c189, 0x0001c158, 0x0001c152, 0x0001c11a,
+    0x0001c10e, 0x0001c108, 0x0001c0f5, 0x0001c0d7, 0x0001c09f, 0x0001c07b,
+    0x0001c050, 0x0001c018, 0x0001c006, 0x0001bfd5, 0x0001bf98, 0x0001bf86,
+    0x0001bf79, 0x0001bf61, 0x0001bf4f, 0x0001bf42, 0x0001bf30, 0x0001bf0b,
+    0x0001bef3, 0x0001bed5, 0x0001becf, 0x0001beaa, 0x0001be98, 0x0001be8c,
+    0x0001be85, 0x0001be73, 0x0001be55, 0x0001be4f, 0x0001be1e, 0x0001bdfa,
+    0x0001bdcf, 0x0001bdb1, 0x0001bd9f, 0x0001bd86, 0x0001bd74, 0x0001bd20,
+    0x0001bd1a, 0x0001bd07, 0x0001bcd1, 0x0001bc77, 0x0001bc10, 0x0001bc0a,
+    0x0001bbda, 0x0001bbb6, 0x0001bbb0, 0x0001bb7a, 0x0001bb4a, 0x0001bb38,
+    0x0001bb20, 0x0001bb02, 0x0001baea, 0x0001bacc, 0x0001bab4, 0x0001ba96,
+    0x0001ba13, 0x0001ba01, 0x0001b9ef, 0x0001b9e3, 0x0001b9a8, 0x0001b99c,
+    0x0001b996, 0x0001b98a, 0x0001b960, 0x0001b90d, 0x0001b8f5, 0x0001b8e4,
+    0x0001b8b4, 0x0001b88b, 0x0001b832, 0x0001b820, 0x0001b7c8, 0x0001b7bc,
+    0x0001b792, 0x0001b775, 0x0001b763, 0x0001b752, 0x0001b73a, 0x0001b72e,
+    0x0001b6f9, 0x0001b6d6, 0x0001b6c4, 0x0001b6bf, 0x0001b67e, 0x0001b65b,
+    0x0001b643, 0x0001b632, 0x0001b60f, 0x0001b603, 0x0001b5da, 0x0001b5ce,
+    0x0001b5bd, 0x0001b5b7, 0x0001b5ab, 0x0001b577, 0x0001b53c, 0x0001b52b,
+    0x0001b4fc, 0x0001b48d, 0x0001b45f, 0x0001b459, 0x0001b44d, 0x0001b43c,
+    0x0001b436, 0x0001b3c2, 0x0001b349, 0x0001b320, 0x0001b315, 0x0001b303,
+    0x0001b2fe, 0x0001b2b8, 0x0001b29b, 0x0001b28a, 0x0001b284, 0x0001b251,
+    0x0001b234, 0x0001b211, 0x0001b20c, 0x0001b1de, 0x0001b1d8, 0x0001b1c7,
+    0x0001b199, 0x0001b187, 0x0001b170, 0x0001b165, 0x0001b15f, 0x0001b143,
+    0x0001b131, 0x0001b11b, 0x0001b0fe, 0x0001b0f8, 0x0001b0c5, 0x0001b097,
+    0x0001b080, 0x0001b05e, 0x0001b02b, 0x0001b008, 0x0001aff7, 0x0001afd5,
+    0x0001afb9, 0x0001afa8, 0x0001af97, 0x0001af64, 0x0001af41, 0x0001af1a,
+    0x0001af0e, 0x0001af09, 0x0001aeec, 0x0001aeb4, 0x0001aea3, 0x0001ae81,
+    0x0001ae70, 0x0001ae43, 0x0001adf9, 0x0001adee, 0x0001adbb, 0x0001adb6,
+    0x0001adaa, 0x0001ad50, 0x0001ad34, 0x0001ad1e, 0x0001ad0d, 0x0001ad02,
+    0x0001acf1, 0x0001ace0, 0x0001acb9, 0x0001aca8, 0x0001ac75, 0x0001ac6a,
+    0x0001ac65, 0x0001ac32, 0x0001ac16, 0x0001ac00, 0x0001abe4, 0x0001abcd,
+    0x0001abb2, 0x0001abac, 0x0001aba1, 0x0001ab90, 0x0001ab8b, 0x0001ab6f,
+    0x0001aafa, 0x0001aae3, 0x0001aac2, 0x0001aab7, 0x0001aaa6, 0x0001aa74,
+    0x0001aa6f, 0x0001aa42, 0x0001aa2c, 0x0001aa21, 0x0001aa1c, 0x0001aa00,
+    0x0001a9d9, 0x0001a9b8, 0x0001a99c, 0x0001a965, 0x0001a95a, 0x0001a944,
+    0x0001a928, 0x0001a8c0, 0x0001a8b5, 0x0001a8a4, 0x0001a89f, 0x0001a883,
+    0x0001a84c, 0x0001a831, 0x0001a810, 0x0001a7ff, 0x0001a7de, 0x0001a797,
+    0x0001a776, 0x0001a76b, 0x0001a755, 0x0001a709, 0x0001a6f3, 0x0001a6e8,
+    0x0001a6d2, 0x0001a691, 0x0001a681, 0x0001a665, 0x0001a650, 0x0001a63f,
+    0x0001a614, 0x0001a5f3, 0x0001a5dd, 0x0001a5c2, 0x0001a5a2, 0x0001a58c,
+    0x0001a550, 0x0001a540, 0x0001a53b, 0x0001a520, 0x0001a51a, 0x0001a50a,
+    0x0001a4ef, 0x0001a4df, 0x0001a4ce, 0x0001a4b9, 0x0001a4a9, 0x0001a49e,
+    0x0001a478, 0x0001a42d, 0x0001a417, 0x0001a3ec, 0x0001a3bc, 0x0001a3a6,
+    0x0001a39b, 0x0001a38b, 0x0001a356, 0x0001a34b, 0x0001a31b, 0x0001a30a,
+    0x0001a305, 0x0001a2c5, 0x0001a285, 0x0001a275, 0x0001a265, 0x0001a245,
+    0x0001a225, 0x0001a21a, 0x0001a215, 0x0001a1da, 0x0001a1d5, 0x0001a1ba,
+    0x0001a1aa, 0x0001a195, 0x0001a175, 0x0001a16a, 0x0001a135, 0x0001a105,
+    0x0001a0f5, 0x0001a0eb, 0x0001a0cb, 0x0001a08b, 0x0001a07b, 0x0001a06b,
+    0x00019fdd, 0x00019fc8, 0x00019fb8, 0x00019fad, 0x00019f69, 0x00019f0a,
+    0x00019f00, 0x00019efa, 0x00019ef0, 0x00019eac, 0x00019e8c, 0x00019e6d,
+    0x00019e62, 0x00019e52, 0x00019e43, 0x00019e2e, 0x00019e0e, 0x00019df4,
+    0x00019def, 0x00019dd0, 0x00019da6, 0x00019d77, 0x00019d67, 0x00019d52,
+    0x00019d43, 0x00019d23, 0x00019cf5, 0x00019cdb, 0x00019cd5, 0x00019c49,
+    0x00019c3f, 0x00019c3a, 0x00019c20, 0x00019bd2, 0x00019bb3, 0x00019b9e,
+    0x00019b94, 0x00019b7f, 0x00019b56, 0x00019b32, 0x00019b13, 0x00019b03,
+    0x00019af9, 0x00019aea, 0x00019acb, 0x00019abb, 0x00019ab6, 0x00019aac,
+    0x00019a88, 0x00019a69, 0x00019a5f, 0x00019a3b, 0x00019a2b, 0x000199ee,
+    0x000199de, 0x000199cf, 0x000199b5, 0x00019997, 0x00019978, 0x00019945,
+    0x00019917, 0x00019907, 0x000198f8, 0x000198cf, 0x000198bb, 0x000198b1,
+    0x000198a1, 0x0001986e, 0x00019864, 0x00019813, 0x00019809, 0x000197e5,
+    0x000197cc, 0x000197c7, 0x000197b7, 0x00019799, 0x00019771, 0x0001976b,
+    0x00019761, 0x00019752, 0x00019734, 0x0001972f, 0x00019715, 0x00019701,
+    0x000196f2, 0x000196e8, 0x000196e3, 0x000196ca, 0x000196a6, 0x00019697,
+    0x00019688, 0x0001966a, 0x0001963c, 0x000195e7, 0x000195d3, 0x000195ba,
+    0x000195ab, 0x0001956e, 0x0001955f, 0x0001955a, 0x00019541, 0x00019523,
+    0x0001951e, 0x000194d3, 0x000194ba, 0x00019497, 0x00019479, 0x0001945b,
+    0x00019433, 0x00019424, 0x00019415, 0x00019410, 0x000193e4, 0x000193da,
+    0x000193cb, 0x00019380, 0x0001935d, 0x00019353, 0x00019344, 0x00019336,
+    0x00019331, 0x00019322, 0x00019318, 0x00019309, 0x000192e6, 0x000192d7,
+    0x000192cd, 0x000192ba, 0x000192a1, 0x00019283, 0x00019274, 0x00019225,
+    0x0001920d, 0x000191f9, 0x000191c3, 0x000191be, 0x000191a5, 0x00019196,
+    0x0001915b, 0x00019148, 0x0001913e, 0x000190f4, 0x000190e6, 0x000190e1,
+    0x000190c3, 0x0001909c, 0x00019088, 0x0001907a, 0x00019070, 0x00019061,
+    0x0001904e, 0x00019027, 0x00019004, 0x00018ff6, 0x00018fe7, 0x00018fdd,
+    0x00018fd9, 0x00018fc0, 0x00018fa3, 0x00018f9e, 0x00018f77, 0x00018f55,
+    0x00018f4b, 0x00018f46, 0x00018f3d, 0x00018f0c, 0x00018ee0, 0x00018ec8,
+    0x00018ec3, 0x00018eab, 0x00018e9c, 0x00018e7f, 0x00018e37, 0x00018e23,
+    0x00018df8, 0x00018ddb, 0x00018dc3, 0x00018dbe, 0x00018daf, 0x00018da1,
+    0x00018d97, 0x00018d7a, 0x00018d5d, 0x00018d59, 0x00018d4f, 0x00018d32,
+    0x00018d07, 0x00018ccd, 0x00018cc8, 0x00018cb0, 0x00018ca2, 0x00018c8f,
+    0x00018c68, 0x00018c55, 0x00018c47, 0x00018c2a, 0x00018c12, 0x00018bf0,
+    0x00018be2, 0x00018bc5, 0x00018bb7, 0x00018ba9, 0x00018b9f, 0x00018b9a,
+    0x00018b61, 0x00018b58, 0x00018b49, 0x00018b36, 0x00018b28, 0x00018b1e,
+    0x00018b1a, 0x00018b10, 0x00018b02, 0x00018ae0, 0x00018ad7, 0x00018ac4,
+    0x00018aac, 0x00018a73, 0x00018a3a, 0x00018a1e, 0x00018a19, 0x00018a0b,
+    0x000189ee, 0x000189ba, 0x00018973, 0x0001896f, 0x00018960, 0x00018936,
+    0x0001891e, 0x00018910, 0x00018902, 0x000188ef, 0x000188e6, 0x000188e1,
+    0x000188d3, 0x000188bb, 0x000188a9, 0x00018891, 0x00018883, 0x00018870,
+    0x0001884b, 0x0001883d, 0x0001881c, 0x0001880e, 0x00018804, 0x000187cc,
+    0x000187b9, 0x000187a2, 0x0001879d, 0x00018781, 0x00018773, 0x0001876a,
+    0x00018716, 0x00018711, 0x000186de, 0x000186d0, 0x000186bd, 0x000186af,
+    0x00018698, 0x00018685, 0x00018677, 0x0001865b, 0x00018644, 0x00018623,
+    0x0001860c, 0x000185fe, 0x000185d5, 0x000185b9, 0x000185b4, 0x00018598,
+    0x0001858f, 0x00018553, 0x0001853c, 0x0001851b, 0x000184f6, 0x000184cd,
+    0x000184ba, 0x00018491, 0x00018475, 0x0001845a, 0x0001844c, 0x00018427,
+    0x00018407, 0x000183d0, 0x000183b9, 0x0001839d, 0x0001838b, 0x00018359,
+    0x0001834b, 0x00018346, 0x0001832f, 0x000182a6, 0x00018299, 0x00018294,
+    0x0001828b, 0x00018279, 0x00018254, 0x00018234, 0x0001821e, 0x00018210,
+    0x000181da, 0x000181cc, 0x000181b1, 0x00018188, 0x00018151, 0x0001814d,
+    0x00018109, 0x00018100, 0x000180fb, 0x000180e0, 0x000180d3, 0x000180bc,
+    0x000180b8, 0x000180af, 0x0001808f, 0x00018081, 0x0001805d, 0x00018059,
+    0x00018042, 0x00018030, 0x00017fff, 0x00017fd2, 0x00017fc4, 0x00017fbb,
+    0x00017f73, 0x00017f66, 0x00017f3e, 0x00017f35, 0x00017f30, 0x00017f27,
+    0x00017f23, 0x00017f1a, 0x00017f08, 0x00017e94, 0x00017e74, 0x00017e43,
+    0x00017e3f, 0x00017e0e, 0x00017de1, 0x00017dcb, 0x00017db9, 0x00017da3,
+    0x00017d9f, 0x00017d91, 0x00017d88, 0x00017d69, 0x00017d60, 0x00017d53,
+    0x00017d27, 0x00017d1e, 0x00017d11, 0x00017d0c, 0x00017cf2, 0x00017cd7,
+    0x00017cca, 0x00017caf, 0x00017c8c, 0x00017c87, 0x00017c6d, 0x00017c57,
+    0x00017c45, 0x00017c3c, 0x00017c2f, 0x00017c2b, 0x00017bed, 0x00017bd3,
+    0x00017bc1, 0x00017bab, 0x00017b91, 0x00017b8c, 0x00017b83, 0x00017b65,
+    0x00017b27, 0x00017b16, 0x00017b08, 0x00017b00, 0x00017afb, 0x00017af2,
+    0x00017ae5, 0x00017ae1, 0x00017ac7, 0x00017a48, 0x00017a3b, 0x00017a1c,
+    0x00017a06, 0x00017a02, 0x000179f5, 0x000179b8, 0x00017972, 0x0001796a,
+    0x00017929, 0x00017917, 0x0001790a, 0x00017901, 0x000178f4, 0x000178da,
+    0x000178c0, 0x000178bc, 0x000178b3, 0x000178a6, 0x00017899, 0x0001787b,
+    0x00017859, 0x00017847, 0x00017807, 0x000177fe, 0x000177fa, 0x000177e4,
+    0x000177d3, 0x000177c6, 0x000177bd, 0x000177b0, 0x00017778, 0x00017770,
+    0x00017756, 0x00017752, 0x0001773c, 0x00017715, 0x000176fc, 0x000176e2,
+    0x000176bb, 0x000176b7, 0x000176af, 0x00017695, 0x00017684, 0x0001766a,
+    0x00017655, 0x0001762a, 0x00017621, 0x00017610, 0x000175ee, 0x000175d5,
+    0x000175c3, 0x000175b7, 0x00017595, 0x00017584, 0x0001756e, 0x00017555,
+    0x00017537, 0x0001752a, 0x00017522, 0x00017511, 0x000174f7, 0x000174ef,
+    0x000174c4, 0x000174b8, 0x00017463, 0x00017452, 0x00017430, 0x00017424,
+    0x000173d7, 0x000173d3, 0x000173c7, 0x000173be, 0x000173b2, 0x000173ad,
+    0x0001737f, 0x00017359, 0x00017355, 0x00017340, 0x00017333, 0x000172e8,
+    0x000172ca, 0x000172b1, 0x000172a9, 0x00017283, 0x00017272, 0x0001726a,
+    0x0001724c, 0x00017238, 0x00017233, 0x0001721e, 0x0001720e, 0x00017205,
+    0x00017201, 0x000171dc, 0x000171ba, 0x000171a1, 0x00017184, 0x0001716f,
+    0x00017152, 0x00017146, 0x00017139, 0x000170e2, 0x000170cd, 0x000170c1,
+    0x000170b4, 0x0001708b, 0x00017076, 0x00017065, 0x0001704d, 0x00017044,
+    0x0001702b, 0x00017006, 0x00017002, 0x00016fed, 0x00016fd1, 0x00016fab,
+    0x00016f97, 0x00016f72, 0x00016f61, 0x00016f55, 0x00016f4d, 0x00016f30,
+    0x00016f23, 0x00016f0f, 0x00016ed1, 0x00016eb5, 0x00016ea8, 0x00016e9c,
+    0x00016e94, 0x00016e7b, 0x00016e2d, 0x00016e25, 0x00016e21, 0x00016e19,
+    0x00016e0d, 0x00016dfc, 0x00016de4, 0x00016dcf, 0x00016dc3, 0x00016d9e,
+    0x00016d92, 0x00016d2c, 0x00016d20, 0x00016d18, 0x00016d0c, 0x00016cf3,
+    0x00016ce3, 0x00016ccf, 0x00016c8e, 0x00016c82, 0x00016c55, 0x00016c51,
+    0x00016c3d, 0x00016c24, 0x00016c00, 0x00016bfc, 0x00016bf0, 0x00016be8,
+    0x00016bab, 0x00016b9b, 0x00016b8f, 0x00016b83, 0x00016b5f, 0x00016b4a,
+    0x00016b46, 0x00016b3e, 0x00016b26, 0x00016afe, 0x00016aea, 0x00016ada,
+    0x00016aaa, 0x00016a96, 0x00016a91, 0x00016a85, 0x00016a59, 0x00016a4d,
+    0x00016a49, 0x00016a25, 0x00016a11, 0x000169f9, 0x000169f5, 0x000169b9,
+    0x00016995, 0x0001697e, 0x00016946, 0x00016942, 0x00016936, 0x0001692e,
+    0x00016922, 0x00016906, 0x000168fa, 0x000168e2, 0x000168ce, 0x000168be,
+    0x000168b7, 0x0001689f, 0x0001686b, 0x00016857, 0x00016847, 0x0001683c,
+    0x0001681c, 0x00016818, 0x00016804, 0x000167e1, 0x000167c5, 0x000167b9,
+    0x000167b1, 0x000167a5, 0x0001678a, 0x0001676a, 0x00016766, 0x0001675a,
+    0x00016753, 0x0001673b, 0x00016714, 0x0001670c, 0x000166e4, 0x000166dc,
+    0x000166d1, 0x000166b9, 0x000166b5, 0x0001666f, 0x00016667, 0x0001665b,
+    0x00016657, 0x00016643, 0x00016640, 0x00016614, 0x00016605, 0x000165f9,
+    0x000165e6, 0x000165ce, 0x000165b7, 0x00016594, 0x00016578, 0x00016549,
+    0x00016503, 0x000164fc, 0x000164d5, 0x000164a6, 0x00016493, 0x00016487,
+    0x00016483, 0x0001644d, 0x00016441, 0x0001641e, 0x0001640f, 0x00016407,
+    0x000163fc, 0x000163ec, 0x000163e1, 0x000163d9, 0x000163d5, 0x000163be,
+    0x00016388, 0x00016365, 0x0001634a, 0x0001632b, 0x00016310, 0x000162ee,
+    0x000162db, 0x000162cb, 0x000162c0, 0x000162b8, 0x000162ac, 0x000162a1,
+    0x00016292, 0x00016267, 0x00016250, 0x0001624d, 0x00016239, 0x00016217,
+    0x0001620b, 0x00016208, 0x000161e5, 0x000161d2, 0x000161ce, 0x000161b7,
+    0x000161a4, 0x00016182, 0x00016145, 0x0001613a, 0x00016132, 0x00016127,
+    0x0001611b, 0x0001610c, 0x00016100, 0x000160f5, 0x000160e2, 0x000160bc,
+    0x000160b1, 0x0001609a, 0x00016087, 0x00016078, 0x00016065, 0x0001604a,
+    0x0001603f, 0x0001602c, 0x00016012, 0x0001600a, 0x00016006, 0x00015fdd,
+    0x00015fbb, 0x00015fb7, 0x00015fa4, 0x00015fa0, 0x00015f99, 0x00015f73,
+    0x00015f6b, 0x00015f68, 0x00015f28, 0x00015f24, 0x00015f0d, 0x00015f02,
+    0x00015eef, 0x00015eeb, 0x00015ed9, 0x00015eb7, 0x00015eac, 0x00015e91,
+    0x00015e7b, 0x00015e64, 0x00015e3b, 0x00015e2c, 0x00015e21, 0x00015e03,
+    0x00015df8, 0x00015de9, 0x00015de1, 0x00015dcb, 0x00015dc0, 0x00015db1,
+    0x00015da9, 0x00015d66, 0x00015d5b, 0x00015d50, 0x00015d2b, 0x00015cfe,
+    0x00015cf3, 0x00015cdd, 0x00015cbb, 0x00015ca9, 0x00015ca5, 0x00015c92,
+    0x00015c62, 0x00015c57, 0x00015c3a, 0x00015c2b, 0x00015c20, 0x00015c18,
+    0x00015bec, 0x00015bcb, 0x00015bbc, 0x00015ba6, 0x00015b90, 0x00015b7d,
+    0x00015b5c, 0x00015b46, 0x00015b42, 0x00015b16, 0x00015b0f, 0x00015af9,
+    0x00015ad8, 0x00015ac2, 0x00015aa8, 0x00015a96, 0x00015a92, 0x00015a8b,
+    0x00015a5f, 0x00015a49, 0x00015a2f, 0x00015a1d, 0x00015a12, 0x00015a0e,
+    0x00015a03, 0x000159fc, 0x000159f1, 0x000159c2, 0x000159ba, 0x000159af,
+    0x000159a4, 0x000159a1, 0x00015979, 0x0001596a, 0x00015949, 0x00015942,
+    0x00015921, 0x00015913, 0x0001590c, 0x000158e0, 0x000158dc, 0x000158c7,
+    0x000158b1, 0x000158aa, 0x000158a6, 0x00015848, 0x00015844, 0x00015824,
+    0x00015819, 0x00015812, 0x00015807, 0x000157f1, 0x000157ed, 0x000157e3,
+    0x000157cd, 0x000157bb, 0x000157ac, 0x000157a5, 0x000157a2, 0x00015776,
+    0x00015764, 0x00015761, 0x0001574f, 0x0001574b, 0x00015736, 0x0001572b,
+    0x0001570b, 0x000156c3, 0x000156b8, 0x00015694, 0x00015678, 0x00015674,
+    0x0001565f, 0x00015654, 0x00015642, 0x0001562c, 0x00015629, 0x00015622,
+    0x00015617, 0x000155fe, 0x000155e9, 0x000155d3, 0x000155ac, 0x000155a1,
+    0x00015593, 0x0001558c, 0x00015588, 0x0001556c, 0x0001554c, 0x00015537,
+    0x00015533, 0x00015528, 0x0001550c, 0x00015501, 0x000154fe, 0x000154f3,
+    0x000154ec, 0x000154d7, 0x000154a2, 0x00015493, 0x00015477, 0x00015474,
+    0x00015454, 0x00015442, 0x00015418, 0x00015414, 0x0001540a, 0x000153df,
+    0x000153d8, 0x000153d5, 0x000153ae, 0x000153aa, 0x0001538e, 0x0001538b,
+    0x00015380, 0x0001536b, 0x00015364, 0x00015344, 0x00015336, 0x0001532f,
+    0x00015317, 0x00015310, 0x000152f0, 0x000152c6, 0x000152bc, 0x000152b8,
+    0x000152ae, 0x0001529c, 0x00015299, 0x00015287, 0x00015245, 0x0001523a,
+    0x00015229, 0x00015210, 0x00015206, 0x000151fc, 0x000151d2, 0x000151cb,
+    0x000151c7, 0x000151b2, 0x00015197, 0x0001517e, 0x00015162, 0x0001514e,
+    0x0001514a, 0x00015140, 0x0001512e, 0x00015101, 0x000150fa, 0x000150f7,
+    0x000150e2, 0x000150d8, 0x000150d1, 0x000150bc, 0x000150ae, 0x00015099,
+    0x00015088, 0x00015069, 0x0001505f, 0x00015047, 0x00015016, 0x00015013,
+    0x00015008, 0x00014ff7, 0x00014ff4, 0x00014fed, 0x00014fd5, 0x00014f9a,
+    0x00014f97, 0x00014f8d, 0x00014f67, 0x00014f63, 0x00014f52, 0x00014f3a,
+    0x00014f33, 0x00014f30, 0x00014f14, 0x00014f07, 0x00014ef6, 0x00014eeb,
+    0x00014ede, 0x00014ecd, 0x00014ebf, 0x00014eb8, 0x00014eae, 0x00014eaa,
+    0x00014e8f, 0x00014e85, 0x00014e7b, 0x00014e5c, 0x00014e29, 0x00014e11,
+    0x00014e07, 0x00014e00, 0x00014dcd, 0x00014dc9, 0x00014db8, 0x00014da1,
+    0x00014d9a, 0x00014d78, 0x00014d67, 0x00014d59, 0x00014d53, 0x00014d45,
+    0x00014d26, 0x00014d20, 0x00014d08, 0x00014cfe, 0x00014cf7, 0x00014ccf,
+    0x00014cc4, 0x00014cba, 0x00014c9c, 0x00014c7d, 0x00014c7a, 0x00014c3d,
+    0x00014c33, 0x00014c22, 0x00014c0b, 0x00014bf7, 0x00014bf0, 0x00014be6,
+    0x00014be3, 0x00014bb0, 0x00014ba6, 0x00014b9f, 0x00014b9c, 0x00014b92,
+    0x00014b63, 0x00014b42, 0x00014b3b, 0x00014b19, 0x00014b05, 0x00014add,
+    0x00014ac2, 0x00014aa4, 0x00014a90, 0x00014a79, 0x00014a6f, 0x00014a68,
+    0x00014a54, 0x00014a1f, 0x00014a0b, 0x00014a01, 0x000149f1, 0x000149e3,
+    0x000149d3, 0x000149c9, 0x000149ab, 0x000149a8, 0x0001498d, 0x00014976,
+    0x0001496c, 0x00014948, 0x0001493e, 0x0001492a, 0x00014926, 0x00014909,
+    0x00014902, 0x000148f5, 0x000148c3, 0x000148b0, 0x000148a9, 0x00014895,
+    0x00014892, 0x00014881, 0x00014843, 0x0001481f, 0x0001481b, 0x00014815,
+    0x000147fe, 0x000147f4, 0x000147e0, 0x000147b9, 0x000147b2, 0x000147af,
+    0x000147a9, 0x00014792, 0x0001477e, 0x0001476e, 0x0001476a, 0x00014750,
+    0x00014746, 0x00014726, 0x0001471f, 0x000146ff, 0x000146db, 0x000146c7,
+    0x000146c4, 0x000146bd, 0x000146ba, 0x000146a7, 0x00014683, 0x0001465c,
+    0x00014652, 0x00014648, 0x00014645, 0x0001463b, 0x00014635, 0x0001462b,
+    0x00014628, 0x00014618, 0x00014604, 0x000145f1, 0x000145e7, 0x000145e4,
+    0x000145da, 0x000145c0, 0x000145b3, 0x000145a9, 0x000145a3, 0x00014586,
+    0x00014572, 0x0001455f, 0x00014548, 0x00014542, 0x0001452f, 0x00014525,
+    0x00014518, 0x0001450e, 0x000144f1, 0x000144e8, 0x000144d8, 0x000144c4,
+    0x000144ae, 0x000144a4, 0x0001449e, 0x00014491, 0x0001446d, 0x00014464,
+    0x00014461, 0x00014434, 0x00014417, 0x00014414, 0x000143f7, 0x000143e7,
+    0x000143dd, 0x000143c7, 0x000143b7, 0x000143b4, 0x000143a4, 0x0001438d,
+    0x00014384, 0x00014374, 0x00014370, 0x0001434d, 0x00014344, 0x00014337,
+    0x0001432d, 0x00014314, 0x00014301, 0x000142f4, 0x000142d1, 0x000142ce,
+    0x000142c8, 0x000142b1, 0x00014295, 0x00014282, 0x00014278, 0x00014252,
+    0x00014249, 0x00014239, 0x00014236, 0x00014223, 0x00014200, 0x000141e3,
+    0x000141da, 0x000141ba, 0x000141b1, 0x000141a1, 0x0001418b, 0x00014185,
+    0x00014181, 0x00014178, 0x00014165, 0x00014142, 0x0001412c, 0x00014119,
+    0x00014113, 0x0001410a, 0x000140fd, 0x000140db, 0x000140d7, 0x000140c8,
+    0x000140b5, 0x000140a8, 0x0001406a, 0x00014066, 0x0001405d, 0x0001404d,
+    0x00014041, 0x0001403b, 0x00013ff9, 0x00013fda, 0x00013fd3, 0x00013fa2,
+    0x00013f8f, 0x00013f7f, 0x00013f76, 0x00013f63, 0x00013f51, 0x00013f4d,
+    0x00013f3e, 0x00013f31, 0x00013f28, 0x00013f22, 0x00013f15, 0x00013f0f,
+    0x00013ee7, 0x00013ecb, 0x00013ec5, 0x00013eb8, 0x00013e8d, 0x00013e84,
+    0x00013e68, 0x00013e5f, 0x00013e4c, 0x00013e49, 0x00013e39, 0x00013e30,
+    0x00013e27, 0x00013e11, 0x00013e02, 0x00013def, 0x00013dda, 0x00013db5,
+    0x00013dac, 0x00013da5, 0x00013d87, 0x00013d65, 0x00013d62, 0x00013d46,
+    0x00013d40, 0x00013d37, 0x00013d24, 0x00013d21, 0x00013d09, 0x00013ced,
+    0x00013cd8, 0x00013cce, 0x00013cc5, 0x00013cbf, 0x00013cb6, 0x00013caa,
+    0x00013c8e, 0x00013c88, 0x00013c73, 0x00013c45, 0x00013c3f, 0x00013c23,
+    0x00013c17, 0x00013c08, 0x00013c05, 0x00013bff, 0x00013bf2, 0x00013be0,
+    0x00013bda, 0x00013bc8, 0x00013bac, 0x00013ba9, 0x00013b97, 0x00013b88,
+    0x00013b85, 0x00013b6d, 0x00013b61, 0x00013b5a, 0x00013b2d, 0x00013b2a,
+    0x00013b21, 0x00013af6, 0x00013af3, 0x00013ae4, 0x00013ae1, 0x00013ac6,
+    0x00013ab7, 0x00013aa2, 0x00013a9c, 0x00013a74, 0x00013a6b, 0x00013a50,
+    0x00013a4a, 0x00013a2c, 0x00013a23, 0x00013a1d, 0x00013a11, 0x000139f6,
+    0x000139f0, 0x000139de, 0x000139b7, 0x00013993, 0x0001398d, 0x0001396f,
+    0x0001394e, 0x0001394b, 0x00013930, 0x0001390f, 0x0001390c, 0x00013906,
+    0x000138f4, 0x000138f1, 0x000138e8, 0x000138df, 0x000138d6, 0x000138d0,
+    0x000138c7, 0x000138b2, 0x000138ac, 0x00013889, 0x00013877, 0x0001386e,
+    0x00013853, 0x00013850, 0x0001383e, 0x00013814, 0x00013800, 0x000137fa,
+    0x000137f1, 0x000137e5, 0x000137c4, 0x000137bb, 0x000137aa, 0x0001378f,
+    0x00013783, 0x0001377d, 0x00013760, 0x00013757, 0x00013751, 0x00013748,
+    0x00013745, 0x0001372a, 0x00013722, 0x0001371c, 0x0001370a, 0x000136f8,
+    0x000136ec, 0x000136c3, 0x000136ba, 0x000136ae, 0x000136a0, 0x0001369d,
+    0x00013679, 0x00013668, 0x00013659, 0x00013636, 0x0001362a, 0x0001361b,
+    0x000135fe, 0x000135ed, 0x000135e4, 0x000135d2, 0x000135c1, 0x000135bb,
+    0x000135a6, 0x00013595, 0x00013572, 0x00013540, 0x00013526, 0x0001351a,
+    0x0001350b, 0x00013503, 0x000134e8, 0x000134dd, 0x000134d7, 0x000134cb,
+    0x000134b4, 0x000134a0, 0x00013497, 0x00013491, 0x00013488, 0x00013466,
+    0x00013463, 0x0001345a, 0x00013454, 0x0001344c, 0x00013449, 0x00013431,
+    0x00013429, 0x00013420, 0x00013403, 0x000133e0, 0x000133db, 0x000133d8,
+    0x000133d2, 0x000133be, 0x000133b8, 0x0001339e, 0x0001339b, 0x00013392,
+    0x00013381, 0x0001337b, 0x00013367, 0x00013361, 0x0001335e, 0x00013344,
+    0x0001332d, 0x00013325, 0x0001331c, 0x00013319, 0x00013302, 0x000132e5,
+    0x000132dd, 0x000132d4, 0x000132a9, 0x000132a3, 0x00013298, 0x0001328f,
+    0x0001326d, 0x00013256, 0x0001324d, 0x00013245, 0x00013239, 0x00013228,
+    0x000131fd, 0x000131f8, 0x000131de, 0x000131c4, 0x000131b9, 0x000131b3,
+    0x0001318e, 0x00013180, 0x0001317d, 0x0001315e, 0x00013152, 0x00013144,
+    0x00013130, 0x00013128, 0x00013122, 0x00013108, 0x000130fd, 0x000130ec,
+    0x000130c4, 0x000130c1, 0x000130b9, 0x000130b3, 0x000130a2, 0x0001309a,
+    0x00013078, 0x0001306f, 0x00013064, 0x00013056, 0x0001303a, 0x00013023,
+    0x00013018, 0x00012fed, 0x00012fe5, 0x00012fdd, 0x00012fd7, 0x00012fd4,
+    0x00012fc6, 0x00012fb2, 0x00012faa, 0x00012f9c, 0x00012f6f, 0x00012f50,
+    0x00012f37, 0x00012f34, 0x00012f2e, 0x00012f2b, 0x00012f26, 0x00012f1b,
+    0x00012efc, 0x00012ef1, 0x00012ed7, 0x00012ec7, 0x00012e9f, 0x00012e9d,
+    0x00012e86, 0x00012e76, 0x00012e5c, 0x00012e49, 0x00012e3b, 0x00012e22,
+    0x00012e11, 0x00012e09, 0x00012ddc, 0x00012dce, 0x00012dbb, 0x00012db3,
+    0x00012da5, 0x00012da2, 0x00012d94, 0x00012d91, 0x00012d89, 0x00012d6a,
+    0x00012d68, 0x00012d62, 0x00012d5a, 0x00012d4f, 0x00012d41, 0x00012d39,
+    0x00012d25, 0x00012d1d, 0x00012d17, 0x00012d07, 0x00012cdd, 0x00012cbc,
+    0x00012cb4, 0x00012cac, 0x00012ca1, 0x00012c98, 0x00012c93, 0x00012c90,
+    0x00012c8b, 0x00012c82, 0x00012c77, 0x00012c6f, 0x00012c67, 0x00012c48,
+    0x00012c30, 0x00012c25, 0x00012c1f, 0x00012c1c, 0x00012c04, 0x00012bfb,
+    0x00012bf6, 0x00012bf3, 0x00012bdd, 0x00012bc5, 0x00012ba9, 0x00012b9b,
+    0x00012b93, 0x00012b8b, 0x00012b62, 0x00012b5f, 0x00012b4f, 0x00012b29,
+    0x00012b20, 0x00012b18, 0x00012b10, 0x00012b0d, 0x00012afd, 0x00012aef,
+    0x00012ae4, 0x00012acc, 0x00012ab3, 0x00012aae, 0x00012aa3, 0x00012a8a,
+    0x00012a7d, 0x00012a7a, 0x00012a54, 0x00012a51, 0x00012a44, 0x00012a31,
+    0x00012a2b, 0x00012a29, 0x00012a00, 0x000129f0, 0x000129d2, 0x000129af,
+    0x000129a1, 0x00012996, 0x0001298e, 0x00012981, 0x00012976, 0x00012960,
+    0x0001294e, 0x00012945, 0x0001293d, 0x00012930, 0x0001291d, 0x00012915,
+    0x00012910, 0x0001290d, 0x000128ff, 0x000128ef, 0x000128ed, 0x000128e5,
+    0x000128d7, 0x000128cc, 0x000128c7, 0x000128c4, 0x000128b7, 0x00012894,
+    0x00012876, 0x0001286e, 0x0001286c, 0x0001285c, 0x00012843, 0x0001283e,
+    0x0001281b, 0x00012816, 0x0001280b, 0x000127fe, 0x000127f6, 0x000127e3,
+    0x000127d6, 0x000127d3, 0x000127bb, 0x000127b3, 0x000127a6, 0x0001278b,
+    0x00012783, 0x0001277b, 0x00012776, 0x00012756, 0x00012753, 0x0001274e,
+    0x00012743, 0x0001273b, 0x00012726, 0x00012713, 0x000126fe, 0x000126e6,
+    0x000126e4, 0x000126de, 0x000126ce, 0x000126cc, 0x000126be, 0x000126bc,
+    0x000126b4, 0x000126a4, 0x00012697, 0x0001268f, 0x00012687, 0x0001266c,
+    0x00012664, 0x0001265f, 0x00012657, 0x00012625, 0x00012620, 0x00012618,
+    0x00012608, 0x000125f5, 0x000125f0, 0x000125e0, 0x000125d6, 0x000125c9,
+    0x000125b9, 0x000125a9, 0x0001259f, 0x00012599, 0x00012591, 0x0001257f,
+    0x00012572, 0x0001256a, 0x0001255a, 0x00012558, 0x0001254a, 0x00012533,
+    0x00012530, 0x00012519, 0x0001250b, 0x00012501, 0x000124f4, 0x000124f1,
+    0x000124e2, 0x000124dc, 0x000124ca, 0x000124a5, 0x000124a3, 0x0001248e,
+    0x0001248b, 0x00012474, 0x0001246c, 0x0001245f, 0x00012457, 0x0001244d,
+    0x00012438, 0x00012426, 0x000123fe, 0x000123f1, 0x000123d7, 0x000123d0,
+    0x000123c3, 0x000123a4, 0x000123a1, 0x0001237d, 0x0001237a, 0x0001236a,
+    0x00012356, 0x0001234e, 0x00012344, 0x00012315, 0x00012310, 0x00012306,
+    0x00012300, 0x000122ee, 0x000122df, 0x000122d2, 0x000122c8, 0x000122b8,
+    0x000122b3, 0x000122ab, 0x000122a1, 0x0001229c, 0x00012294, 0x00012282,
+    0x00012266, 0x0001225b, 0x00012254, 0x0001224e, 0x0001224c, 0x0001223f,
+    0x00012237, 0x0001221e, 0x00012211, 0x00012207, 0x000121ff, 0x000121f7,
+    0x000121db, 0x000121c4, 0x000121c1, 0x000121ad, 0x000121a5, 0x0001218c,
+    0x00012186, 0x00012165, 0x00012160, 0x0001214e, 0x00012132, 0x00012120,
+    0x0001211b, 0x0001210c, 0x00012104, 0x000120fa, 0x000120f5, 0x000120ed,
+    0x000120e6, 0x000120c4, 0x000120b8, 0x000120b5, 0x0001209e, 0x00012087,
+    0x00012082, 0x00012080, 0x0001206c, 0x00012069, 0x00012052, 0x0001204d,
+    0x00012045, 0x0001203b, 0x00012036, 0x0001202f, 0x0001201f, 0x0001201d,
+    0x00012015, 0x0001200e, 0x00011fea, 0x00011fba, 0x00011fb5, 0x00011fab,
+    0x00011f97, 0x00011f76, 0x00011f71, 0x00011f6f, 0x00011f62, 0x00011f53,
+    0x00011f50, 0x00011f44, 0x00011f3a, 0x00011f32, 0x00011f25, 0x00011f16,
+    0x00011f14, 0x00011f07, 0x00011f05, 0x00011ee7, 0x00011ee2, 0x00011ebc,
+    0x00011e9b, 0x00011e94, 0x00011e8c, 0x00011e76, 0x00011e6e, 0x00011e67,
+    0x00011e4b, 0x00011e49, 0x00011e3c, 0x00011e26, 0x00011e05, 0x00011e00,
+    0x00011dea, 0x00011de0, 0x00011dd8, 0x00011dd1, 0x00011dc2, 0x00011dae,
+    0x00011da6, 0x00011d9d, 0x00011d89, 0x00011d81, 0x00011d77, 0x00011d63,
+    0x00011d61, 0x00011d2d, 0x00011ce5, 0x00011cdb, 0x00011cd6, 0x00011cce,
+    0x00011ccc, 0x00011cc7, 0x00011cbd, 0x00011ca9, 0x00011ca2, 0x00011c89,
+    0x00011c84, 0x00011c75, 0x00011c67, 0x00011c5f, 0x00011c50, 0x00011c4e,
+    0x00011c42, 0x00011c3f, 0x00011c38, 0x00011c1d, 0x00011c1a, 0x00011c0e,
+    0x00011c07, 0x00011bfd, 0x00011bf5, 0x00011be9, 0x00011bd8, 0x00011bd0,
+    0x00011bc9, 0x00011bc4, 0x00011bae, 0x00011ba4, 0x00011b98, 0x00011b8e,
+    0x00011b7a, 0x00011b69, 0x00011b5d, 0x00011b5b, 0x00011b4e, 0x00011b4c,
+    0x00011b3d, 0x00011b36, 0x00011b31, 0x00011b18, 0x00011b0c, 0x00011b02,
+    0x00011ac3, 0x00011ab9, 0x00011aad, 0x00011aa6, 0x00011aa3, 0x00011a97,
+    0x00011a8d, 0x00011a81, 0x00011a7a, 0x00011a73, 0x00011a69, 0x00011a5d,
+    0x00011a5a, 0x00011a3f, 0x00011a3d, 0x00011a38, 0x00011a31, 0x00011a20,
+    0x00011a1b, 0x00011a19, 0x000119fb, 0x000119ed, 0x000119e8, 0x000119c9,
+    0x000119b3, 0x000119ae, 0x000119a7, 0x00011996, 0x00011971, 0x0001196a,
+    0x00011965, 0x0001195e, 0x0001195c, 0x00011941, 0x00011937, 0x00011933,
+    0x0001192b, 0x00011929, 0x0001190e, 0x00011907, 0x000118fe, 0x000118ea,
+    0x000118e3, 0x000118d2, 0x000118cd, 0x000118c6, 0x000118b1, 0x000118a7,
+    0x00011899, 0x00011891, 0x00011883, 0x00011866, 0x00011842, 0x0001182f,
+    0x00011825, 0x000117fd, 0x000117f3, 0x000117d9, 0x000117d2, 0x000117c1,
+    0x000117b5, 0x0001179f, 0x0001178f, 0x0001178a, 0x0001177c, 0x00011772,
+    0x0001176d, 0x00011743, 0x0001173b, 0x00011734, 0x00011732, 0x00011726,
+    0x00011724, 0x0001171f, 0x00011707, 0x00011700, 0x000116f9, 0x000116ed,
+    0x000116df, 0x000116d8, 0x000116d5, 0x000116a6, 0x0001169c, 0x00011695,
+    0x00011674, 0x0001166d, 0x0001166b, 0x0001165c, 0x00011647, 0x00011642,
+    0x00011626, 0x00011616, 0x0001160e, 0x00011607, 0x000115fc, 0x000115e4,
+    0x000115d8, 0x000115c8, 0x000115b5, 0x000115a4, 0x00011592, 0x0001158b,
+    0x00011581, 0x00011557, 0x00011552, 0x00011544, 0x00011536, 0x0001152f,
+    0x00011521, 0x000114e6, 0x000114d8, 0x000114d1, 0x000114cd, 0x000114c6,
+    0x000114bf, 0x000114b5, 0x000114ae, 0x000114a3, 0x000114a0, 0x00011495,
+    0x00011492, 0x0001147d, 0x00011472, 0x00011461, 0x0001144f, 0x00011445,
+    0x0001143e, 0x0001143a, 0x00011422, 0x0001141e, 0x0001141b, 0x00011410,
+    0x00011409, 0x000113f9, 0x000113e4, 0x000113d8, 0x000113ac, 0x000113a0,
+    0x0001138b, 0x00011389, 0x0001137e, 0x0001137b, 0x0001136d, 0x00011369,
+    0x00011366, 0x00011362, 0x00011352, 0x0001134b, 0x0001133f, 0x00011336,
+    0x00011308, 0x00011301, 0x000112ea, 0x000112e5, 0x000112d7, 0x000112ce,
+    0x000112c7, 0x000112a0, 0x00011297, 0x0001127d, 0x00011274, 0x00011266,
+    0x0001125b, 0x00011259, 0x00011246, 0x00011216, 0x00011208, 0x000111ff,
+    0x000111e6, 0x000111dd, 0x000111c4, 0x000111bb, 0x000111b4, 0x0001118d,
+    0x0001118b, 0x00011184, 0x0001117f, 0x0001116f, 0x00011168, 0x00011156,
+    0x00011154, 0x0001113b, 0x00011134, 0x0001112b, 0x0001110f, 0x000110f6,
+    0x000110f0, 0x000110ed, 0x000110e0, 0x000110db, 0x000110d4, 0x000110c4,
+    0x000110c0, 0x000110b7, 0x0001109c, 0x00011097, 0x00011090, 0x00011089,
+    0x00011087, 0x0001106e, 0x00011058, 0x00011051, 0x0001104c, 0x0001103c,
+    0x00011038, 0x00011031, 0x0001102a, 0x00011021, 0x0001101b, 0x0001100f,
+    0x00011008, 0x00010fff, 0x00010ff9, 0x00010fe7, 0x00010fd7, 0x00010fd0,
+    0x00010fc9, 0x00010fb0, 0x00010faa, 0x00010f8f, 0x00010f6b, 0x00010f64,
+    0x00010f50, 0x00010f49, 0x00010f35, 0x00010f2a, 0x00010f21, 0x00010eff,
+    0x00010eeb, 0x00010ee4, 0x00010ed2, 0x00010ec5, 0x00010ebe, 0x00010eb1,
+    0x00010eae, 0x00010ea8, 0x00010ea3, 0x00010e96, 0x00010e8d, 0x00010e86,
+    0x00010e6e, 0x00010e65, 0x00010e5e, 0x00010e5a, 0x00010e4a, 0x00010e3f,
+    0x00010e2b, 0x00010e14, 0x00010e09, 0x00010e07, 0x00010e00, 0x00010dfc,
+    0x00010dfa, 0x00010ddb, 0x00010dc7, 0x00010dc4, 0x00010db9, 0x00010db3,
+    0x00010dac, 0x00010da5, 0x00010d96, 0x00010d69, 0x00010d4f, 0x00010d4d,
+    0x00010d48, 0x00010d3f, 0x00010d32, 0x00010d2e, 0x00010d18, 0x00010d13,
+    0x00010cf0, 0x00010cdc, 0x00010cca, 0x00010cc4, 0x00010c9c, 0x00010c93,
+    0x00010c8d, 0x00010c88, 0x00010c82, 0x00010c72, 0x00010c6e, 0x00010c67,
+    0x00010c4b, 0x00010c44, 0x00010c39, 0x00010c2a, 0x00010c16, 0x00010c0b,
+    0x00010c04, 0x00010bfe, 0x00010bef, 0x00010be4, 0x00010bdd, 0x00010bd6,
+    0x00010bc7, 0x00010bc1, 0x00010ba6, 0x00010ba2, 0x00010b93, 0x00010b7b,
+    0x00010b72, 0x00010b65, 0x00010b5a, 0x00010b51, 0x00010b44, 0x00010b31,
+    0x00010b26, 0x00010b12, 0x00010b09, 0x00010aef, 0x00010ae4, 0x00010adc,
+    0x00010ad7, 0x00010abd, 0x00010ab7, 0x00010aa3, 0x00010a9d, 0x00010a9b,
+    0x00010a90, 0x00010a6f, 0x00010a6d, 0x00010a62, 0x00010a60, 0x00010a5c,
+    0x00010a59, 0x00010a2e, 0x00010a2c, 0x00010a0e, 0x00010a05, 0x000109ff,
+    0x000109f8, 0x000109e5, 0x000109de, 0x000109d4, 0x000109c4, 0x000109c0,
+    0x000109ad, 0x0001098c, 0x00010979, 0x00010977, 0x0001096a, 0x0001094a,
+    0x00010943, 0x00010923, 0x0001091f, 0x0001090c, 0x000108ff, 0x000108fd,
+    0x000108f8, 0x000108e9, 0x000108e3, 0x000108d8, 0x000108d2, 0x000108c9,
+    0x000108c3, 0x000108b8, 0x000108ab, 0x000108a9, 0x000108a3, 0x00010896,
+    0x0001088b, 0x00010889, 0x00010876, 0x00010872, 0x0001085c, 0x00010858,
+    0x00010852, 0x00010843, 0x0001083c, 0x00010836, 0x0001081e, 0x00010818,
+    0x00010812, 0x00010809, 0x000107f6, 0x000107e3, 0x000107d8, 0x000107d6,
+    0x000107cb, 0x000107c9, 0x000107c3, 0x000107bf, 0x000107b8, 0x000107ac,
+    0x00010799, 0x00010796, 0x0001078c, 0x00010783, 0x0001077f, 0x0001076c,
+    0x0001076a, 0x00010764, 0x0001075d, 0x00010757, 0x0001074c, 0x00010744,
+    0x00010739, 0x00010733, 0x00010720, 0x00010713, 0x0001070b, 0x000106fe,
+    0x000106f8, 0x000106f4, 0x000106ed, 0x000106de, 0x000106ce, 0x000106cc,
+    0x000106bf, 0x000106bb, 0x000106b4, 0x0001068c, 0x00010686, 0x00010680,
+    0x0001066f, 0x0001065a, 0x0001063c, 0x00010628, 0x0001061d, 0x00010617,
+    0x00010610, 0x00010602, 0x000105fe, 0x000105e2, 0x000105de, 0x000105d0,
+    0x000105c5, 0x000105b2, 0x000105a4, 0x00010586, 0x00010584, 0x00010580,
+    0x00010572, 0x00010561, 0x0001055f, 0x00010542, 0x0001053b, 0x00010533,
+    0x0001052d, 0x00010509, 0x00010501, 0x000104fd, 0x000104ea, 0x000104e8,
+    0x000104d8, 0x000104cf, 0x000104c9, 0x000104a0, 0x00010497, 0x00010485,
+    0x00010480, 0x00010461, 0x0001045b, 0x0001044f, 0x0001044d, 0x0001042e,
+    0x00010427, 0x0001041d, 0x0001040f, 0x000103e5, 0x000103d7, 0x000103cd,
+    0x000103cb, 0x000103be, 0x000103b4, 0x000103ac, 0x000103a8, 0x0001039f,
+    0x00010399, 0x00010393, 0x00010376, 0x00010374, 0x00010370, 0x00010364,
+    0x00010355, 0x00010345, 0x0001033d, 0x0001031e, 0x0001030e, 0x000102fb,
+    0x000102f9, 0x000102ef, 0x000102dd, 0x000102d6, 0x000102b6, 0x000102b2,
+    0x0001029f, 0x00010299, 0x00010297, 0x0001028b, 0x00010281, 0x0001026e,
+    0x0001026c, 0x00010266, 0x0001025c, 0x0001024e, 0x0001023b, 0x0001021f,
+    0x00010219, 0x00010211, 0x00010200, 0x000101fe, 0x000101fa, 0x000101e6,
+    0x000101dc, 0x000101d4, 0x000101c2, 0x000101b7, 0x000101b5, 0x000101ab,
+    0x000101a3, 0x0001019f, 0x00010199, 0x0001018d, 0x00010187, 0x00010173,
+    0x0001016f, 0x0001016d, 0x00010166, 0x00010162, 0x0001014e, 0x00010144,
+    0x0001012a, 0x00010118, 0x0001010e, 0x0001010c, 0x000100f9, 0x000100f3,
+    0x000100e3, 0x000100d5, 0x000100d1, 0x000100b7, 0x000100b3, 0x000100a5,
+    0x0001009b, 0x0001008f, 0x00010081, 0x0001007b, 0x00010075, 0x00010071,
+    0x00010063, 0x00010059, 0x00010057, 0x00010039, 0x00010027, 0x00010011,
+    0x0001000f,
+};
+
+const big_uint PRIMORIALS[NUM_PRIMORIALS] = {
+    0xe221f97c30e94e1d, 0x6329899ea9f2714b, 0x58edcb4c9ed39c8b,
+    0x09966ff94fd516fb, 0x3bd7632c1f36eb51, 0x00fd14b3c90d88a9,
+    0x02ad3dbe0cca85ff, 0x0787f9a02c3388a7, 0x1113c5cc6d101657,
+    0x2456c94f936bdb15, 0x4236a30b85ffe139, 0x805437b38eada69d,
+    0x00723e97bddcd2af, 0x00a5a792ee239667, 0x00e451352ebca269,
+    0x013a7955f14b7805, 0x01d37cbd653b06ff, 0x0288fe4eca4d7cdf,
+    0x039fddb60d3af63d, 0x04cd73f19080fb03, 0x0639c390b9313f05,
+    0x08a1c420d25d388f, 0x0b4b5322977db499, 0x0e94c170a802ee29,
+    0x11f6a0e8356100df, 0x166c8898f7b3d683, 0x1babda0a0afd724b,
+    0x2471b07c44024abf, 0x2d866dbc2558ad71, 0x3891410d45fb47df,
+    0x425d5866b049e263, 0x51f767298e2cf13b, 0x6d9f9ece5fc74f13,
+    0x7f5ffdb0f56ee64d, 0x943740d46a1bc71f, 0xaf2d7ca25cec848f,
+    0xcec010484e4ad877, 0xef972c3cfafbcd25, 0x002a442c1ebb3be5,
+    0x00303fa164bdc919, 0x0036521ca14fd8e7, 0x003ca3241ed069e3,
+    0x0043885d3035c59b, 0x004e1aee1fa9d559, 0x0054469dbe5d6c77,
+    0x005e49791f7429a1, 0x006b2ceda4198e53, 0x007339d26e3d1ce3,
+    0x007e2ee3b8aa6bf3, 0x008ae9bb5cda9301, 0x0096e917373cdca7,
+    0x00a211e4fecdf953, 0x00b8ff2efb3033cf, 0x00cbaca970bdfe31,
+    0x00db2c9f75b49027, 0x00ed9fb524fe759d, 0x01007595a2312fc7,
+    0x0111eccd0898675f, 0x012546177b06c0bf, 0x013e5b450710a16f,
+    0x0164d74c38c8e863, 0x01836887063c20bb, 0x01ab250719364c7b,
+    0x01d1d99745c88d5b, 0x01ec730b953d1a27, 0x02021f7b6341a9ab,
+    0x021e792f0d4ca61d, 0x0249015c16a93885, 0x026f0f9a480c48e5,
+    0x029bc3143b9a5a89, 0x02d26abb44109333, 0x030a7492f008069d,
+    0x0343b19b9edc33a7, 0x0385a3fb2c68b433, 0x03c555b3dbe9ef83,
+    0x0411e43a3a8d394b, 0x04775710b7a55833, 0x04b76972a22d55a1,
+    0x0507bfe226ee0079, 0x056a838dee32fff3, 0x05ac8589165200e9,
+    0x05f667749eb2f963, 0x065dd3fc17e3c099, 0x06e031d955a9fef9,
+    0x0742ec64b53bfdff, 0x07a5cbcb6bae243d, 0x07f7fcb28a3d7137,
+    0x086be427bf5de82d, 0x08d9ca434d0399a5, 0x09638c123bcab351,
+    0x09db5cdd2505eabd, 0x0a7882ea2d1e207f, 0x0b1a70a51fba0b75,
+    0x0bbabeb6f4cc2177, 0x0c68a56113938121, 0x0ce86607deddbe4b,
+    0x0daca6d46347064f, 0x0e6f9cb2334ec11f, 0x0f25ac800485a171,
+    0x0ff8f0253a89a32d, 0x10ccedf304c329c1, 0x11bab365a0306ad1,
+    0x12bc79f95534c5d9, 0x136918855651cae7, 0x1441022b5202f195,
+    0x1597271595caf351, 0x16d6d391503c0abb, 0x180c60c57c2aa2eb,
+    0x1931ed2425952793, 0x1a4ad806a56da143, 0x1bab1dcc65ac15db,
+    0x1d309fb6e722f0e1, 0x1e414485a1b107bf, 0x1f9aa68df17c076b,
+    0x212b81780b580e97, 0x23006478f7a04647, 0x244664b9e9752837,
+    0x26cb4c8923562f31, 0x2885c6c7b07c160f, 0x29cdb8dbe624c3c1,
+    0x2b4a321722f3b1ef, 0x2ca3b94e7373f36d, 0x2efa302d0838fad3,
+    0x30b3fdb20c872a5b, 0x33591223fefd974b, 0x35c12a863f50eaa9,
+    0x383533808bd74477, 0x3ac02a15fc89c54d, 0x3e12cc83606624f3,
+    0x405f92575cd90b87, 0x42211307d533e619, 0x44b8a22c7f3df3c3,
+    0x46d3dca711bbaec5, 0x49a4f62f2bee3201, 0x4d746a3fda9d6ec3,
+    0x5024bb19621ceac3, 0x528d8d1989f23337, 0x55b4c3f0688fa659,
+    0x599291b29311407f, 0x5cc7a1b4f6df9823, 0x5f42cbfa215ab3fd,
+    0x616db4fe760c22b9, 0x65ad151b5817da41, 0x6c2e75f079f3deef,
+    0x706dd813a4085937, 0x73edc48854faa299, 0x77f1e576ffed49b9,
+    0x7cc13fe542982693, 0x80cedb56d0c02049, 0x858f4783e6ff5cf3,
+    0x892e6d86008f82e3, 0x8d040c52d7c6ab79, 0x90b53592209da955,
+    0x954fb9d96ab9ea1d, 0x9caf15af4ce7fcf7, 0xa47dbf171698939f,
+    0xa9712f0456e54591, 0xaeed828a42377403, 0xb68603f5eadb8545,
+    0xbb2bd5d42428b71d, 0xc165b45b4e412e49, 0xc8348a8471e75ca3,
+    0xce5ab711e7179571, 0xd4287981935f5b7f, 0xdb9c1eff1b938a91,
+    0xe2e20afc369136ff, 0xe78c749d7a119695, 0xedfa86764fa767e1,
+    0xf7780828d01fcef9, 0x0009311da8eb3ea1, 0x00096fc1b51999b5,
+    0x00099d2dc5aa820b, 0x0009c18c1a21f755, 0x000a019a0d84ce05,
+    0x000a3837104af50b, 0x000a74ba276e925b, 0x000ad0c05b3ae661,
+    0x000b0da5211cc3e7, 0x000b36ca8c3991af, 0x000b6694790c60df,
+    0x000b89a345c48d7d, 0x000bb02a8b8a132b, 0x000bd6468bb171ff,
+    0x000c17671b548641, 0x000c57f07d496e1b, 0x000c814b88200ac3,
+    0x000cb958ba8e9259, 0x000cfaa956d67517, 0x000d56380a0e8273,
+    0x000d9c8b65d94f5b, 0x000dc90a482debcb, 0x000e0ac9922e6235,
+    0x000e4aa6969c4449, 0x000eb0ca4d2b0965, 0x000f08c969789d43,
+    0x000f3c97c77c730f, 0x000f7aa31273931b, 0x000fd32e0bae7a77,
+    0x00102419fda6cc01, 0x001058b57cd1fec9, 0x0010a468ac696a55,
+    0x0010d824894d6521, 0x001131219641c957, 0x001186346cb9c4a7,
+    0x0011e75887c6bcbf, 0x001226c3d8919ad3, 0x0012ae54ca9118b3,
+    0x0012f2143ddeb927, 0x0013522200caeeb3, 0x0013a21ad000a461,
+    0x0013ef7c7f69a93d, 0x001436a05ef17841, 0x00147142f4cc4c17,
+    0x0014b887295ec96d, 0x001501b9fe3efaad, 0x00156d3ebd5cfffb,
+    0x0015af86361077ad, 0x0015fc898c07b90f, 0x00167c836a7cdf2b,
+    0x0016db56bc574209, 0x00174097de2edf3b, 0x00178dbdb0cfb9fb,
+    0x0017e109fd2af3fb, 0x0018716adbb946f7, 0x0018d7bc2e97eaef,
+    0x00192e69d59ba8db, 0x00198a3cddb561c9, 0x0019e876c274e4fd,
+    0x001a63555c2e680b, 0x001ad58f177dacbb, 0x001b29f0db4b3395,
+    0x001ba4b691e66139, 0x001bfc87fc12613d, 0x001c3e250dac9d87,
+    0x001c944c9149df3b, 0x001cff79f4c205cd, 0x001d75566cb1adb3,
+    0x001e3cd7b5975575, 0x001e92a4033b7417, 0x001f0502cb33d8c7,
+    0x001f8943169b2d87, 0x001ffcaebc1a4bad, 0x0020730086c8cb89,
+    0x0020d7b89585d217, 0x002147bfe14a8231, 0x0021ae6440d699bf,
+    0x0022306f8188c6fb, 0x0022a5af39a69703, 0x00235eedc5de5805,
+    0x002441e04ba35085, 0x0024b8a97a3a59a5, 0x00252362655a4d67,
+    0x0025ab86b8cc3567, 0x00260aea245bc247, 0x0026b855f8b70077,
+    0x002750993dd1e65b, 0x0027bafa8c9f7853, 0x0028402b9d2d22dd,
+    0x0028a66d2d4fc087, 0x00298166c0739b53, 0x002a40d5220cbed9,
+    0x002ab7670bbab197, 0x002b5b38f61706df, 0x002c3429fa1e037f,
+    0x002ceda9fa3b4a9f, 0x002d7b4d561f2739, 0x002e05d3caae9813,
+    0x002eb7851a14c29b, 0x002f3e1d077d25cf, 0x003010f41dbeb6ed,
+    0x00311729b61dd159, 0x00318dceb77a5837, 0x00321cd33785cdf1,
+    0x0032fdf49691bc63, 0x0033b1c5f5f30ced, 0x0034a6c59cb6d8d7,
+    0x00355c9029e55dd3, 0x0035fb2d1ac371b7, 0x0036b44bc2249a47,
+    0x003750e273f3b60f, 0x00385ce9399c0f85, 0x00391ecbd93a9e67,
+    0x0039cd91131ee8e5, 0x003a887d9033256b, 0x003b77f83e7b7b77,
+    0x003c5f7ed2eca1bf, 0x003d367feec26269, 0x003debdb2f48a479,
+    0x003eab0afe5d537b, 0x003fd435f4d431e7, 0x0040b45ff452cb31,
+    0x00420775fbceaf6d, 0x0042c7627aefc08d, 0x0043e44dcc615d67,
+    0x0044c330cdfdeb7d, 0x00456af335c23b75, 0x004610d2c7c0027b,
+    0x0047384e9bf4bfad, 0x0047fa259c013ba3, 0x0048950fc7f50b43,
+    0x004956836a576163, 0x004a7b8c3c557b65, 0x004b771e5db917ef,
+    0x004c5834105e9dfb, 0x004d37df06ec25d9, 0x004e3707bf47eca5,
+    0x004f77e5a59ceea7, 0x00503ced574122d5, 0x0050f93a4e9e43e9,
+    0x005242764cb96dbf, 0x005373ff17a4f379, 0x00544ac8e491c7d9,
+    0x005534b35cc8f027, 0x0056405cd1d8f29b, 0x0056ee39496a06dd,
+    0x0057cf4552f1e303, 0x0058b59c4b50c127, 0x0059a507c3dbf24b,
+    0x005a92a6fbea27b9, 0x005b7e66124ac799, 0x005cab65d44446ef,
+    0x005de6905c90b503, 0x005f37e803c461fd, 0x0060383597fe3f4f,
+    0x0061e147bd94922b, 0x0062cb93e709f30f, 0x0063bb5109ddbb39,
+    0x0064b4ccd52a2a97, 0x0065a00fb544939d, 0x0066bd48d7520557,
+    0x00684ac380bf1aaf, 0x006975d3e0fb99e1, 0x006a96fad34eb5c9,
+    0x006b9092527de0b5, 0x006cfda2f8b38f6f, 0x006e72811aacaeab,
+    0x006fd5b0d3d77ca9, 0x00710c5f58855659, 0x0072c045f81a9571,
+    0x00740178628c8d1f, 0x007518d8f35a1ee9, 0x0076a24bc5928fc9,
+    0x00788a7d5fa3bc21, 0x007a0a454ddc12d9, 0x007b9b6dbf0acbfb,
+    0x007cb724b29c97e9, 0x007d80316c3aea0b, 0x007e9f02956774f9,
+    0x007fd78ff30e55dd, 0x008176f93dcdee1b, 0x0083328f181f37ff,
+    0x00844c85844f1ec7, 0x00854fb5954cd2e9, 0x00871ee1f72316ed,
+    0x0088f30d5a797dc9, 0x008a8f2c1377c21d, 0x008c01286e805837,
+    0x008e7712e261c25d, 0x008ffb253ef4179f, 0x00921fbe50feef75,
+    0x00948a2d689dccf3, 0x0095ffe36390e923, 0x0098301d5150c82f,
+    0x009965ca922eda71, 0x009a81df9eec8585, 0x009c4ff7ceb26e9d,
+    0x009e7b7d2e8d6945, 0x009f6c20cfec7617, 0x00a1123741d60349,
+    0x00a2d85d546633e9, 0x00a4576a38b2e863, 0x00a67b26cfff14d5,
+    0x00a7a939b6101c2d, 0x00a8bb9c6b89238b, 0x00aa21a4d7b7405d,
+    0x00abdd00ad8a3843, 0x00ad89beafbcecf3, 0x00af157a9999de1f,
+    0x00b1110edec9a5e7, 0x00b2ec08779af98f, 0x00b5ce53e09d2f3f,
+    0x00b7c5c4781d9095, 0x00b96f6c6a96abdd, 0x00bafc6885e3168f,
+    0x00bd0b3001c2ab99, 0x00bf1e4f7b977da3, 0x00c0ee974c1790ef,
+    0x00c212689f25e9f9, 0x00c38c7410bf9f6d, 0x00c53d3b77e95ec1,
+    0x00c6d6676a24b785, 0x00c8dc92eb084079, 0x00cab7c97e4138b7,
+    0x00ccb801fca0605b, 0x00cf6d7cde4092fb, 0x00d18469c261e6c3,
+    0x00d3b42996b0bdb9, 0x00d51ddde8b08f41, 0x00d67b51630925a1,
+    0x00d99e59550f2a79, 0x00dad6953d7f1dd1, 0x00dcad7b308da3e5,
+    0x00de2292a6fcea5d, 0x00e1b23855987db9, 0x00e334f8b6afdf7f,
+    0x00e50a7b9858495b, 0x00e7e682b8bf2479, 0x00eb233492811e73,
+    0x00ecd06546792379, 0x00ee614fd24f6a7b, 0x00f075d4fedaff7f,
+    0x00f3f7d1dd9b8379, 0x00f634c782b06375, 0x00f85e2efe701057,
+    0x00fc35555b41ed55, 0x00fe88c851df5e87, 0x010178b05712fdab,
+    0x01037c79874034cf, 0x0105b3f595bfc677, 0x0108bbdd3e80d6e1,
+    0x010b6784171f41e3, 0x010ebed7b345c171, 0x0110dec33752e3fb,
+    0x0112f95df390c71b, 0x0115857cb9505c11, 0x011896b488206ddd,
+    0x011c980326aa39b7, 0x011faf4ab1583fd9, 0x01220baffbb4ec13,
+    0x01242dedee2cf32b, 0x0127288318f1acbf, 0x0129a270b7054fd5,
+    0x012b5a5ab872cdbb, 0x012e62cc7d0c5137, 0x013143b94b078845,
+    0x0135191659b6b873, 0x01371e6d3f15a77b, 0x013ae591040c738b,
+    0x013ec8d38cf64eab, 0x014109a378f8e2a9, 0x0143e60be9b7a323,
+    0x0145a782e07019dd, 0x014851f13198d22f, 0x014b448a295b1a93,
+    0x014cf066cc1eda97, 0x01509b6a2d694463, 0x0153888c5514c6bf,
+    0x01560307d2667eab, 0x015a1186ebaca99f, 0x015d54d0562da4a1,
+    0x016089df1dbd1c67, 0x01640c263de87b6b, 0x0167be6ae7200d73,
+    0x016b77f2cf3a4d03, 0x016e09542573e129, 0x01707e77c14553e1,
+    0x017336530b2481cd, 0x0176bbcd2b4de353, 0x017971f613e8e371,
+    0x017ced5a3630bb53, 0x017fabf200521269, 0x01826e128127b82f,
+    0x0186305ea4ff0fe3, 0x0188b968d29ee5c1, 0x018b8812e2614827,
+    0x018e9d947c879fb1, 0x0191690bbb2b8975, 0x0195526af351eac3,
+    0x0198dcb201afa47f, 0x019b71865d1e1edf, 0x019ec0fbad93d86f,
+    0x01a266b389d857f5, 0x01a61de64de776a1, 0x01abb0f12d9694b9,
+    0x01b11732d0b9014f, 0x01b4e781862fadab, 0x01b8a6265810186f,
+    0x01bc8f38b80fb199, 0x01c3d614a01edffb, 0x01c7a111ba35aac9,
+    0x01ccda1918d36df1, 0x01d1309b2051b287, 0x01d5a81d615749b9,
+    0x01d9827a0e604545, 0x01ded6186cacf0d7, 0x01e3263dbb001387,
+    0x01e639e9f683f351, 0x01ea1481cf59a2d1, 0x01ee85125a17f4d3,
+    0x01f5289e1464e911, 0x01f80f97a33bc0d9, 0x01fa2467e7455179,
+    0x01fca5cf98eec3b1, 0x01ff0ecab9e59fe5, 0x02026ca9626f9bfd,
+    0x0206dea1a602ef35, 0x020a61c911337f61, 0x02106f2b1309f57f,
+    0x0216ded5b9ec5121, 0x021abc8524a0867f, 0x021df720da2d9d25,
+    0x0222c0b0bb7a24cf, 0x0227842c29f87a33, 0x022c07daf1caec59,
+    0x0230dae199d4b645, 0x0234eafd67c98f85, 0x023834e8b38660e1,
+    0x023bda2835948899, 0x024042e3fa45c223, 0x0244fc4333cfb5b3,
+    0x0247fee86550e3af, 0x024b6cf30ea5fd81, 0x0250829b6a84c113,
+    0x0255bf2f2306c361, 0x025c535aa7f5e583, 0x026080ca5a7bf2eb,
+    0x02637fdb127b46ff, 0x026797ccf79c7f3b, 0x026d1a1cccc73c99,
+    0x0272c5771db4d6d3, 0x0277ecdbc181828f, 0x027cdcb2258487a3,
+    0x0283732b66cf18c7, 0x028a8713fd082d71, 0x028fc3a0a032e5d7,
+    0x0292ded2e441da69, 0x0297121fc782b77d, 0x029f0449cc9ff6f9,
+    0x02a4a2f14e2c958b, 0x02a8db4d5b0fda85, 0x02ae03469a82a673,
+    0x02b332b7dc69b1c1, 0x02b5e6b09d249fcb, 0x02bc0f821cc8c845,
+    0x02c276373272a055, 0x02c74ac5c4b2774d, 0x02cb22171da031a7,
+    0x02cf6579f5c55f35, 0x02d705e1bdb390bd, 0x02ddbf17895a6381,
+    0x02e3aefe09c42de5, 0x02e8206f28d20955, 0x02ed7f117b2327df,
+    0x02f56ed0c704da69, 0x02f88a12f25e2451, 0x02fd131b841b40b1,
+    0x0301a1a0b3902ea9, 0x03055925fc58d879, 0x0309de5cadbca4e3,
+    0x0310cbcfd2b0891b, 0x0317fd19f60c9a4d, 0x031ccf9af41ec199,
+    0x03229c99f241a3a7, 0x03280009db526951, 0x032c8613eccace03,
+    0x0333d47383a88d7b, 0x033b696baf7c3b81, 0x0341c21d06927029,
+    0x03463cca1724ea87, 0x034af6afa696db8b, 0x034fa2000c8b112d,
+    0x03548d7a1e704565, 0x0358b871e1453919, 0x03612d7fb9ab9847,
+    0x0369dbb728a0b841, 0x036cd818cc2e1d29, 0x03752221dd54d4ef,
+    0x037bf7fb5fb2ff1f, 0x0383a4caed84ec9f, 0x0389eaa5e65bfe1b,
+    0x0391ecbfb00ee5ed, 0x0397dd4ca7c7ff7f, 0x039fe1dbf447811f,
+    0x03a5cee3a2607503, 0x03acac3998e6d409, 0x03b13e26015d5acb,
+    0x03b5e9abe9445bb7, 0x03bc87c44ef9f2c5, 0x03c3c5b7f6157b81,
+    0x03cb65b47f066d95, 0x03d3d5d109d15d57, 0x03db4be06422bb69,
+    0x03e33b83348942e9, 0x03e737ee74ba429d, 0x03eb4da6a8fa5c67,
+    0x03ef5031b4a64aff, 0x03f78b5f10a31a23, 0x040044e6e9df0bb1,
+    0x0405ac465f11236f, 0x040f4a65869d592b, 0x0416bae1b618a8e1,
+    0x041c7e2175eeb881, 0x042474524212fcc1, 0x043035434b149aeb,
+    0x043bf75cafffc64f, 0x0443ec2284e30c93, 0x04481a26b0b4a839,
+    0x044e41154dbb09fd, 0x04534e9617c28679, 0x045b337d4d5597b9,
+    0x04629139384abf75, 0x046a8b710c183935, 0x04708dbe7550d787,
+    0x04783847cd1f9be3, 0x047f0e02d972ed25, 0x048525846d30850f,
+    0x048a62fb62958baf, 0x04951dac5bfc2c2b, 0x049baff49dd1395d,
+    0x04a1caf7e8af85b9, 0x04a91c809afbf3bd, 0x04ae5fad1e34a8bf,
+    0x04b241c33541fc09, 0x04ba406302aa23c5, 0x04c2b08c52443cbd,
+    0x04cade5e4ef71c2f, 0x04da04bdd8627ded, 0x04e5315af79ba153,
+    0x04ecd20879e358d7, 0x04f42bc5897ea255, 0x04fe0ed11aac86af,
+    0x0506888972068255, 0x05112889cf60e287, 0x051ed3c0c55d0405,
+    0x052792aab8b41b8d, 0x05329df7da95e2cf, 0x053ca69e541e15a5,
+    0x05464e0045860f6b, 0x054eeaf49a03e005, 0x055954a13d821ddb,
+    0x05629617909d1ccb, 0x056972a7c7cbba43, 0x057491e36248a513,
+    0x058051adfc3bec21, 0x05886b3e3c8cd9c9, 0x05908dc3fded79e1,
+    0x0599dbf2a16de5bd, 0x05a2fc0748851a6d, 0x05adfd2d9fdee11d,
+    0x05b60def667a0fb9, 0x05bdce2eace2b75b, 0x05c8bb1c839ff683,
+    0x05d231dc198f1875, 0x05d9d1b5dc5e8d9f, 0x05eaf0a230b22005,
+    0x05f30502c290b0a9, 0x05f9d0e54c6a4117, 0x060231a8be86c16f,
+    0x060aba05f0dbfd6d, 0x061632ff9c470def, 0x061f2dfa454376ff,
+    0x0629c973f7ac0095, 0x063492798845b205, 0x064027252c0e1469,
+    0x0647b3d0049db59b, 0x065124cd727a8597, 0x065a00ed27265351,
+    0x06646784a070a66b, 0x067285a1f9072bbf, 0x067ba4bb61b64513,
+    0x0684eeab37910a39, 0x068ee60abfb360bd, 0x0698657a2e761ac9,
+    0x06a18b98618e9ddb, 0x06abc52aedaeb23d, 0x06b7bc304578a6c5,
+    0x06c0c02e48fcf58f, 0x06c9467d22461b09, 0x06d5caa4124b2953,
+    0x06e34db23f109eef, 0x06f1d49ce730cb7d, 0x06ff5f5416393a93,
+    0x0709bf8d69085151, 0x070f27d3bacd0f31, 0x07144dccf94d4105,
+    0x071ee789a0a32a21, 0x072d634246a579f1, 0x0737462bb96e8fa5,
+    0x07405f283b642771, 0x074b06cdd98b2da3, 0x07552bfbdf57e395,
+    0x07609dccaa8ad539, 0x076da8d969c008ab, 0x0775affd2b471325,
+    0x077f705c488c0067, 0x07923231ed9bccbf, 0x07a2f068c5b37579,
+    0x07ad4be7563471c9, 0x07b8d989812915e1, 0x07cd7c923b55ef0d,
+    0x07da107b9d77d701, 0x07e5f69cdc834fc7, 0x07f3b0acd71dbb55,
+    0x07ff8deed331654d, 0x0810b32fa0809eeb, 0x082133690c7663fb,
+    0x082d436d737e0e43, 0x0838514396a42251, 0x083ed920a3c25b47,
+    0x0847124796f30fbb, 0x084df13ebd3538dd, 0x0859e3c5fbd6e1dd,
+    0x086afb9927bb2323, 0x0876e650d72e9c91, 0x0880878df71efee5,
+    0x088dc919e33faadf, 0x089be30a3c1550f7, 0x08a66dd76a1c60a1,
+    0x08b2bf40d71ad8c9, 0x08c4d8ed4609f921, 0x08d70d8938e6b855,
+    0x08e4ddc1ad35d0a9, 0x08f11f02fbfec4a1, 0x0906870cb12b0519,
+    0x09104e69442a8cb9, 0x091e0c440e516489, 0x092d55af4933d6e7,
+    0x0938105d2262175d, 0x0941d56b0465f463, 0x094b227ee9ada823,
+    0x095320ff468b4333, 0x095c258661c7e56b, 0x0966b2cc6595b7c5,
+    0x0973fae5ef6bca33, 0x09815126d1c98139, 0x098eb5a020a4d6b3,
+    0x099db10d83de0847, 0x09aadb69da0214e9, 0x09b973fbfc7d90df,
+    0x09cdd1b23230138b, 0x09d9ca4999f21551, 0x09eadc4431af0b85,
+    0x09fe208a9b5975b9, 0x0a08ae56cd1f05d9, 0x0a14dbe044bc968b,
+    0x0a2003eda8bed3a1, 0x0a31cc37f97e0a49, 0x0a40fc81b5af1213,
+    0x0a4f29108d61fe95, 0x0a5c21788f7d9b31, 0x0a675615f79bd38d,
+    0x0a751eb13c4d642d, 0x0a8b5c2842cb1bd9, 0x0a9d245c82c7e0bf,
+    0x0aa9a8768636bff3, 0x0aba4aab66d9c3d3, 0x0acbbe6d193c87d3,
+    0x0ae046d4cb540dfb, 0x0af5dc5c08f0b8cd, 0x0b064652f3d0ae53,
+    0x0b12c5dd98f8b673, 0x0b262c03f517c40b, 0x0b3d5033fcfcf135,
+    0x0b5181f699c1e587, 0x0b62527e162ded35, 0x0b6b6f6ea453b007,
+    0x0b7844a668b3d19b, 0x0b8813b13de1f9d1, 0x0b97c048948bc509,
+    0x0ba7e24057ee9bcd, 0x0bb8ad133ed044cf, 0x0bcabaafabd0e6fd,
+    0x0bdf76c56a6992b9, 0x0bf5e9a67f6b7c45, 0x0c0401be20d91bcd,
+    0x0c1460092afbf4a7, 0x0c26d6a65f868769, 0x0c3e4c684a0df1bb,
+    0x0c4d0d11f2a55c53, 0x0c58f921cdb0e5b3, 0x0c70173703ff0c97,
+    0x0c832cb78ce310df, 0x0c904afb2b7fc7b1, 0x0c9a5074b1bba0e1,
+    0x0cae6d0d66686141, 0x0cbfe44fcefbcf8b, 0x0cd6162d6dde9fb9,
+    0x0ce8906e9fad99d7, 0x0cf88da85928d19d, 0x0d0cad6993c065dd,
+    0x0d187e5c2c780933, 0x0d24c5b8899d6cd9, 0x0d356a0936a05ea3,
+    0x0d3f2b12d27abdd5, 0x0d4f089584461fef, 0x0d5ebdaf02c952fb,
+    0x0d743407e2ec94a3, 0x0d8ca0385ff641d5, 0x0da931441a3ce247,
+    0x0db88a3d86b5db3d, 0x0dc7efdb7bd853c7, 0x0ddf3d4e9a84bb9f,
+    0x0df1050820194285, 0x0e06f05b64511f6f, 0x0e14527fe1d37b15,
+    0x0e2943860ab731f5, 0x0e44b74a88f68ff5, 0x0e59a380f7e4e393,
+    0x0e7ea49b73860a37, 0x0e90c862d15d605f, 0x0ea428bc8f289135,
+    0x0eaf664f3753362d, 0x0ebee521ab07d961, 0x0ed5852da9f77a99,
+    0x0ee74489707ef657, 0x0efb377ce800db03, 0x0f10ad4fa8a5366f,
+    0x0f21ac769b565831, 0x0f308f2216a7d205, 0x0f3c989bab6a0bf9,
+    0x0f4bcce29eb7e503, 0x0f5b891605357af1, 0x0f739743ecd0f13f,
+    0x0f84aa8b52361023, 0x0f97c23bbed23c73, 0x0fa5822f78eff60f,
+    0x0fb5c262904a100f, 0x0fcf375e051de179, 0x0fe51106bb0bee91,
+    0x10013fb2f7f2db43, 0x100ec50bc1b7bba3, 0x10225b7cc443bb33,
+    0x103f5cad7105cd19, 0x1052dee99018b007, 0x1065efe6e67f8751,
+    0x1074373acf0c7821, 0x1086e23806074fa7, 0x10991974e9276851,
+    0x10ac67d021dd830f, 0x10c78b4b943072d9, 0x10d8ede9af16dcdf,
+    0x10f22f821fdea315, 0x1112e8c602838acf, 0x1124425e3e79a837,
+    0x112fda950440fb83, 0x114760c52cc569a9, 0x1161a77775f54e83,
+    0x11755fae6c914b83, 0x118bd5f74d794c77, 0x11a14ea87a234f77,
+    0x11ace13d6c882d71, 0x11b9d30e4e1c9f41, 0x11c4e72120e26857,
+    0x11e86f502bb23e71, 0x1200f821c5fd16dd, 0x120f302c10203aad,
+    0x1222ee3667d72ccd, 0x1238639e63cf19b1, 0x124f074837d92bdd,
+    0x12664e8f1d129405, 0x1283ccc65f6120f1, 0x12a1ffe05c404f51,
+    0x12c959e280de5b31, 0x12e085b68b5456a5, 0x12f9305eb7cacff3,
+    0x131317e1874667b9, 0x1324cda19cb225dd, 0x13376b8faef70b43,
+    0x1348a6a0a7196637, 0x135d63a9dccb1adb, 0x137c53cf0d9e1fd5,
+    0x1397a0a76be476d1, 0x13a8d1cd9dce5d97, 0x13b9784c19d0ff31,
+    0x13d6c7e94e666f89, 0x13ebabdd7382011f, 0x14072163e5932791,
+    0x14193397ca154fa3, 0x14330ea1c95b4b09, 0x14458ae57c30909d,
+    0x146af5fac8ae48cf, 0x147f19ed8a8cbee5, 0x14986eee12ac7965,
+    0x14b6b60ca3ba7e75, 0x14dfc96fd3edd9fb, 0x14fb4f87ffc35ff3,
+    0x150d1a0df903884b, 0x151f8d5aafdd108f, 0x1534364a9c4858f1,
+    0x155db4c4154deaf5, 0x157a55e18e5e1a15, 0x159301bc493e6323,
+    0x15a8efceece8de67, 0x15c8613d7d751ab3, 0x15df19c5e6ccfc97,
+    0x15fbe9c83b2da9f5, 0x161886b2c45d36b1, 0x16278229a321fc6b,
+    0x164300c36ab9f6cf, 0x166557394eb730a1, 0x16a4aaac86d9fa91,
+    0x16bff5f7ba08e451, 0x16d8bdb7060d38f9, 0x16eff6524286bb57,
+    0x170addbd57b9ff93, 0x172928f769cc1df3, 0x1742468e7793bc2f,
+    0x17542b2f43136357, 0x176d6a71e4ac0223, 0x178b16da0c5424d9,
+    0x17a731aa13f057e9, 0x17cc257da82b6935, 0x17ec329319a5223f,
+    0x1807f6aae9c04173, 0x181f0f9810736237, 0x183c5d0efecf2c1f,
+    0x18667302c65fc8e1, 0x188a8ee0f58580ef, 0x18a04ab71e6406e1,
+    0x18bb484dccf50815, 0x18d17df797560b49, 0x18eae50767ef567f,
+    0x190aab7f180e3455, 0x1923e531a51d6b0d, 0x193b6f1c68019bd7,
+    0x195a18bc6d973449, 0x196b0fb913ac70c9, 0x19870d4201292493,
+    0x19a7688f161f86c5, 0x19c06132887e40e9, 0x19d12f92d19ddb9f,
+    0x19efa89c74bbeae9, 0x1a0c70af91e4f689, 0x1a27814b4fcc9fd3,
+    0x1a4efc2ae5cb5d51, 0x1a7819589ee792e3, 0x1a9496fdd7829cdb,
+    0x1ab6ac4b1769bd09, 0x1ade0c8ba088cb73, 0x1af9613fac05ae5f,
+    0x1b0f3ad4058a7001, 0x1b34016e029e21fb, 0x1b5b8bcb79588a9b,
+    0x1b73e0ca779b1cb5, 0x1b8a041cf99db477, 0x1ba0352398431071,
+    0x1bb0095dfcaa4ac5, 0x1bd026b1d8977bf7, 0x1bee18de4108106d,
+    0x1c136016ebec8059, 0x1c502c5df1e51baf, 0x1c70d4a4e3c05b61,
+    0x1c8ee5d305b9ffdd, 0x1cb7e642a043d7a9, 0x1cddf897099e74c9,
+    0x1cf7b04f784f67b1, 0x1d2123313f7ce825, 0x1d5889c6e2f4da3b,
+    0x1d7c75ca389c574d, 0x1d96973a0deaf819, 0x1db6c101aba39b5f,
+    0x1dd69f59a9086663, 0x1def6384038b9da3, 0x1e0b04b5148559c1,
+    0x1e44ecc2bea40fd9, 0x1e6406756b964ba7, 0x1eabdebcc9aad8e5,
+    0x1ec9a4803083dab3, 0x1ee98cbb85d5356b, 0x1f06449d8c41ae03,
+    0x1f23103362ebd2a3, 0x1f360728362b87f3, 0x1f53c758f09530ff,
+    0x1f7da7650bf245e9, 0x1fa1063756db0073, 0x1fc3abe578297009,
+    0x1fe23d13cc2e1cf7, 0x2005f01254c526a5, 0x203593fffa82c52f,
+    0x205cf064922a5679, 0x207889ce9f2362eb, 0x209809aa725cc34b,
+    0x20b6c5b7f7d68cf7, 0x20d673675c0c21b7, 0x20e80a623ca467ad,
+    0x211ffe853012c315, 0x213eaba3b3289c2f, 0x215a654ae4c9876f,
+    0x217f519a7f42c959, 0x21a8ba33a1ee8cd7, 0x21d24af8567b56ed,
+    0x21f9cdd1e1e12009, 0x22272ff3d1773357, 0x2252fa2dcde67249,
+    0x227b5fa2a071ec63, 0x229f007b40525197, 0x22c4871429382cf3,
+    0x22ec6adb20d27e1d, 0x23011610f0bec4b1, 0x2319655ee88c1555,
+    0x234771fe97ec5045, 0x2375396f02387c5b, 0x239b6d24c0281db7,
+    0x23c73b1c16dc5423, 0x23effd4cd9ff62a1, 0x240f3812a94ecf9d,
+    0x242d9b6f6dd0bbf5, 0x245a673c1e12bc47, 0x24841c78e5ddf73b,
+    0x24cc45e98e1d6b15, 0x2507b4ad4c0eacdb, 0x2531feae9b882527,
+    0x2552fce38bea781b, 0x25731de209fcc34b, 0x259fa9bd13764207,
+    0x25c5b2461ffb0693, 0x2603427d5db949c1, 0x263a65726cea8517,
+    0x2661da7987d450c3, 0x2688f262d993940d, 0x26a2969a3d763b43,
+    0x26c38eff06b1d877, 0x26ee5952670c861f, 0x2718c9ef8c4a6d91,
+    0x274d2c7760f4842b, 0x27700ba8e99e00b1, 0x27a3c7d92da9a68f,
+    0x27c95b1e9cc5080f, 0x27ea90c6b973e651, 0x2805e30933795e93,
+    0x281dc6c7fe1061d7, 0x283fb0c90250fdb3, 0x287f409487395565,
+    0x28aefeeb1070dcaf, 0x28d54e48939c5e0b, 0x290df5307a074d5b,
+    0x29391b84faca9565, 0x295f49590a53a55b, 0x2990500d9c729537,
+    0x29a340abe899502d, 0x29c2886d44169ac7, 0x29eb2464cc37f105,
+    0x2a26788781a885f7, 0x2a52ff25e3d7c8c3, 0x2a866cbd1e34ca6d,
+    0x2ab1aeeb82a0b25b, 0x2acffcd4a168d547, 0x2af9e424a75879d3,
+    0x2b129069c7923465, 0x2b3b9a953d99ea99, 0x2b632b512b1b9c7f,
+    0x2b8a51367febc0bf, 0x2bccac9412f3ea05, 0x2bf308818eecb7f5,
+    0x2c106610f2e737df, 0x2c399aba85dec765, 0x2c69619008c910f7,
+    0x2c93e984b4ebbccd, 0x2cbfa4b630567687, 0x2cde7e8a52b76bc9,
+    0x2d06a316c33fad15, 0x2d1d77d92b0d9ec1, 0x2d393c57f42abfdf,
+    0x2d74bf0dda61aec5, 0x2da61090e6d71d5d, 0x2deb5eb2dea21859,
+    0x2e13a9d36daa766f, 0x2e2b722d65c4cbe1, 0x2e4e5ad1d996eb2f,
+    0x2e7b59ded7d215b9, 0x2ea996ffa4f5a98b, 0x2ecde6049aaba871,
+    0x2f1004c8edc165f5, 0x2f37efbeb8ca38af, 0x2f6083f022cee93b,
+    0x2f93623651a40f73, 0x2fbf99442a98a9fb, 0x300101a7424195c9,
+    0x304063d4183416fb, 0x307a45e2c38d0371, 0x30bc6e66d8af9957,
+    0x30f75249979da803, 0x313f372dbc62e593, 0x316f8073e677f381,
+    0x31ac3395f9757cb9, 0x31f57245fa15bfc7, 0x321e9abc4804959f,
+    0x323e6bc8be97ba97, 0x326a1e30f9ca3c33, 0x32a84f48c3b1a9b1,
+    0x32ecaedc1a557da3, 0x3305206a86fe7279, 0x33523d398fcf1557,
+    0x33a353c928e6db19, 0x33d4c35c0f2246ad, 0x33f42e4baf989285,
+    0x342061cda1c321ab, 0x3447d476ea088969, 0x3479b8bc8ca91175,
+    0x349c7c3bc2bccc47, 0x34d868b3ee6beb53, 0x35017e72a826e039,
+    0x3540383d6d21d365, 0x35548f5f702b3023, 0x35a7fe8d910f7ae5,
+    0x35e570c3fdcf7b2f, 0x3644ca98fbe420e5, 0x3673171f631e5671,
+    0x3698b666fb5c43e9, 0x36c2cf76bdd4fa7f, 0x3706e074fc2367e3,
+    0x37271aa4046e4f9d, 0x375e350cccf22bab, 0x379249ede9f5d59b,
+    0x37ca58a32a133bd3, 0x37fb86f50d9671d9, 0x3833e49f095765fd,
+    0x3869356c05878e8b, 0x38a09b4d61e58fb3, 0x38c94a7acdff110d,
+    0x3913c4a5e305648b, 0x396a44f658ea6dc9, 0x3995fea74f7123a7,
+    0x39d0383f216e0291, 0x3a19bb67271bc921, 0x3a584fd321943afb,
+    0x3a8887a785ff1c61, 0x3aacef3b3f63a7db, 0x3aef4b30be712d3b,
+    0x3b31340ba01cd36d, 0x3b7f6238614f24bf, 0x3bb85e4adb858115,
+    0x3bee254f1d442051, 0x3c3190a24fe5be09, 0x3c6904edbbe52585,
+    0x3ca767ade6e732e5, 0x3ce295e0cb9e57d3, 0x3d2e5472ade057c1,
+    0x3d5138be5b8a89f3, 0x3d967cbd1a219a69, 0x3de91a22cd2a4a71,
+    0x3e28a5839a464aa1, 0x3e7430ed9be40b0f, 0x3ea9055bc28e4c1b,
+    0x3eea8ad31ac5effb, 0x3f1e43c0085937bb, 0x3f5704fd98d83a7d,
+    0x3f9d4c825e02f34d, 0x3fd5af13fabf1775, 0x40132abeb4791047,
+    0x4073a1008f8cfacb, 0x40a405f751e50ab3, 0x40d81700673988a5,
+    0x4114ddf1e4614fa7, 0x4154b0e607d36591, 0x419288329b38fd25,
+    0x41c5b7b73351a2bb, 0x41f3f56dacb55d7b, 0x423751787ca6f6a9,
+    0x426ff76f899b6ef9, 0x42ae98fce8af70bd, 0x42e03c738ae281fd,
+    0x431fe76f82bef75f, 0x438be0e0ece10b55, 0x43f56aa543e484b3,
+    0x443990478ecf09e7, 0x44743f40a7ad7675, 0x44967b84768962c1,
+    0x44f5421613e2fe0b, 0x454c2a69a8cd73a7, 0x4577bda5ccc4596f,
+    0x45b3376739bc2e39, 0x45ef99e1bf3070b1, 0x4629dd6de3fc433b,
+    0x467b0e94dae0dfc1, 0x46b5aaf5f6458cff, 0x46e4f4d635e33dcf,
+    0x4727791a4673c2f5, 0x4764cc5994261ec5, 0x479e6e548afbae8f,
+    0x47e174f8fc0a7071, 0x480d77cf7490f137, 0x485d331b9abcc2b1,
+    0x488edebeeebfb0c1, 0x48d41c16eee6241f, 0x49279c7f9fe4b3b1,
+    0x495cd2c17fb66835, 0x499548a1d2b37465, 0x49efbbd6d5e4e6c3,
+    0x4a4823d466b53307, 0x4a8d05eef29f1cbd, 0x4ad612f3fe563c45,
+    0x4b29b22e3ea0de3f, 0x4b77fdc6f6cb3b5b, 0x4bc0e8b994a8f7dd,
+    0x4c16e9437c87212f, 0x4c535c8eeefa8859, 0x4c9f548a27cad889,
+    0x4cc8a2a52266909f, 0x4d0240da058db975, 0x4d49d65a36ab2b1d,
+    0x4d94e297350efce9, 0x4dd6519ee568fd71, 0x4e364b8496f402a7,
+    0x4e7c41bd8d4fd0b1, 0x4eaa70f74507c651, 0x4ee0f9ca60a3cffd,
+    0x4f1e4112f6925cc9, 0x4f64cd37f573116b, 0x4fd96c139d8671ef,
+    0x501a9cb15df9a3ef, 0x5047d57a5aaecb8f, 0x509868ab95c5f627,
+    0x50d2794cd19f3dd5, 0x511bdb5ba9931db7, 0x51511e48e23f3e31,
+    0x518fcd7b94d8af5d, 0x51e9dad846c63161, 0x5241a1ec6cbdd66f,
+    0x52836ed08b80a8c1, 0x52c1f55ef9b5d037, 0x52fe0acad2c9b4cf,
+    0x5348e4cb70fb570d, 0x538fa1ed137d3181, 0x53d6889a188a7f7d,
+    0x542efe0045fbf099, 0x54780a311c46cf01, 0x54cc9e5fe38d9edb,
+    0x550ff015217315ed, 0x55544b50c9567fe9, 0x558abd57db593e41,
+    0x55dbb7cc14644bcd, 0x56394cfdff13b789, 0x56710dd9c9fb125f,
+    0x56cc72ed04af83f5, 0x570e48df1173dce1, 0x574d961f96c7e9fb,
+    0x5786c365fc34e0cf, 0x57b631ed0c844691, 0x5811aeddaf81b35d,
+    0x5873c6069d7a6b3f, 0x58c500e50b21f7ab, 0x590e4c4de504b359,
+    0x5955f34cc109d03b, 0x599cdc47bf347457, 0x5a0123e220f50347,
+    0x5a6796bd80c15923, 0x5aa8b51e9444ddf1, 0x5aebcecef2d064e3,
+    0x5b53f3dd52f1f909, 0x5bcb456a19f18b9f, 0x5c2f86cb926b4b43,
+    0x5c92399429da2ccf, 0x5cdecc4c3b32acf3, 0x5d2e5c7c9c2f3091,
+    0x5d8785a1dbe8c8b3, 0x5dcd261587de99d7, 0x5e37c2eb695e3379,
+    0x5e9299a6406d57cd, 0x5ef45ff6378724cf, 0x5f4a09ef0a00d28b,
+    0x5f880c3fd31e2151, 0x5fd29d590257d70d, 0x603c0f59ba9b23b9,
+    0x607d6c7742ddd781, 0x60e862a030ae207f, 0x6115c8a81343874d,
+    0x61490c071341f983, 0x61870f4569a9ba8f, 0x61ca0b79e8fe2801,
+    0x6223915f86ca78d9, 0x6267d88eae836dbd, 0x62b7062d1c9deb77,
+    0x63017c960d6cf9a7, 0x6357e851c9c42d1b, 0x63c3430b98d954d9,
+    0x64104b0c959fbd5d, 0x64578d673d42fe05, 0x64a1f0103a74e53b,
+    0x64f274da9c260661, 0x654c25378f8bd421, 0x65ae10e725f95b1d,
+    0x660138af15ac7647, 0x6671bd39f72309c3, 0x66ca67df0447b737,
+    0x6707fef0a97b30ed, 0x676e37a47a938093, 0x67ba4fef362eb5cd,
+    0x68251dabf86e9c8b, 0x687ace0988c62c67, 0x691763a91855ade5,
+    0x698b7ced5ef10067, 0x69d397c5dcf51e4b, 0x6a08379754914231,
+    0x6a72ba8eb2abcdeb, 0x6ae5dd60539878b9, 0x6b2ea9a9b0ac8bf5,
+    0x6b768ef9b3e2e2ab, 0x6be65501aa507c45, 0x6c577e8a612eba45,
+    0x6ca10782a6f8e971, 0x6d03ffd241691df5, 0x6d43509609639be5,
+    0x6da3899cbb6f3f93, 0x6e172185387adfb5, 0x6e52a82e903984d9,
+    0x6ea064064827146b, 0x6ef17e270d7b7143, 0x6f4b544bb946f3a3,
+    0x6fb243f4206eed27, 0x70072e607c9cbd0d, 0x707518eaa59be129,
+    0x70d8837726cd41c9, 0x7129bf0a37268eb3, 0x71ba37bd12540ebd,
+    0x723f37bea6524c05, 0x729135e25d65985f, 0x72c39509abf2f56b,
+    0x7309c493ddb3966b, 0x7376979af3271a05, 0x73eb705a88e31909,
+    0x74472dcc8f99392f, 0x74b18d678388b52b, 0x75094d9052aff6bd,
+    0x75468192a019bfeb, 0x75a54695eb9a3171, 0x760afe300f9f6e37,
+    0x7680ab162ba9aaf5, 0x76fb31e467eefb4b, 0x775d42a0f5f4de41,
+    0x77dab48dc6eaaabf, 0x787bc6ba9d8a758b, 0x78d5a753008c38e9,
+    0x7932023e03bef407, 0x7984465ec01cd293, 0x79bd80b45825b0af,
+    0x7a1b84bd26056feb, 0x7a789c0b8d8965b9, 0x7ac49bde9b8da1b5,
+    0x7b10bf4579adb6d1, 0x7b63f6162304e4c9, 0x7bbad24b38b035f7,
+    0x7c2ee95f44f35d1b, 0x7c9ea8ba0b9ed957, 0x7d0305a1d171bdab,
+    0x7d91cad9f46ad8a3, 0x7e072cd67f571b0b, 0x7e74a1ab5eb1e6f9,
+    0x7ed7bc4811e9c1d9, 0x7f4a73d7b3b105c7, 0x7f9d6f6ed7a7c0c3,
+    0x800bebf7df94a029, 0x80928a01f0a05d9b, 0x80fa7a4743a867d1,
+    0x8144b0ef97f759d5, 0x81f18abca18a7205, 0x822eedcc31a19a2b,
+    0x82a3e76d26355215, 0x833642737db9a033, 0x83bcf03746ff871d,
+    0x8447ad1414f9a6a1, 0x84bf4b8a413edc55, 0x8503c8cec059a9f5,
+    0x854d48eb72124ff5, 0x859e44daf6f275d9, 0x8611d9311fa2fe6d,
+    0x8692177789fa055d, 0x86c10903354849d1, 0x87064c558c287131,
+    0x877c0b7898bbfefb, 0x87c7cea3fbdc77e9, 0x883cca9153ba8b65,
+    0x88b493ca7f1efba5, 0x893f76de76371ac7, 0x898bf7c443d48465,
+    0x89fe51e31cc5f833, 0x8a6be95cb1baab41, 0x8ae7a9ae0fef192d,
+    0x8b4ba69c31953393, 0x8c050192feca5373, 0x8c6854338cc585c7,
+    0x8cd4cc96925b5bbd, 0x8d293117b8549011, 0x8d6d1135d6298d2f,
+    0x8db252ab91fa2127, 0x8e2c64689ba0d03d, 0x8e9b2d59d2ed13a1,
+    0x8f1d9a7aa7ab0b23, 0x8f76e7937538628d, 0x8fe523001f1ff397,
+    0x904d1d01651edf2f, 0x90a0748c08adc9e3, 0x911f075e7187f689,
+    0x917e827c592cfb37, 0x91c2a19e82a04307, 0x921e7aa8656c8447,
+    0x928a48f64072b50f, 0x930f66cfc4230665, 0x937279fd18aa1aa7,
+    0x93ddb2716d9fc9b9, 0x94353a9b189270e9, 0x9494e464bc92d201,
+    0x950364f403230bcf, 0x955e1bf14215399f, 0x95e2758bf9af1dbd,
+    0x9650596c3ef9fc11, 0x96b7bfdbd637ab0f, 0x9772efdcbc98d449,
+    0x9802234378c7ba75, 0x988588f23af6a0a7, 0x99199350ec635a5d,
+    0x998680cce8e917a9, 0x99ecd3ff99cc959b, 0x9a369f9245b31a93,
+    0x9ab5f5a796908b15, 0x9afbea930aac8387, 0x9b6c98fe6b0e8e9f,
+    0x9bf6551f3f234adb, 0x9c7820b7d6f60733, 0x9d11ce92774d1d51,
+    0x9d892f652798a3fd, 0x9ddc9f36cea05d2d, 0x9e652f36ad81f6f9,
+    0x9ecc895061df019d, 0x9f314822df609685, 0x9f775a50c4febdf1,
+    0x9ff011c0908c66cd, 0xa0b0f7361a03c523, 0xa12a66c463a1b703,
+    0xa17ddcf0b55c41a9, 0xa1dccb7e4b4b111f, 0xa251319823b4a8ef,
+    0xa3143bc528a0cb65, 0xa3866fda087b8605, 0xa419d0a7b27826bf,
+    0xa4a669b033766e6f, 0xa5151f341a8dc4d1, 0xa58cb40c3715b5df,
+    0xa679af9cb26d54f3, 0xa71c2d29476e939b, 0xa77d91940da43f0d,
+    0xa7f95fbefd337987, 0xa8583ae3b8737249, 0xa8b8b35817d9c02d,
+    0xa914f116badd38f7, 0xa97b9aa0ab889dcf, 0xa9ecbd9f96129d09,
+    0xaa71429edb33198d, 0xaac6d2b3d16db9e9, 0xab342ae3c6566e8d,
+    0xac22c8ca70e972db, 0xac74854c87e5be5d, 0xacd0cc20971c8a41,
+    0xad34ad377955b027, 0xad89c8aa3d527521, 0xae1ae3e166c7af8f,
+    0xaeb6df0427da9037, 0xaf54c3a891ca606d, 0xafb3b24486e43143,
+    0xb015cdb190e89e05, 0xb09656f74dd6ab47, 0xb106771c36cb89eb,
+    0xb18f1ce90576bd83, 0xb282cdd863964edf, 0xb3480082f6aeaa89,
+    0xb3e2d6aa2463a8a7, 0xb46885a8e8386845, 0xb4f322041c45961d,
+    0xb544e5bf154ff07f, 0xb5b5b2fe12d0ce51, 0xb65218a1f623c40f,
+    0xb6fce5b2b9603fdf, 0xb79253d4d8e31f5b, 0xb81ba0b04f87ba93,
+    0xb8c2f8b65e5dbf2d, 0xb9710a9ad06493d7, 0xba17ba2fd1c3257b,
+    0xbaf61b66c0407bd9, 0xbb699207f1cb6ee3, 0xbbc0b025e6af5df9,
+    0xbc2fbb7726d4257d, 0xbcc1fabf68e45135, 0xbd2fe13a013c8b3b,
+    0xbda78af944967ea5, 0xbe978c824a75b3d9, 0xbefc9e21771514ab,
+    0xbf46829d579f0bbb, 0xbfe76cc3e326dd0f, 0xc0a0fe537c994015,
+    0xc14fb8aad09c4621, 0xc1f6d0a00dc7a8c3, 0xc2ca492e3042ee23,
+    0xc3998cb10c422621, 0xc44706fd4ddf92c5, 0xc4bb7ad0595824fb,
+    0xc545831ae5bb5fff, 0xc6063edc4e1190c5, 0xc66e411d7eefa17b,
+    0xc6ea46e645433fd5, 0xc75aed45e12d50a1, 0xc7fd99e350f77885,
+    0xc859116638335e6b, 0xc8b9a7c5aa10ce33, 0xc9386c16154d1677,
+    0xc9d589729b77aed7, 0xcacbf81f9b73dd11, 0xcb7ad6e034d70d21,
+    0xcc4d9d03cbc8f9e7, 0xccc74f6fc65771c3, 0xcd22b7f3e5131827,
+    0xcdb63df383962815, 0xce4a1118682d08f3, 0xced91aff4f786c7f,
+    0xcf5e2b6817db886f, 0xcfdaf2e8df36a981, 0xd0bb628a97f257ab,
+    0xd1468a9abd1d8d0d, 0xd202321deb3dee0b, 0xd2f76ae84d105717,
+    0xd3856a9ff003568f, 0xd407860538bc21d1, 0xd4b8da2580f27f95,
+    0xd5443d93d06c15fd, 0xd5be6c2a35530041, 0xd6761329d76cee23,
+    0xd72026e3ce461d25, 0xd7cc602f2dcbc109, 0xd891b3ece870a4d1,
+    0xd935f445ac55a567, 0xd9cc659b391ea1fd, 0xda588011b29f8c7b,
+    0xdafdbed6d230b645, 0xdbb7008775e13a15, 0xdc440590aa03412b,
+    0xdd23b00ebc523b0d, 0xde05d1ce30af7da9, 0xded30350da8bc22d,
+    0xdf467290f0898a75, 0xdfb83fd8756345bf, 0xe02c07e3fe53f7bf,
+    0xe0a73d268c58db33, 0xe13fb6a95c9a2ec3, 0xe1c81a74ec69d481,
+    0xe262f8ee9c57065f, 0xe2fa81d51baef7f1, 0xe34af45a09606249,
+    0xe3db9afcad371c6f, 0xe44f26f46ef79fd5, 0xe4b42ae7394e8453,
+    0xe543a57ce981177b, 0xe5d8ee20969d7d31, 0xe65677e5c92537f1,
+    0xe6ec442aaff6d26f, 0xe7bbdffe85085767, 0xe8cf0d35b99d3487,
+    0xe962531690dfdd21, 0xea196650483bcb0d, 0xeaf6655520134651,
+    0xeb9f5bd744c1a43d, 0xec59a14b9c0c038b, 0xed1a01545650c087,
+    0xedc9ca46d8b62b29, 0xeec3f66465c24459, 0xef8b83856e4b8a0b,
+    0xf064b5af015d07e3, 0xf15d1e90b3b6e3eb, 0xf1d99948e76444b9,
+    0xf25fdb5a44917fb1, 0xf2fd6a78914d0445, 0xf3f7cf3bee41b011,
+    0xf4b515b34b3a1a6d, 0xf5a33d97461886e7, 0xf62b137f47839d2f,
+    0xf6b8f8f5709466a9, 0xf7a6a41dc49b879d, 0xf844d071935d4b4b,
+    0xf8f4e6c360f61dc3, 0xf976453e077009bf, 0xf9f5dd43594d71e1,
+    0xfa6dc9d49468538b, 0xfb38a4e94b0c6ba9, 0xfc020700f1ab8ed5,
+    0xfcc3f1e46fb9c8b9, 0xfd8059698237104b, 0xfe1f539d8692f3c7,
+    0xfeb49f686ca6b6b5, 0x0000ffb905ded927,
+};
+
+const uint16_t PRIMORIAL_END[NUM_PRIMORIALS] = {
+       15,    25,    34,    42,    50,    57,    64,    71,    78,    85,    92,    99,
+      105,   111,   117,   123,   129,   135,   141,   147,   153,   159,   165,   171,
+      177,   183,   189,   195,   201,   207,   213,   219,   225,   231,   237,   243,
+      249,   255,   260,   265,   270,   275,   280,   285,   290,   295,   300,   305,
+      310,   315,   320,   325,   330,   335,   340,   345,   350,   355,   360,   365,
+      370,   375,   380,   385,   390,   395,   400,   405,   410,   415,   420,   425,
+      430,   435,   440,   445,   450,   455,   460,   465,   470,   475,   480,   485,
+      490,   495,   500,   505,   510,   515,   520,   525,   530,   535,   540,   545,
+      550,   555,   560,   565,   570,   575,   580,   585,   590,   595,   600,   605,
+      610,   615,   620,   625,   630,   635,   640,   645,   650,   655,   660,   665,
+      670,   675,   680,   685,   690,   695,   700,   705,   710,   715,   720,   725,
+      730,   735,   740,   745,   750,   755,   760,   765,   770,   775,   780,   785,
+      790,   795,   800,   805,   810,   815,   820,   825,   830,   835,   840,   845,
+      850,   855,   860,   865,   870,   875,   880,   885,   890,   895,   900,   905,
+      910,   914,   918,   922,   926,   930,   934,   938,   942,   946,   950,   954,
+      958,   962,   966,   970,   974,   978,   982,   986,   990,   994,   998,  1002,
+     1006,  1010,  1014,  1018,  1022,  1026,  1030,  1034,  1038,  1042,  1046,  1050,
+     1054,  1058,  1062,  1066,  1070,  1074,  1078,  1082,  1086,  1090,  1094,  1098,
+     1102,  1106,  1110,  1114,  1118,  1122,  1126,  1130,  1134,  1138,  1142,  1146,
+     1150,  1154,  1158,  1162,  1166,  1170,  1174,  1178,  1182,  1186,  1190,  1194,
+     1198,  1202,  1206,  1210,  1214,  1218,  1222,  1226,  1230,  1234,  1238,  1242,
+     1246,  1250,  1254,  1258,  1262,  1266,  1270,  1274,  1278,  1282,  1286,  1290,
+     1294,  1298,  1302,  1306,  1310,  1314,  1318,  1322,  1326,  1330,  1334,  1338,
+     1342,  1346,  1350,  1354,  1358,  1362,  1366,  1370,  1374,  1378,  1382,  1386,
+     1390,  1394,  1398,  1402,  1406,  1410,  1414,  1418,  1422,  1426,  1430,  1434,
+     1438,  1442,  1446,  1450,  1454,  1458,  1462,  1466,  1470,  1474,  1478,  1482,
+     1486,  1490,  1494,  1498,  1502,  1506,  1510,  1514,  1518,  1522,  1526,  1530,
+     1534,  1538,  1542,  1546,  1550,  1554,  1558,  1562,  1566,  1570,  1574,  1578,
+     1582,  1586,  1590,  1594,  1598,  1602,  1606,  1610,  1614,  1618,  1622,  1626,
+     1630,  1634,  1638,  1642,  1646,  1650,  1654,  1658,  1662,  1666,  1670,  1674,
+     1678,  1682,  1686,  1690,  1694,  1698,  1702,  1706,  1710,  1714,  1718,  1722,
+     1726,  1730,  1734,  1738,  1742,  1746,  1750,  1754,  1758,  1762,  1766,  1770,
+     1774,  1778,  1782,  1786,  1790,  1794,  1798,  1802,  1806,  1810,  1814,  1818,
+     1822,  1826,  1830,  1834,  1838,  1842,  1846,  1850,  1854,  1858,  1862,  1866,
+     1870,  1874,  1878,  1882,  1886,  1890,  1894,  1898,  1902,  1906,  1910,  1914,
+     1918,  1922,  1926,  1930,  1934,  1938,  1942,  1946,  1950,  1954,  1958,  1962,
+     1966,  1970,  1974,  1978,  1982,  1986,  1990,  1994,  1998,  2002,  2006,  2010,
+     2014,  2018,  2022,  2026,  2030,  2034,  2038,  2042,  2046,  2050,  2054,  2058,
+     2062,  2066,  2070,  2074,  2078,  2082,  2086,  2090,  2094,  2098,  2102,  2106,
+     2110,  2114,  2118,  2122,  2126,  2130,  2134,  2138,  2142,  2146,  2150,  2154,
+     2158,  2162,  2166,  2170,  2174,  2178,  2182,  2186,  2190,  2194,  2198,  2202,
+     2206,  2210,  2214,  2218,  2222,  2226,  2230,  2234,  2238,  2242,  2246,  2250,
+     2254,  2258,  2262,  2266,  2270,  2274,  2278,  2282,  2286,  2290,  2294,  2298,
+     2302,  2306,  2310,  2314,  2318,  2322,  2326,  2330,  2334,  2338,  2342,  2346,
+     2350,  2354,  2358,  2362,  2366,  2370,  2374,  2378,  2382,  2386,  2390,  2394,
+     2398,  2402,  2406,  2410,  2414,  2418,  2422,  2426,  2430,  2434,  2438,  2442,
+     2446,  2450,  2454,  2458,  2462,  2466,  2470,  2474,  2478,  2482,  2486,  2490,
+     2494,  2498,  2502,  2506,  2510,  2514,  2518,  2522,  2526,  2530,  2534,  2538,
+     2542,  2546,  2550,  2554,  2558,  2562,  2566,  2570,  2574,  2578,  2582,  2586,
+     2590,  2594,  2598,  2602,  2606,  2610,  2614,  2618,  2622,  2626,  2630,  2634,
+     2638,  2642,  2646,  2650,  2654,  2658,  2662,  2666,  2670,  2674,  2678,  2682,
+     2686,  2690,  2694,  2698,  2702,  2706,  2710,  2714,  2718,  2722,  2726,  2730,
+     2734,  2738,  2742,  2746,  2750,  2754,  2758,  2762,  2766,  2770,  2774,  2778,
+     2782,  2786,  2790,  2794,  2798,  2802,  2806,  2810,  2814,  2818,  2822,  2826,
+     2830,  2834,  2838,  2842,  2846,  2850,  2854,  2858,  2862,  2866,  2870,  2874,
+     2878,  2882,  2886,  2890,  2894,  2898,  2902,  2906,  2910,  2914,  2918,  2922,
+     2926,  2930,  2934,  2938,  2942,  2946,  2950,  2954,  2958,  2962,  2966,  2970,
+     2974,  2978,  2982,  2986,  2990,  2994,  2998,  3002,  3006,  3010,  3014,  3018,
+     3022,  3026,  3030,  3034,  3038,  3042,  3046,  3050,  3054,  3058,  3062,  3066,
+     3070,  3074,  3078,  3082,  3086,  3090,  3094,  3098,  3102,  3106,  3110,  3114,
+     3118,  3122,  3126,  3130,  3134,  3138,  3142,  3146,  3150,  3154,  3158,  3162,
+     3166,  3170,  3174,  3178,  3182,  3186,  3190,  3194,  3198,  3202,  3206,  3210,
+     3214,  3218,  3222,  3226,  3230,  3234,  3238,  3242,  3246,  3250,  3254,  3258,
+     3262,  3266,  3270,  3274,  3278,  3282,  3286,  3290,  3294,  3298,  3302,  3306,
+     3310,  3314,  3318,  3322,  3326,  3330,  3334,  3338,  3342,  3346,  3350,  3354,
+     3358,  3362,  3366,  3370,  3374,  3378,  3382,  3386,  3390,  3394,  3398,  3402,
+     3406,  3410,  3414,  3418,  3422,  3426,  3430,  3434,  3438,  3442,  3446,  3450,
+     3454,  3458,  3462,  3466,  3470,  3474,  3478,  3482,  3486,  3490,  3494,  3498,
+     3502,  3506,  3510,  3514,  3518,  3522,  3526,  3530,  3534,  3538,  3542,  3546,
+     3550,  3554,  3558,  3562,  3566,  3570,  3574,  3578,  3582,  3586,  3590,  3594,
+     3598,  3602,  3606,  3610,  3614,  3618,  3622,  3626,  3630,  3634,  3638,  3642,
+     3646,  3650,  3654,  3658,  3662,  3666,  3670,  3674,  3678,  3682,  3686,  3690,
+     3694,  3698,  3702,  3706,  3710,  3714,  3718,  3722,  3726,  3730,  3734,  3738,
+     3742,  3746,  3750,  3754,  3758,  3762,  3766,  3770,  3774,  3778,  3782,  3786,
+     3790,  3794,  3798,  3802,  3806,  3810,  3814,  3818,  3822,  3826,  3830,  3834,
+     3838,  3842,  3846,  3850,  3854,  3858,  3862,  3866,  3870,  3874,  3878,  3882,
+     3886,  3890,  3894,  3898,  3902,  3906,  3910,  3914,  3918,  3922,  3926,  3930,
+     3934,  3938,  3942,  3946,  3950,  3954,  3958,  3962,  3966,  3970,  3974,  3978,
+     3982,  3986,  3990,  3994,  3998,  4002,  4006,  4010,  4014,  4018,  4022,  4026,
+     4030,  4034,  4038,  4042,  4046,  4050,  4054,  4058,  4062,  4066,  4070,  4074,
+     4078,  4082,  4086,  4090,  4094,  4098,  4102,  4106,  4110,  4114,  4118,  4122,
+     4126,  4130,  4134,  4138,  4142,  4146,  4150,  4154,  4158,  4162,  4166,  4170,
+     4174,  4178,  4182,  4186,  4190,  4194,  4198,  4202,  4206,  4210,  4214,  4218,
+     4222,  4226,  4230,  4234,  4238,  4242,  4246,  4250,  4254,  4258,  4262,  4266,
+     4270,  4274,  4278,  4282,  4286,  4290,  4294,  4298,  4302,  4306,  4310,  4314,
+     4318,  4322,  4326,  4330,  4334,  4338,  4342,  4346,  4350,  4354,  4358,  4362,
+     4366,  4370,  4374,  4378,  4382,  4386,  4390,  4394,  4398,  4402,  4406,  4410,
+     4414,  4418,  4422,  4426,  4430,  4434,  4438,  4442,  4446,  4450,  4454,  4458,
+     4462,  4466,  4470,  4474,  4478,  4482,  4486,  4490,  4494,  4498,  4502,  4506,
+     4510,  4514,  4518,  4522,  4526,  4530,  4534,  4538,  4542,  4546,  4550,  4554,
+     4558,  4562,  4566,  4570,  4574,  4578,  4582,  4586,  4590,  4594,  4598,  4602,
+     4606,  4610,  4614,  4618,  4622,  4626,  4630,  4634,  4638,  4642,  4646,  4650,
+     4654,  4658,  4662,  4666,  4670,  4674,  4678,  4682,  4686,  4690,  4694,  4698,
+     4702,  4706,  4710,  4714,  4718,  4722,  4726,  4730,  4734,  4738,  4742,  4746,
+     4750,  4754,  4758,  4762,  4766,  4770,  4774,  4778,  4782,  4786,  4790,  4794,
+     4798,  4802,  4806,  4810,  4814,  4818,  4822,  4826,  4830,  4834,  4838,  4842,
+     4846,  4850,  4854,  4858,  4862,  4866,  4870,  4874,  4878,  4882,  4886,  4890,
+     4894,  4898,  4902,  4906,  4910,  4914,  4918,  4922,  4926,  4930,  4934,  4938,
+     4942,  4946,  4950,  4954,  4958,  4962,  4966,  4970,  4974,  4978,  4982,  4986,
+     4990,  4994,  4998,  5002,  5006,  5010,  5014,  5018,  5022,  5026,  5030,  5034,
+     5038,  5042,  5046,  5050,  5054,  5058,  5062,  5066,  5070,  5074,  5078,  5082,
+     5086,  5090,  5094,  5098,  5102,  5106,  5110,  5114,  5118,  5122,  5126,  5130,
+     5134,  5138,  5142,  5146,  5150,  5154,  5158,  5162,  5166,  5170,  5174,  5178,
+     5182,  5186,  5190,  5194,  5198,  5202,  5206,  5210,  5214,  5218,  5222,  5226,
+     5230,  5234,  5238,  5242,  5246,  5250,  5254,  5258,  5262,  5266,  5270,  5274,
+     5278,  5282,  5286,  5290,  5294,  5298,  5302,  5306,  5310,  5314,  5318,  5322,
+     5326,  5330,  5334,  5338,  5342,  5346,  5350,  5354,  5358,  5362,  5366,  5370,
+     5374,  5378,  5382,  5386,  5390,  5394,  5398,  5402,  5406,  5410,  5414,  5418,
+     5422,  5426,  5430,  5434,  5438,  5442,  5446,  5450,  5454,  5458,  5462,  5466,
+     5470,  5474,  5478,  5482,  5486,  5490,  5494,  5498,  5502,  5506,  5510,  5514,
+     5518,  5522,  5526,  5530,  5534,  5538,  5542,  5546,  5550,  5554,  5558,  5562,
+     5566,  5570,  5574,  5578,  5582,  5586,  5590,  5594,  5598,  5602,  5606,  5610,
+     5614,  5618,  5622,  5626,  5630,  5634,  5638,  5642,  5646,  5650,  5654,  5658,
+     5662,  5666,  5670,  5674,  5678,  5682,  5686,  5690,  5694,  5698,  5702,  5706,
+     5710,  5714,  5718,  5722,  5726,  5730,  5734,  5738,  5742,  5746,  5750,  5754,
+     5758,  5762,  5766,  5770,  5774,  5778,  5782,  5786,  5790,  5794,  5798,  5802,
+     5806,  5810,  5814,  5818,  5822,  5826,  5830,  5834,  5838,  5842,  5846,  5850,
+     5854,  5858,  5862,  5866,  5870,  5874,  5878,  5882,  5886,  5890,  5894,  5898,
+     5902,  5906,  5910,  5914,  5918,  5922,  5926,  5930,  5934,  5938,  5942,  5946,
+     5950,  5954,  5958,  5962,  5966,  5970,  5974,  5978,  5982,  5986,  5990,  5994,
+     5998,  6002,  6006,  6010,  6014,  6018,  6022,  6026,  6030,  6034,  6038,  6042,
+     6046,  6050,  6054,  6058,  6062,  6066,  6070,  6074,  6078,  6082,  6086,  6090,
+     6094,  6098,  6102,  6106,  6110,  6114,  6118,  6122,  6126,  6130,  6134,  6138,
+     6142,  6146,  6150,  6154,  6158,  6162,  6166,  6170,  6174,  6178,  6182,  6186,
+     6190,  6194,  6198,  6202,  6206,  6210,  6214,  6218,  6222,  6226,  6230,  6234,
+     6238,  6242,  6246,  6250,  6254,  6258,  6262,  6266,  6270,  6274,  6278,  6282,
+     6286,  6290,  6294,  6298,  6302,  6306,  6310,  6314,  6318,  6322,  6326,  6330,
+     6334,  6338,  6342,  6346,  6350,  6354,  6358,  6362,  6366,  6370,  6374,  6378,
+     6382,  6386,  6390,  6394,  6398,  6402,  6406,  6410,  6414,  6418,  6422,  6426,
+     6430,  6434,  6438,  6442,  6446,  6450,  6454,  6458,  6462,  6466,  6470,  6474,
+     6478,  6482,  6486,  6490,  6494,  6498,  6502,  6506,  6510,  6514,  6518,  6522,
+     6526,  6530,  6534,  6538,  6541,
+};
+
+const big_uint PRIMORIAL_BLOCK_DATA[] = {
+    0x1b4d975572f835a7, 0x627abb3f1fc32cbe, 0x780b2adc9e8bfc45,
+    0x4479f88e9f136f1f, 0x92095a9681b821df, 0xba895321b7f7dc8d,
+    0x426483269918011c, 0x000000054f08d058, 0xd0fd7fa7c66d9d2b,
+    0x286829357007c8bb, 0xa6f6013f5e5627f4, 0x2801ac53668c218d,
+    0xb487b4931eeaa9d7, 0x9e19041164479678, 0x074b9648da38bffb,
+    0x00000000001974a4, 0x115d1bffab94b93d, 0x641fc7297e265b82,
+    0x0b461e90c4405128, 0x3cd9462bab7acc16, 0xeefd00c5c32cbe7e,
+    0x69ebf30214836a05, 0x8958e953b407eb46, 0x00000000000ae1c3,
+    0xad8abbc0650900df, 0x7fa2f01a95418e51, 0x662a8f6a34f47153,
+    0x64c8f52c0836e18e, 0xa18120d5893b34f8, 0x52743478f44c506a,
+    0x69e52fc367d1e4e5, 0x0000052ce9bea234, 0xa143d00fecc4ecd1,
+    0x82151c4909715c0c, 0xf609829ae6339c3a, 0x279a9d8c9ba83dd8,
+    0x61a9a5bbdfa3e51f, 0x36576f5091cf649c, 0x9cdee3ddcf78c188,
+    0x000000821c899427, 0x2e50e4ac66d11ea1, 0x72434fb7bf3456c2,
+    0xc553f96c3a422927, 0x704cf5ae52f77203, 0x4b3d0079a45f7f04,
+    0x0dab9f01aefe6c05, 0x00060e99b20d71c9, 0xc898dc767c4bccab,
+    0xaa747b4e96ead299, 0xa78ffa5e3151d73d, 0x5942585b06f83981,
+    0xa1d0d6120f7fbd95, 0x227fd9edeb34522f, 0x0bacde839590d936,
+    0x57c429a32e369af1, 0xe4386d7ec60cce70, 0xbc5832a084883b1c,
+    0x001f368094a048af, 0xba5bf266cd78b3d2, 0x02348fcca26c3895,
+    0xc7edfdc0b0bf44db, 0x0000000000000009, 0x5160f3550c18fe4f,
+    0xbe6a63facb58d12a, 0x97be3a57e45ef54c, 0x25fd320d1d490296,
+    0x0303e51fbd144171, 0x444bac79114e55d6, 0x1c212b9634e3a18f,
+    0x00000000000003fb, 0xa9c0a1a25c100f65, 0x91f350af62dc6d4b,
+    0x1e34840469b975b4, 0xe6da70bcddb71d1c, 0xeced5111e90a5127,
+    0x228f29e17550fd56, 0x50b36ca0c7b75d63, 0x0000000000018b8e,
+    0x5fecdbc8206aa6cb, 0x6332f1ed629fb4b7, 0x48adbd239455763d,
+    0x1eee4a112c6f09fa, 0x645c5f41a85c3ad3, 0x303963f32e168a30,
+    0x5483d605c61e72c2, 0x000000000054367b, 0x06e36601fe3f073f,
+    0x50df778d1f026529, 0x787c1e6251300522, 0x7c303313c126f7e0,
+    0x7dabe4aed0a7d4f3, 0xf97ce9497cad555a, 0x947d2ee6c320e2ee,
+    0x000000000aa9dd30, 0x441c11be21819213, 0x107e586e39d327a6,
+    0x3dfc770cefcc328b, 0x8916763a01c3a917, 0xcc6b0c136545e8cb,
+    0x715f9bb85513af47, 0x5437eb609a279047, 0x00000001345e8582,
+    0xf8a6db1084bed9e7, 0x5e9e5fa05006a1ae, 0xb6e7a4ac1d1267d2,
+    0xbe436310c4243ac6, 0x084a02623241385a, 0x772639a8cc5537f3,
+    0x50f9f2aaa8e4856a, 0x0000001deb1d5448, 0x6c2551ab7f4043fd,
+    0xc77762d2aa08ea65, 0x6bc19eae4c176859, 0x0aa8b9bf8a106d86,
+    0xf6bfa3e902af12ad, 0x756cd33f96241188, 0x4800c83abe046780,
+    0x0000026829c496a0, 0xc8cd28731147fc63, 0x2e47d535262298c7,
+    0xe881202689153a39, 0x68b9f316ec062444, 0x2afa327b2cb63649,
+    0xe00837961f2b5ebd, 0x2800b676a65b97f3, 0x000024a6eac79de6,
+    0x05c3a09507900b4b, 0x9c7f392f577a9dd8, 0x49c29f0edd60265d,
+    0xa433842d6e163f2d, 0xd18f888de6c2922a, 0x45dbe2551eb36114,
+    0xf27206d35ad60b55, 0x000216c11c653740, 0xcc538e9ceca07891,
+    0x0efda676e41593a2, 0x42df82645b705708, 0xaa1976e18d8820cd,
+    0x9e3b9882db2ebd41, 0x88fd3a0c382f5c16, 0x7b2d6034d65ac3f7,
+    0x00155368e62e4bfd, 0x5f5eca54d686793d, 0xb5b390c63f26201e,
+    0x763e9a9a3057492c, 0x4578aa5950cc2bd8, 0xbb26f9c144c12ac1,
+    0x323997e148004b5c, 0xf9240e280c762bc9, 0x00e6986fa2d2035f,
+    0xbc15569c06a6dc3b, 0x8615b7d9ef651a5a, 0x55fe018c3168b463,
+    0x88271978a3564662, 0x8df48a5e8e9b08b2, 0xc1329be07b41b825,
+    0x53437964e32efdee, 0x07d3521b8b15ff66, 0x4aa7491ce1724237,
+    0xc43dbacb606a3ab4, 0xef00acc3b0455b67, 0xc676c24c0f66cc3e,
+    0x2f296bf7772f1d8a, 0x14556d6b2c6656f1, 0xad00ac65255aeea9,
+    0x409694d29db222d7, 0x4ff152d4dadb121f, 0x2886fbd3a8843798,
+    0x585b1ac7012585f1, 0xae628c706e7e7ba9, 0x8114b7d0878756af,
+    0x7d0c8d0fc56a7847, 0x000000804f95b8cb, 0xdde1160b08c9a557,
+    0xaf62620916fe7984, 0x1819e258c87cda88, 0x38fbd62075a2e8c5,
+    0xbe4bba2f8d7cb2d7, 0xc7aab89770f11729, 0x0000000011953c37,
+    0x7e2e1b28beb2a0e9, 0x331a7e88abaea48f, 0x0b47095efe8c58a9,
+    0x9297813bf4688528, 0x7f454ffd8f09af8a, 0x94029647d8ae9d6d,
+    0x00000000356489ba, 0x3da32d636f3b1e1d, 0xc5a17ce41ee8a533,
+    0xa7ce2b4c2686cd98, 0x1a7752fc4d871ec6, 0xf71d71b64d0bb66a,
+    0x43d61e74d950fade, 0x00000000b9466ab7, 0xa96c414c7df6f695,
+    0x7f71f5a32bdd400e, 0x93a1440f6df2051c, 0x54ff6fe7782a7418,
+    0x6d704a1cdf4b452f, 0x5428a98b94400c62, 0x0000000242fd1467,
+    0x7ec1c84b875e5893, 0xae8395679d52a30c, 0x4fcabbc33e256313,
+    0x2bfb0f0a95622d80, 0x1e466904f527f940, 0x118ea376df086e24,
+    0x00000006c91230e6, 0x54656a10f13d94ad, 0xc11fdaa67d5909d2,
+    0x6bf9fd40264f71e2, 0x70cd72c05edb4e42, 0xba409fa5db30aeba,
+    0x7c1e3dc62a58756b, 0x000000123d2ca1d6, 0xa08077dde367531d,
+    0x0569bf0748c1d315, 0xddfcf88867627c4c, 0x2315817c100665dc,
+    0x88f879ebe8f01884, 0x7c2876504b6e93a5, 0x000000333eb7ccdd,
+    0xf67465964dade31b, 0x130252e0a14fef79, 0x8517bfb3afcb9982,
+    0x3d4df9818c84fd51, 0x27bd9583b32008b8, 0xe655591dc6408b24,
+    0x00000080d65c72c0, 0x75a94138bd9b16eb, 0x85666e7704790e37,
+    0x1cc21b59a63d5886, 0xa09ea04f81643320, 0x9a2d4cced90ec435,
+    0xdd5547b31140b727, 0x0000014c5a02a6a5, 0x1c8aa5ad0323f15f,
+    0x26f380aa02a3bd66, 0x43f339c733ff2449, 0xa4e3ae6a2692b488,
+    0xef5e01b6850a5ff5, 0xaf9a455073d9e009, 0x00000378573e8662,
+    0x999d24d4bc079e9d, 0x485c533ac26dc1d1, 0x19bceecfeb5abaef,
+    0x15cd22cc04b4ca6c, 0x83db24aee6c55c48, 0x0de502b1190dd05a,
+    0x0000087d0ceffd2a, 0x51736a45c0697b8b, 0x14a823f828bbf1c6,
+    0xc4dd5ff79e92aab1, 0x7ddd94d2a84d1973, 0xc40df53c25930e84,
+    0xc2d7dd1b3fddf337, 0x0000161294812bf7, 0xc696279a1d7cce8d,
+    0xfd72a55a0b09b8ee, 0xdd35df5e5a848f27, 0x719c317278c71bf9,
+    0xd72d9d351b221bc9, 0x940b4b341f737ffc, 0x000037232967d76f,
+    0x98ef9f264b35b9ad, 0xc41379ea8b9b7b1d, 0xb0f6a01b0db2c482,
+    0x23e199f23f68920f, 0x2276a8750293aa24, 0xa38af445f8495720,
+    0x000086d19e7189ba, 0xd10d6f1f76da1713, 0x5e067151177d80c0,
+    0xb367ebf2c0fcd3a8, 0x5727e229a79e24b8, 0xbde5333dc2f883d0,
+    0x6c5b9ce38deac524, 0x0001505e09b50eac, 0xa10679175ea55fad,
+    0x3b17e10ca42c2bbb, 0x1af8d16729b3d497, 0x8f34d8fa3eb4339c,
+    0xd5eae9c965526dd1, 0x3fb2a7a941dc9a83, 0x0002ea2d24e80f39,
+    0x83de95d4b58ed3b1, 0xe56f78f3587532c0, 0x693bd5b3af56f64f,
+    0x3bec877ed730bfee, 0xfe22dd338f0185d3, 0x3f9d06679f367440,
+    0x00066921e0f69293, 0xe43f55eb27b3e76f, 0x158d9afa4e934c0e,
+    0x3d2aacfa3bbccd45, 0x9bd378c6481ece6c, 0xa73513b185f97441,
+    0xda6206383947ce7b, 0x000d22485471ae69, 0x742d7214c11a044d,
+    0xd8aaf45861f3b396, 0x61816c7423b1a20d, 0x182122bafecca697,
+    0xbd14a9a7f8df21ce, 0x64ee42f22ed36ae8, 0x001b8237c379d8f0,
+    0x745f0bff0d097c85, 0xb3da620a6432764a, 0x3a56039bf0beca73,
+    0xdf0396d679f54390, 0x519ac3faf0ebb97d, 0x7e75859fe336a948,
+    0x00384ecf8eaef947, 0xab8e828a3d90e807, 0x08f4381b1a7fa44b,
+    0xb7f49d2ff31b2059, 0x3d57c0b98a834b38, 0xa6ca4befde2ee40f,
+    0x83bbe8b214c1ff95, 0x007a30350954aac8, 0x681dd84c0bc18def,
+    0xaf0ac39e631f6e98, 0xb1a81a985aecd97d, 0x606accbb4167e92f,
+    0xa05c0566b937968c, 0x3dbd38d1df61d07b, 0x00fa0665f639f343,
+    0x4f3cdd1767535931, 0xe84a0defab18bd1f, 0x61c2c536380d1a8b,
+    0x411de0beb496a33f, 0x44f18b94358448f9, 0x5e708229096a1f0a,
+    0x01fd9778d5133dbc, 0x5b180fbe0e846cb5, 0x8957827aea46dd0a,
+    0x9902c2331ce696fe, 0x8427d08cba0bd01a, 0x33140ccb7796b2ee,
+    0xe549c730cc2864a2, 0x04679fd98c3766cb, 0x3b94a894d622e1b7,
+    0x829acfc6b7e50d8a, 0xf74e114cf65b4f1e, 0xe7e811e2aefe20d9,
+    0xa699e5becd0d2ea6, 0x66362f3664381945, 0x083cf0c37facc749,
+    0x55ae76ce3e2951e5, 0x41c650d4a9249c80, 0x2ef1ede85a6022bd,
+    0x566d59b886697d90, 0xdf21fc17a6b762a1, 0x4d621666b3e02c88,
+    0x0f79cad13b3f0b37, 0xad6656ce58975135, 0xfd974ddb092e3af5,
+    0x74bfdb78d9837cf6, 0xca51ba955870b7da, 0x94427b0f2191038e,
+    0x93dc95d5010528fc, 0x1ceb779d884e9d5d, 0xab8c4628b5bbde8d,
+    0xbc85b192aee98294, 0xe534bc84fbcb9bd6, 0x96ab07c66167ccd8,
+    0xd2ee2583306625d2, 0x0dd329eadd92f3e8, 0x34b5a05c47f3be2b,
+    0x2b0885cbe4ac762f, 0x8926f19459caa0f4, 0x0aaaa7cd8d5a45df,
+    0xd5003664d4668b59, 0xf8276cb991b10579, 0xc7ee37b5228997e7,
+    0x5f5881aef9c792e9, 0x510ca0531d5b230d, 0x1cc9b6c3c4d8693b,
+    0x527c4db598d93fbd, 0xf42ac2f5bf0c4b69, 0xe0c0f2136e05f726,
+    0xad626e46c45be108, 0xb46a67e9f07f2faa, 0x6ae5f569261d9fe1,
+    0x5fb45ddbdbc4401b, 0xadde169ee80c2130, 0x0b3834ab49d87485,
+    0xdaf716584635fdf3, 0x7f20fb62bd12f283, 0x5cf2637972c84b1c,
+    0x0000000000000001, 0x1f7f0e40f3f8dd41, 0xe7b7460b1359039c,
+    0xc8439ba205cf3491, 0x10f8cc8f88ce7c0a, 0x7de79af5450dba76,
+    0x8f5b1b15bff38802, 0x92b18be47f724a92, 0x0000000000000002,
+    0x261becc8a999cea1, 0xdde9cc22273d087d, 0xb118920e18f0a53e,
+    0xf6982a63673f586a, 0xaa95ffd0f1d137b7, 0xc5199af35fe820f9,
+    0xa47674251cd5c763, 0x0000000000000004, 0x1c92f9410d3a6673,
+    0x958d71e35c9b1732, 0x95a0ee97eea717b9, 0x4e26eb79419a1495,
+    0x6cde70abd9819aa0, 0x60d4298e80c68a0d, 0x17ed4f6b09668f08,
+    0x0000000000000008, 0x94bc5d6422d35553, 0x44c8d0bad0c853ac,
+    0x41a64183c3b802de, 0x973eb590dc27ace1, 0xff14fe437fbce1b9,
+    0x00eaba19763b86dc, 0x82100cb1e3d9f3aa, 0x000000000000000e,
+    0x4a09f3b56cc8cd49, 0x302c227027adad5d, 0x27e828da173e42be,
+    0xdc198ba60fc69b6d, 0xeb03f85253bba97d, 0x7fbcfc86af7fa4b1,
+    0xa2009c87ab662db0, 0x0000000000000018, 0x159c6cf10c828093,
+    0x8b1f51b03c0cd043, 0x8dea8e86acf9489a, 0xac7334f3d9569ae4,
+    0x181e7193d7311c3c, 0xe25fe549317e4c87, 0x985e994303417edd,
+    0x0000000000000028, 0x855e939c68ad1021, 0x0c65a748396dfdba,
+    0x47f1f2cfaeab1f1f, 0x282eaf9713c376d9, 0x85cbc2ae0d112272,
+    0x54411308eda70f04, 0xaeedb9d6676b1b40, 0x000000000000004a,
+    0xff60a4a18b109d5b, 0x11bc78b05b53a71a, 0xb5fc43650450bec1,
+    0xeed5611ef89aa471, 0xdb56dcbc9c023ed4, 0x0b225f9182cd6450,
+    0x7afed929d7e06271, 0x000000000000008e, 0xb2e3fd33db5a220f,
+    0xb82bb4f8f7a2b38a, 0x9b9a73c4c174da2f, 0xad79ab5fd71b8c1f,
+    0x560d09f334a3f2dd, 0x02e597ff61633cfc, 0xd3cbd8df31a88aed,
+    0x00000000000000ed, 0xcd391dc01eb4a129, 0xa7c657c79a904756,
+    0x74d9e2bf478cf4cd, 0x84cb131f6bc91d60, 0x0aad7b4cfe371588,
+    0x36e918bb54aa8ba0, 0xd5eafc753bdcdb86, 0x0000000000000187,
+    0x6e959081cead5627, 0xa11418b9d080d0d4, 0x9d6f4e12fd148edf,
+    0x68ee3f562a630b9d, 0x08da0eaec5cdb326, 0x5dee1694712829ce,
+    0xfe4e24e483f32ade, 0x0000000000000280, 0xb3cc67782075d1e5,
+    0xabc32986dd955d49, 0xed57350d85ae0cdb, 0x086e251e7457c83e,
+    0x753ac713598fae36, 0xb61ea6d2c8466f35, 0xa3a1e49486c15d2f,
+    0x000000000000040a, 0xbca9b7c780992d89, 0x0caf283742d07033,
+    0xdb5864aa0cf824d3, 0x5dc362ca13daa2e8, 0x2510a8a7caba8060,
+    0xbc89d4447f2395b9, 0x8c62f5ee6338954f, 0x00000000000006db,
+    0xff997d8f770f1453, 0x7f73b5fc0d35fb1f, 0xe5aaafc8b950b291,
+    0x8995ce6a084ce437, 0x940e79a673d6dd26, 0x77460dfbbd2d2169,
+    0xa73e430b5c5809b4, 0x0000000000000b4a, 0x4e2ef560355fc249,
+    0xd82735a2695d8f5e, 0xbf38ec4c04c315f8, 0x8a5710ede4a7b8da,
+    0x3716672917c16d81, 0xc00795dcb9d0f20f, 0xbfd8b73929179c0b,
+    0x0000000000001228, 0x18e01ed4aaa24315, 0xf72c28c440665409,
+    0x3a8cd0876568502c, 0xe71255918e85ed75, 0x2b5134cdbcc7c375,
+    0xd118a0f949754896, 0xb5877a520e65ccc3, 0x0000000000001c40,
+    0x0935d096fa42f133, 0xd807203c4f8f7770, 0x67ed56015160f673,
+    0x45195aabcb07bd26, 0x18fdb6ebf81bdeb0, 0x7c8f7de06b2594cf,
+    0x7eea8adfc0e10751, 0x0000000000002c97, 0xc3b554c315286fd7,
+    0xdc3041b0f651470c, 0xf22260faf985053e, 0xbd5657f13a2de4a0,
+    0xc2091125d53661ff, 0x3610f519912833eb, 0x1a5a7751b71ecad8,
+    0x000000000000449e, 0x9acaa9206072b529, 0xddd9dea5abaa5cd1,
+    0x9181659f40031f7b, 0xdbe7ee395c36cfb7, 0xe1f8b07204d941ac,
+    0x42885bc99e1e8239, 0xcb6925242cb00aa3, 0x0000000000006fc7,
+    0x3286db26b76f80e5, 0x501fe700bfd9f08c, 0x4bf201d549b90c97,
+    0x9321065801640ec9, 0xdcb4bde96c4ee355, 0xc62b3ef5467ebe1b,
+    0xe03b08136a63d65b, 0x000000000000ad4a, 0xfe4c952184bc1be7,
+    0x3ceaaf0988f60c1e, 0xe987174079e9f682, 0x1da6403e97e351ff,
+    0xeae2758394e76c04, 0x7772fd2589cb6a63, 0x36bd4d98b7eda5f0,
+    0x0000000000010672, 0xb9df0dc5973bcf9b, 0x50f38eeed4d7f34c,
+    0x5ff692432e15851e, 0x69dacd53db067576, 0x9fd8810c399a587e,
+    0xc71b5eb1572a1979, 0x1c7678979398fb9a, 0x000000000001a92e,
+    0xd559f93e244e1d4b, 0x211bf66d37d6a64a, 0x239c406571cee66d,
+    0xd96007b7c6b9b84f, 0x7f57df4b75a4c2ce, 0xd26197a1ac39dded,
+    0xdfcfe2e9f6fc85cc, 0x0000000000027ac4, 0xab3ffd0d157c8aa9,
+    0x3923d5589fad89bf, 0xac57dd74f33ba232, 0xc96c1f7c99a4cde6,
+    0xa950375bb57e3748, 0xd28dc9a88107048e, 0x37526a36c9dd89c3,
+    0x0000000000039969, 0x49a93f72a5fafc15, 0x07fcf500680897d2,
+    0xa62dc972d51be0b9, 0x0de3050c026c815e, 0x83879a93ea692e94,
+    0xe0e8f4f3ff076e7e, 0x2eed1e6674c93998, 0x000000000005c16c,
+    0xbcb3f89748cf2ae3, 0xe9baf3e414e8a893, 0xa83147e16ae838f3,
+    0x9a091aa34986e86e, 0x60c4e17013324d27, 0x65e7b480210ace0b,
+    0x9b30f943369f5b4e, 0x0000000000095836, 0x2537d6968f471e2f,
+    0xbe852f4bfac0e305, 0x5476a6558555dc71, 0xb22273b0e06185e6,
+    0xbc48285ce97966ec, 0xd75794d5fd23104d, 0x41d4628d7a049f12,
+    0x00000000000e704d, 0x7413cf9a77d3a3e7, 0xfd231a049fe1394d,
+    0x53efee8841d18f7c, 0xaa8ae653f0f50dc2, 0xb317e11a072ed1c9,
+    0xd8709bd6c6db666f, 0x3a09e79b4dd65a35, 0x000000000015d116,
+    0xa1723237e67c6509, 0x8c180afe474b4198, 0x1c0d8021c916ee82,
+    0x8477b1da3e74926e, 0xb1bba569a8d5955d, 0x743c64b2cbd53f54,
+    0x3a8a0892e713c6a3, 0x0000000000209403, 0xfa26f962884d9d91,
+    0xa574f3b862bde74f, 0xf250c1303fee4962, 0xfbfb4453c77918c5,
+    0x80662f9cea6e9e5b, 0x77891c7f6ca5b1cf, 0x6ded793c6063e1f7,
+    0x0000000000306b07, 0x90740bf346d7f95d, 0xbca80105107932e0,
+    0x676694e4160e9334, 0x042fe750757ccaf9, 0x9c64aae18a93eafc,
+    0x59b976b804038ce8, 0xfa2c19065b36cbec, 0x000000000047b1a0,
+    0xdd6216400c37124b, 0xe0efceecc0900fe4, 0xb0078d6eed20a31c,
+    0x9eff9625dd555244, 0x048e6dbf417222d3, 0xc41caa3adb809619,
+    0xcf5fcc0daaaaf04f, 0x000000000068ac27, 0x9760866838d65373,
+    0xf0d61dacacedbe7f, 0x9b6710f5916a85cd, 0x341d1ed6a226810e,
+    0x0c3349739858c1e9, 0xb7f381dfe6db317a, 0x1553349759a7ebb3,
+    0x00000000009838c0, 0x235ebd39cf4aa863, 0x471402ad64bf9fbb,
+    0xe843da761f15003c, 0x6640f3fec10a5333, 0x8d6831cce5cbb077,
+    0x11363807539b35a1, 0x4c44ea506f042b1f, 0x0000000000edc56b,
+    0x56456e337a47ecad, 0xead1cfb3f29f25ba, 0x88ed50c6f8cea1e8,
+    0xbb90ec3b322e8491, 0x0f5110ee54f3616b, 0x463b3bf2a34461db,
+    0xb6ece807d21e2a5a, 0x000000000159e7ce, 0x1facf7611cd57fe1,
+    0x3f936e05f6133c0c, 0xe0acb27e8da359d5, 0x4f9ee75e664f198f,
+    0x5d679d5763c1fe46, 0x9417ec1c9fca1caa, 0x611f2829b00303e6,
+    0x0000000001ef92a5, 0xf2af2c4b43149feb, 0xc46a71871066483f,
+    0xee58d06d0c81b28f, 0x2971a4afd60d725a, 0xab9b2087ca3c767c,
+    0xc3642617b1326bf1, 0x26c4a58c624d7e79, 0x0000000002e4b294,
+    0x0bc0c5d5c7455cab, 0xdd4557c5d4d2b7ce, 0x08097130895bcb9c,
+    0x5942c7f51bbe262e, 0x27d404396d08d65c, 0x80e04d33712375ad,
+    0x9858ce8bc7b9da70, 0x0000000003e78305, 0x5ebe3c929619d7c3,
+    0x58ad8cb2a9c273a1, 0x34791638c973404e, 0x0084ba1b88795ad4,
+    0xed2012e25a75cac3, 0x05045541377d5bd0, 0xaa51769ecdf04620,
+    0x0000000005ae8cc3, 0x6879fa5ccc0fed09, 0x1d64ed5a239d03d5,
+    0xc6a93cbe13263955, 0xb6665e726a05dd68, 0xa7e9afb8e744190a,
+    0x16870ea415ceb2bf, 0x33a3dd33f447b6b0, 0x00000000081a4106,
+    0xfea2751d967c2f1f, 0xbf3937df492394e5, 0xb08925ad9fb73353,
+    0xad49ae1d213da1e9, 0x58e1dc633b929bd9, 0x2bca277f02e6af21,
+    0x55f87c92c790e2d2, 0x000000000bf13cea, 0xc346f198c7b964df,
+    0x0f00785091347c98, 0x11a6727aeeefd5ae, 0xfd64355ee9f65257,
+    0x47828f6502e617a4, 0xa1ab65eff00d6aa6, 0x5572ed4ef6ad4e6b,
+    0x00000000119dfe55, 0xfee16c88c4d14927, 0x73028fbdded8c2b9,
+    0x70e0b05b73da357e, 0x4744c98ded31c451, 0xf31d3ab21389f3ee,
+    0x67bbaec9c5a3610f, 0xbb5772c4eb4a369c, 0x0000000019436a22,
+    0x8d27294d4e76096b, 0x065c4693c1b159a5, 0xe63a919f1d90e094,
+    0xdd418584287c14d5, 0x6fb86de6eb42aab7, 0xab91630fd6746029,
+    0xc5edf889576e2b39, 0x0000000024119637, 0x34503103ab600c93,
+    0xa6727f69f78a3c14, 0x9052ffae3db587c3, 0x0f332c1a53a56872,
+    0x67a0b7023c201721, 0xa7ce0502c20e0380, 0x59bc2b880024b09d,
+    0x000000003258b92c, 0x80805820b48fa831, 0x175bf24c8cc524a0,
+    0xabc9b15ec9f97a44, 0xd3528e99e4c2b58e, 0xdd937797310e0aae,
+    0xe74fbdf4ff910d15, 0xe0cf4493ec0d3f50, 0x0000000045474d6e,
+    0xae292aab26c69825, 0x3f40852523dd223c, 0x22bfce1d5f8618f8,
+    0x42777f9e50ca8143, 0x50b2937f5d72978f, 0xd7a68e1a1d54b60d,
+    0x1ae9058655ee8996, 0x000000006476b4e8, 0x4517eeb2d687e053,
+    0x0c478c045d1bc79d, 0x2105304013f3e04c, 0xf02f045f00e919ab,
+    0x9a7493f39228f962, 0x3dde51b67be3524c, 0xed5ffd58891eabbd,
+    0x000000008ead3d54, 0x948a9bfc3c57c37f, 0x2becced0d67bf0a8,
+    0xd5eb7390cce4f5fd, 0xebf08dc49ba47fb3, 0x21c4c8c652703051,
+    0xa041be20441909cf, 0xe860d250c8c07ab9, 0x00000000bd92e12d,
+    0x8404a4d790c2e243, 0x004df43891c23921, 0x270e22f10bae7e76,
+    0x062083042519fafb, 0x56ab4d3208cae6eb, 0xef11f57831300e37,
+    0x6a0219bc1962e8b7, 0x0000000102c580d0, 0x37e73db55ac2c4ab,
+    0x89e02eec8f2cc0ae, 0x8893780a193f8d07, 0x139a874b3eb6c055,
+    0xa0bb742b0c834609, 0xf236c15333e79474, 0x838319e9a7b75b95,
+    0x00000001605ec81a, 0xb3a09b510cfb45ab, 0x7b8476ee3a88b44e,
+    0xc18671060b5fae0f, 0xe6c24b0c76aad976, 0xf3b74e1d08a7ebe0,
+    0xe2b820413a63b839, 0x0ea9e9975156fdcb, 0x00000001e64e0052,
+    0xd693303f19e8e1e3, 0x26546a9c42227daf, 0x8e73a2767953bcad,
+    0xdf0d75ce6b2992fd, 0xac123079d126b3e6, 0xfa90cf3477c90409,
+    0x16b70f20b9a8b0b2, 0x000000027e781b3c, 0x0273890e7df76627,
+    0x29ed3e52c94136a9, 0x5e263eebdeb4963b, 0x7ab89aa6d7bef828,
+    0x1ca4206f548eadcc, 0xfd52f6d6f2324d38, 0x385efb37f2288eca,
+    0x00000003790ca4a6, 0x729ee038b6daa1a1, 0x8fac65052358c429,
+    0xdba4b24c6fb4236e, 0x77d7f86f6305d17e, 0x924927fdc7335e85,
+    0xa8dcfb379b6d0730, 0xebd0bfbfcbc2c852, 0x00000004bc2c20ba,
+    0x85fa5a25190c5a43, 0xfd8fb044f1c55ec2, 0x9203654ee159fd2a,
+    0x91d6c89be36c9f16, 0x94f8f63fd20ba789, 0x1589ca13e711b828,
+    0x66c08e6f6f55ed7c, 0x0000000658dc212d, 0xd4a7dbac6c899fc1,
+    0x46581a5f6f0bb4de, 0x428b2cc02ed89932, 0xde28e7aca3f8e8d1,
+    0x8ec3bd48a2b3b104, 0x273c1bbc37ecf099, 0x81eac1cfe121e9d1,
+    0x00000008c38e1e41, 0x9c070719c706092b, 0x4247ec5fa432be9f,
+    0x6ed1d0beddc5c654, 0x9e570fed56cf92f1, 0x8f6c31cf71fbc3fa,
+    0x307bfa75c0b76f4a, 0xe847d8091b56a326, 0x0000000bfb1dac7a,
+    0xbd6f029d41b32419, 0x7515b7ef83607cb4, 0x07f350232889555a,
+    0x93e2f92fb096c159, 0x61a8cf655d23d074, 0x39a7534e85a7c59f,
+    0xfe46f22954a43535, 0x00000010b9416bd9, 0xdbbde6398fff76db,
+    0x695d1f4022a30e7a, 0x45008dbe04f5055f, 0x40ea293e270c17b6,
+    0xb42b39f897181d3e, 0x1e1e47c07f8f6121, 0xf9c631e540cdb7c2,
+    0x000000168c5fe541, 0x843eab63b71fd495, 0x8a00d3ce32dfcabe,
+    0x8874912f28b93a13, 0x99be147b2744e0a1, 0x246c1abc51f361cb,
+    0x81092482f420a9bb, 0x0c821d1a21600122, 0x0000001eb2c4d127,
+    0x4153b8201cd50bd1, 0xc3ae462c0d5f0022, 0x2ee23bcf9352978a,
+    0x9d2bfaa3e23ee4f6, 0x2ad1cf4fe88743ed, 0xdb9f94dd07e61f7f,
+    0x146160f2026373c3, 0x00000028315d70f5, 0xa45476cb6d1cad65,
+    0x4dcfdd5f09e549fa, 0xd5eacc5d169692f5, 0xb3a8aeec81da3dde,
+    0x1e675763a017b62a, 0x3dfa4b109086a93d, 0x30e466f06052119a,
+    0x0000003484b924b4, 0xa837ad1bf70420ff, 0xa764cbe9957bf181,
+    0xe4b7dfd522aa1370, 0x5d5f745de3156c8b, 0x53590c94153c3595,
+    0x3e586cc2138ea498, 0xcedd78af93b8910b, 0x00000046f881d158,
+    0x16b9af744111ef55, 0x753e8be82f93950f, 0xd3bb8d89a5b5d7bc,
+    0x1059c3ee5e13512b, 0x7d1e10cdadbd20ed, 0x6f3cdb035388293a,
+    0xe1376385749fd17b, 0x0000005cda75aec9, 0x4297664211788c1f,
+    0xa20e5da22af3fb4a, 0x0dce667f21ebc7f9, 0x067842c988d5ffcb,
+    0x6fecb7ecd475e1f1, 0xf1e63318f9a0b813, 0xf79fb2e2538ce335,
+    0x00000080bcd3e780, 0x8fc8d8492ba08693, 0xcce9b2c0ce1adf4e,
+    0x1e1d21a0415bc7d9, 0x1d878a206ee3820e, 0xe8549478416ff98b,
+    0xf811c326d865a1a3, 0xf407ada899e2e0cc, 0x000000ae7161c072,
+    0xb0a95e9c5109176f, 0xbe4dc16e3ca73d9f, 0x1e7a7bceeeab788e,
+    0x3c4df8467002b4b7, 0xa74a409170ca7f52, 0xb717623aa77825ce,
+    0x33ac3386a35a76e3, 0x000000e4f9f3a87b, 0x06269727e0ad39df,
+    0x5ac07e5f960d1343, 0xd74312e5de433073, 0xb090c3810e3bee21,
+    0x0688cf13bd319e6d, 0xe5db2713e64a1537, 0x3e8ea57f1c224aa8,
+    0x0000012cc687123b, 0xd4fb3639231b5e65, 0x52fc7cb6dc4cd3d7,
+    0x96e93e9c31fff1ad, 0xc9777da6b686fa77, 0xbf4d24fb337af93f,
+    0x6448054d044d8841, 0x328a645743329de8, 0x000001881b50bc11,
+    0x076f9ca6158cde69, 0x277cb66f3ccbc8d6, 0xd3d94643c963b499,
+    0x6501592a7e9021ee, 0xe98d66923534e85b, 0xecdce33165f58f4f,
+    0xddee35fbe8db923e, 0x00000206b2ab7752, 0x9a5641f1b0ce3c85,
+    0x3c289e127f9c671c, 0xc92f1841564b555f, 0x73cb351d86c551b3,
+    0x7be6477082993f4d, 0xb692c54119da4583, 0x6a63e3e51ab256ce,
+    0x000002a74b818540, 0xeaac28adbf26e15f, 0xf5a40ec7e2c9a689,
+    0xdfd45b0095d154c0, 0xb7d87f01f341f8be, 0xb0031fbe16e1f2bd,
+    0x4181fed6d18a7bee, 0x17cce5ffc87ca5c7, 0x0000039db19c4c37,
+    0x930db5b891dc4a3f, 0xb07bf38b50ca4d55, 0x964aa0351ac9f7f3,
+    0x45ed95f69355f99f, 0x434586d0781007b7, 0xb76fed4110de0fa3,
+    0xb3a52bf039a698b1, 0x000004c0b9b2b834, 0x04fd4b69ff667655,
+    0x1ac4b805c1a3be85, 0xbc8c11f93100a312, 0x064c427f52a69af5,
+    0x9c0f8cb27f2788ed, 0x7b1f32908581d56a, 0x9d372d9fc6644f77,
+    0x000006189260e72a, 0x072a85f4a670df9f, 0xcd70683bf9ae3ea5,
+    0xa295f5569e064332, 0x8108133af03d09c5, 0xa2a71b878e95682a,
+    0xcd52ccd773d65c0e, 0x8cd984602ad42490, 0x000007e0a672c0ff,
+    0x1626cfaf3b39050b, 0xfdda71d61474986f, 0x41ae8ccfb69625e1,
+    0xa8366760b26a8771, 0xbb986857646c4ae5, 0x33bcd54adc594391,
+    0xfeed6bbb8c34c184, 0x00000a17c4d6c0d7, 0xd21dffd4102d49d1,
+    0x0965821cc46f1508, 0x5d8fc368e0797164, 0xe2a219f341262da5,
+    0x5dd1ebc191b2d463, 0x03650a58fe225ebc, 0x6e18004f0f16f497,
+    0x00000cc283813789, 0x54309ae8d8b383fd, 0x6c360c707f1d86f7,
+    0x4ebc953d8b82d039, 0xaa57234494d63c0c, 0xc08f5cf4dfc63e14,
+    0x3a13ea2817b0cdea, 0x9e9e7dfbe2d2ddb4, 0x00000ffbf9c24c51,
+    0x2e9d6935a4dd8cf1, 0x1f9d889ac8bf78f3, 0x352648b8998c5c24,
+    0x0a3260a5e8caa066, 0x7ed6288ad909a3d2, 0xa8a130c01b026af6,
+    0xea3c33afe5dfd47b, 0x000014362ff10aa4, 0x70374639560d31d5,
+    0x7f52a0e7eb36a239, 0xa91dcb22218083dd, 0xc6c0c1960f197f11,
+    0xaf6b8fd030048470, 0xb97c19b4b55dd070, 0x9b5fa9f807603dcb,
+    0x00001a3ab6572b88, 0xef1256b279567f4f, 0xe369c5af50a9cbe6,
+    0x5150b438aec55d94, 0x23f5b02cb390eac6, 0x5da78f867ba7862e,
+    0x764e4e36bd6c172b, 0xecec26ec4aef6307, 0x000023566c9a935f,
+    0xe53d35e46c69111f, 0x1c8498000fc6ab07, 0x492d6dca2ea52f12,
+    0xe9ff3322ab75389a, 0x9c58aed66f16e706, 0x2823a83ff2bf3bb3,
+    0xf0dd1d3b24ab794b, 0x00002df4b7f8e8cb, 0x779c383801f26025,
+    0x167d77930a18d1fa, 0xc05c53e59afe30be, 0x2c4bf7d75f9ff540,
+    0x93b6da11e1f981e5, 0x5cc96d73a6cd9d5f, 0xb0bcb457c3871d9b,
+    0x000039c32cab6e8f, 0xa13f0ea2c04c92ed, 0x83a461923c209e4c,
+    0x81af1fc57a96b4a8, 0xc1b454487769d412, 0x6821441c0eb3c887,
+    0x0bbd68279dda34f3, 0x3512c482615e8cc0, 0x00004b07964b9b52,
+    0x5d8213f66f03d0f9, 0x9e745984e2226b4d, 0xd9670b2ad6ddf19e,
+    0x1d383f37f3fb8cdc, 0x785f64bda2cb83f5, 0xd0ccfa0f2d40c5ea,
+    0x38d95920681c33fd, 0x00005ee7d83b8296, 0x7fbf56038eaa3741,
+    0x0902de5140585121, 0xf3e4e425a22a949d, 0x3520d44842996b22,
+    0xe59cc36c4182e622, 0x5f64727bde834f83, 0x4fc36b8202c20dc3,
+    0x00007afa1fc0327c, 0x80857b5734779ac1, 0xc2d1c01e070f124b,
+    0xeaef65f3f501764b, 0x78d22dba53b4899b, 0x26fea277fe7a277c,
+    0x3abd797c431b19db, 0x7d259b26499a162f, 0x00009f1db8be3744,
+    0x8e2c5040458ba0df, 0x6fc9ea04ad4b00ad, 0xc2b6ba1ffafa5d38,
+    0xf299ddb8f1906943, 0x2b3ccd6cc84bf53b, 0xb6b1bd046cc141b6,
+    0x3f20e1171c9f8cfc, 0x0000cd67ff705565, 0x9e89150ca30baf01,
+    0x1811981c15501f30, 0xa5e1759b244be809, 0xd526d2b5d2c02889,
+    0x76cd35a7137f56a7, 0xb2bbcae629a0c87c, 0x8482ccdbfe5d39ea,
+    0x0001078a3c0c7e5e, 0xbcc62ab402a661b5, 0x13b2aa507f8c72d2,
+    0x942d0e83ca874505, 0x504c59efa5e9cac8, 0xf81cbbd2ee9da684,
+    0x257cccdbcd7054a8, 0xc6417258b6ec4644, 0x00014b912b43a713,
+    0x9d8ee758e0c3e967, 0x2d6de0b95d1ee728, 0x9dd2fa2802afd008,
+    0x26d44b7e6ff737f6, 0x56430154ae85cb54, 0x983de992ab2ed7a0,
+    0x839e450d4d852f98, 0x0001acf6c093bf56, 0x8fc9879ec62565b1,
+    0xc7e5ac678fa6cfab, 0xbe379ac8c6078339, 0xbfb597f824f591f4,
+    0x47fc9a5c048de588, 0x22c79b9412fc7fed, 0xab2d31b69b0e1bb8,
+    0x00021f3cad372be7, 0x84f17fb598fecff3, 0xe4b66056e3e810eb,
+    0xe77d5c0be36deef6, 0x2df186fbe20eebd4, 0x370cb1ef0ef4f2a7,
+    0x8d7f6784f990a91a, 0x907c0e50cf63e76a, 0x0002a1c185d59a6c,
+    0x9de5da612590aea1, 0x1ee60e30af253350, 0xe72c63061b30c274,
+    0xa0ca213e0d29d9ee, 0xf2450687346ba16b, 0xa8a32fa03400f3f6,
+    0xd5f7c657e0732066, 0x0003555a962ed866, 0x10e586a7095f1975,
+    0x5fb88ea51d037086, 0xb2893734d7f2c98e, 0x9c011ed2cfc8e745,
+    0x0610cb98a36fe8ff, 0x7fe9d71ded29a42d, 0x7ea1bfe29cb9db17,
+    0x00043f048a4a6fd7, 0x8d43bffa80ef9c5f, 0x2bb8db494a4fe518,
+    0x6be02900f59fbb81, 0xdb3153943554d091, 0x71c39f687de21505,
+    0x729e4817c5db7714, 0xc51550a82c82a5cd, 0x0005487a2add9297,
+    0xec8fb8107e880b51, 0x3874dcda58778ac9, 0x66a3adeffe44ebda,
+    0xf8708e37f125689e, 0xcc5b61f79f20dd2e, 0x79b9c01931ef3f8e,
+    0x51f9440f38ea72ce, 0x00068ec9a4e697b8, 0x8fb819c28620cf87,
+    0xd10347b8f61e1900, 0x1b76dc00d5928a7d, 0xc8d3eea2ca144a56,
+    0x4bc78c248be7c973, 0xb4142638a59bb364, 0xd774fc762b11f63c,
+    0x00082277b0a3c9b9, 0xf78edfda1111c15d, 0xba6976b46d6fdb89,
+    0x8f8323df0908fbb0, 0x3a6b05f75a3ee2f2, 0x5286a3daf70dc5e7,
+    0xf9b23d302e351132, 0xc650afcb1961e394, 0x000a1c6d02ca5be4,
+    0x611d64b6f107c009, 0xea259a4db4438e79, 0xb3a444234917f1bc,
+    0x3a609920035cf489, 0xa7d62909ba41fe83, 0xbf0c0175bdb2d68e,
+    0xbff7e56a9d47800e, 0x000c712ca6ed34f4, 0x2782afcd7920b9a3,
+    0xd59b75d6503f97ff, 0x507bcdb4c817cabc, 0xfccf9c93ad0b3cea,
+    0x1ec1b57fa6b768fb, 0x94fe04090df0faca, 0x88dabe62ec949c61,
+    0x000f83d736e43ddb, 0xd60c2a2dad0d0a85, 0x96b26cf5f0a64ed6,
+    0x1bb6957a7cc9cf37, 0x65e752a0b48479aa, 0x9c28d98a38c0547a,
+    0x1892dcbef61f590b, 0xe90eb118875cf818, 0x0013e83a03c2bb0f,
+    0x6f040ced18ccd9ab, 0xf37c9de9dff39561, 0xd50569f8428c3f26,
+    0xdf742bcbbc93bbeb, 0x23dfd1efc5094939, 0xd2590308860067fa,
+    0x813ab0571b795ab7, 0x00190acc3fdfba98, 0x053d2c50d111ae7d,
+    0xb14f8fe057d59848, 0x83160f081587cfaf, 0x562fac78ed622ce1,
+    0xc00b1d5ed0306b3e, 0xe202299f74350ced, 0x742ecdd1ed605789,
+    0x001e3490766af738, 0x49cb4362e2588d3d, 0x62a7aeead35c94e0,
+    0x45ec757b7c2cdb69, 0x71f13bcb8249083a, 0xdd5c1ee4df011993,
+    0x4a41408bc2688fa1, 0x79d6dbaba8ef8e8d, 0x0024fd9ff60461f3,
+    0x23d485a4df1972ad, 0xab3a130659732be4, 0x499caf839b803f8b,
+    0xfbc65f791873cb17, 0x99ab9489ce319580, 0x9d0927903df3e829,
+    0xf46a22ecd5c7173f, 0x002de632221e0f9d, 0x1dd51f93193288d5,
+    0xa2a9a6cb2ec2fad5, 0xbd8981dca0af8650, 0x796a0501d75822b7,
+    0x4457a745512ec032, 0x77cbeee4c63adada, 0x40eaa93b165f8434,
+    0x0039f450d8ea291c, 0x5de45fe1268a3727, 0x0668c8b12c256ce8,
+    0x6045998e666681ea, 0x970bbef6adbaf0f4, 0x46cacd79e87d6800,
+    0x163a400c2eb087ab, 0x5f28db2741f95fc2, 0x00478f0fba769ee7,
+    0xa35c1f54c01c62b3, 0x52cd0934dc10515a, 0xe7e6c531568b313c,
+    0x7596e921056092d3, 0x5e8c3939ff097fcb, 0x7c56864382129a39,
+    0x5c28dbd0b23a9a75, 0x0057344436a6c877, 0xfc142666d6e05025,
+    0x5957378fe495208e, 0xef9d456abcb86ef1, 0x2929be3c1b5d1cc0,
+    0xb6d7527492c96b64, 0xe027f603fdefb471, 0xf9d4adcb70190027,
+    0x006ca967034eb721, 0x647b436a98ea0b85, 0x3a32047a7e4b97b2,
+    0x04faccdd3577bbde, 0x1ae78bd44d7c6086, 0xc30bb066feb21d51,
+    0xd54a115532661da7, 0x7ec549dbf3893741, 0x0084fe6966c1cfec,
+    0x4f5e8fcf626d342d, 0x0896307751a2106b, 0x7861fe72164e7ded,
+    0xdb9a5b5d803a8fd3, 0xa17d19c45ef70e5e, 0xbd39b54ce3eddf58,
+    0xbe55d0dfad60eeee, 0x00a63683b99b3ddb, 0x1784a6eb0eef7b6f,
+    0x22a40f628b3b9f70, 0xb573a2017fd6eccd, 0xb4da2d56f1126d0b,
+    0xa191601e3e3a2d61, 0x2a45e097397694b2, 0x5fc8219af81b26c3,
+    0x00c713ddd983963f, 0x96b26a7294a5b345, 0xa6a3d77def1412bc,
+    0xb7f28d2d169f88a1, 0xb21ac8a4be554b25, 0x1e9c6c7f8bac3f83,
+    0x4ccaff39b2fbcb2a, 0xde9f55a6f18650d0, 0x00f7b888f4aa69ea,
+    0x066660ef293350ed, 0x733ba9bb4a1ae2d8, 0x72b7e31d207972d6,
+    0x252550f21cda2eb0, 0x4c01603297804a80, 0xe738765c1054df9e,
+    0x5b981c61ff2918d6, 0x013410db2da4d3af, 0x0c4c7a45da69f4b3,
+    0x07fcff0cf9881aa1, 0x86b9f601717c60e5, 0x4f7af4d1ef8a81e3,
+    0x57218e2cc120aaaf, 0xd2a4c063a098e3b8, 0x49256dcf9d95b5e8,
+    0x01765bcb8ea25f37, 0x9963739e52512b65, 0xe17d029cf5f72ffe,
+    0xde53307ea642d79b, 0x26be17dcd078f41b, 0xcd5ae4a1c9b0f7de,
+    0x2adb2d0e3229fcf1, 0xae6c5654de0108a6, 0x01c200cfc0892a88,
+    0x79674e9f46df227f, 0xd64102fe93b64564, 0x635b542ec32e12d4,
+    0xe019a7676cb84e65, 0x6fc19e2e76a3189f, 0x732e2b80c31e6a0a,
+    0x4fc92baa1f821ff7, 0x02270ec0062b6905, 0x667fff55204b8383,
+    0x7dbe4ff28ceda0d4, 0xdfe87205834fd207, 0xf06fd9876b6e6fc1,
+    0xc1c9ab99848da4e3, 0x4878cd808be79d2f, 0x24fdf3ffb3dea70f,
+    0x029395e0b2b6610a, 0xe830fbff93c00f5d, 0x671800d8c8d031dc,
+    0xac1af190326bb5fd, 0x6aa2261df46a5ecd, 0x15754271f987aa80,
+    0xb70ee10674c819d0, 0x59350b63cb657f9b, 0x030ee32b61d93717,
+    0x9d63abcfe4871a51, 0x6907e9e5e1b88776, 0x7408bae4ea74147e,
+    0xf35cbffa4dfe68b4, 0xf9387c7855c0e922, 0x4fdc4a24d29fb4a2,
+    0x8062b10b81762ec1, 0x03aed1168706ffeb, 0x51820112ad140c7b,
+    0xa8a59171a87967be, 0x5dd0e758aa21ed67, 0x586ed828bbe74475,
+    0xb6a937907430ae28, 0xddffb29474473a92, 0x0b047fc20917e7e3,
+    0x04801b3a97188777, 0xa3aec1420ba82fb3, 0xaf75e281380b42e1,
+    0x41f8bed8a7e7a5f8, 0x5a42964df7a6172a, 0x5b5732ba03cf4d09,
+    0x24e5235676d4751d, 0x4427846ba030e003, 0x056a7f3cc1a16c9c,
+    0xd01a613fd6e9a9a5, 0x9d102cc5ddac087f, 0xfd399affaaad2dbd,
+    0xcb68e2e51f1c9511, 0xce72839e98da7895, 0x3f37395961c4a2d1,
+    0xc0d468e2668289fe, 0x06810506c5e40207, 0x5cdc00dd6d615d85,
+    0x0fdeb66fc64926ac, 0x4057eca0aa8d1324, 0x8f9653aa7aa63fd4,
+    0xd95bcd87a155a7eb, 0xb8d1c9b00fcf1d53, 0xc667a5de3dbdac3c,
+    0x0805467c1ec00498, 0x5135098fddbb2965, 0x850a0d8335c4dd77,
+    0xf0c18565e5c66ee1, 0xac1ca96c80d3ce20, 0x04955c8d83e897db,
+    0x706e90d764942993, 0x4e7bbfcc5f122163, 0x0990a94c723131f1,
+    0xcb520e86036cc98d, 0xdf578ccec614b726, 0x36cb91f421c48c9a,
+    0x09a4a4d4ee689b4d, 0x7bd2f56d0f93c7a8, 0xd9b75c9438f8ecba,
+    0x5c6c1b7858ed5b2a, 0x0b69c7093b6afac3, 0x0490cee611f34ae9,
+    0x0707032dcff7f5d7, 0x60448adab5dcc286, 0xf03791cbccf08fa3,
+    0x03c55eca7f1aab66, 0xf9c15d15b71410d1, 0xd8b47757dca0882d,
+    0x0db8524e9399f39c, 0xc671249494b0a40f, 0xe09726c095a73f76,
+    0x589d792ff93e3bce, 0x9716ce66e530ba4a, 0xaf2f59d281b47c7e,
+    0x50ae64ea37a014ab, 0x6d5a52be508270c8, 0x10d360c88630cbdc,
+    0xea580318b2794fcb, 0x35550f4f02e1234e, 0x73ad9f23c3bd899c,
+    0x93345c0c4cb3c91a, 0xaecba6449ecf4219, 0xab2bb41c36d2b957,
+    0x2811c50b45bc0118, 0x14ad6fd946f4b33e, 0x620b1f5a39e181bd,
+    0x8567ad4e0dde6e55, 0x577ded602e7a4436, 0xc50cfa44a1bbbf55,
+    0x912624247c51e502, 0x191b313386a3ac24, 0x699cf5254c551d18,
+    0x18c6451730fd947e, 0x79051ef220a71d47, 0x732d03be7636cacd,
+    0x25c7bbda9f7d4012, 0x9afb01fa549397c3, 0x0658928a6ce1ff1d,
+    0x214bf12c9d59186f, 0x1cae321055444b18, 0x1eb2c7f4bfbb527d,
+    0x722f0eb14c25bf19, 0x5fc4c5ee7e472547, 0x89475fc0c36913e5,
+    0x3faf637d4f45314f, 0x39b955b8538218f5, 0xdab785d68d908187,
+    0x4d9546b18425f5a9, 0x24741aeacb47b5b4, 0x577c2c6d39a0d3ed,
+    0xba27a8750be0e936, 0x1577ae2b8adaf47b, 0xcf432a108133121d,
+    0x2d907db5a3412451, 0x75df8124f690600c, 0x54d445c3a474e6bf,
+    0x2c1d0d1960e0c2c1, 0x23e56e4de7036e51, 0xf2e37986c5d154c0,
+    0x4802acb02541c40b, 0x75f9dd897f861650, 0x1bed538c5afa033b,
+    0xe4845f868e001e38, 0x3d7a449b1e408610, 0x3542938433bf0681,
+    0xebd20c0c5cd5d969, 0xa0ea5d20b9b358e6, 0x18c2756cf88bbbb5,
+    0xa75d460e27d55ef6, 0xb7877d8ad16d7e4c, 0xd92223ca3bbaf0cb,
+    0x7db09f01ded6d08a, 0x40878ceeceef6a72, 0xed708027fc85b435,
+    0xcddcbd3e7b058966, 0x986b11eb6faa9e40, 0xbbe8e9043a6f9d7e,
+    0x555f11eeedc351d7, 0x8c4d796cba46069c, 0x5f34eb4aa98a8498,
+    0x4e71e10dc08dc5b4, 0x1df4616936cc5a8f, 0xe5c9d6152cf171f6,
+    0x9c2d2f4ef1d3caf1, 0x06338805c32283cb, 0x7ae9071034642db7,
+    0x2839170a7dc0f9b3, 0x12aee415512a6413, 0x5cdf941fb5047cf3,
+    0x784ec97a4020b313, 0x7478ea89dfc60ae2, 0x79e58a527a636bf2,
+    0x1c0731165027ea61, 0xcba51c38ec5b7016, 0xe8653bbf5c01e06a,
+    0x359ddae183c9f15c, 0x6b3ed0b123b918f4, 0xa25f6e5cc448106b,
+    0x955bdd2d9cf50162, 0xa1081cd1adb54851, 0xc5bf89ac2883e46b,
+    0xd89671005fe33efe, 0x8ff83b621c76b098, 0xca9971a61862972f,
+    0x823903d502a62475, 0x6322eb8055cada07, 0x18aeca365d9b6e2d,
+    0x0f7e307980f45efe, 0xbea484011d1c79fd, 0x351c3c854a8cd74a,
+    0xf212c809a9b416ec, 0xb38e78f0986ce638, 0xa00a229cf4be7f72,
+    0x88a34db3c0143bf7, 0x523a868d1eb0b8cd, 0x4bd407f842cad948,
+    0xfdfa80a9cb5076a9, 0xcf148098fe73a841, 0x777fe40b2e07b709,
+    0xc0c8f8d3ac387e52, 0xc17602fe22b4845d, 0x4fd9472d84bed7b7,
+    0x685564336481eacf, 0x91adb252a4c4243c, 0x251ca7edf7e795a2,
+    0x5fc8e594d68446ee, 0x5926b6c8d48be1d9, 0x82aa0b19b7e2d6c6,
+    0xe419a7aab53e1242, 0x0000ffb905ded927,
+};
+
+const uint16_t PRIMORIAL_BLOCK_OFFSET[NUM_PRIMORIAL_BLOCKS + 1] = {
+        0,     8,    16,    24,    32,    40,    47,    54,    62,    70,    78,    86,
+       94,   102,   110,   118,   126,   134,   142,   150,   158,   166,   173,   180,
+      187,   194,   201,   208,   215,   222,   229,   236,   243,   250,   257,   264,
+      271,   278,   285,   292,   299,   306,   313,   320,   327,   334,   341,   348,
+      355,   362,   369,   376,   383,   391,   399,   407,   415,   423,   431,   439,
+      447,   455,   463,   471,   479,   487,   495,   503,   511,   519,   527,   535,
+      543,   551,   559,   567,   575,   583,   591,   599,   607,   615,   623,   631,
+      639,   647,   655,   663,   671,   679,   687,   695,   703,   711,   719,   727,
+      735,   743,   751,   759,   767,   775,   783,   791,   799,   807,   815,   823,
+      831,   839,   847,   855,   863,   871,   879,   887,   895,   903,   911,   919,
+      927,   935,   943,   951,   959,   967,   975,   983,   991,   999,  1007,  1015,
+     1023,  1031,  1039,  1047,  1055,  1063,  1071,  1079,  1087,  1095,  1103,  1111,
+     1119,  1127,  1135,  1143,  1151,  1159,  1167,  1175,  1183,  1191,  1199,  1207,
+     1215,  1223,  1231,  1239,  1247,  1255,  1263,  1271,  1279,  1287,  1295,  1303,
+     1311,  1319,  1327,  1335,  1343,  1351,  1359,  1367,  1375,  1383,  1391,  1399,
+     1407,  1415,  1423,  1431,  1439,  1447,  1455,  1463,  1471,  1479,  1487,  1495,
+     1503,  1511,  1519,  1527,  1535,  1543,  1544,
+};
@@ -0,0 +1,83 @@
+# Generates the small prime and primorial tables used to filter prime
+# candidates.
+#
+# Command line:
+# python3 ./tests/generate_small_primes.py > ./src/small_primes.c
+
+PRIME_BOUND = 1 << 16
+BLOCK_LIMBS = 8
+LIMB = 1 << 64
+
+sieve = bytearray([1]) * PRIME_BOUND
+sieve[0] = sieve[1] = 0
+for i in range(2, int(PRIME_BOUND ** 0.5) + 1):
+    if sieve[i]:
+        sieve[i * i::i] = bytearray(len(sieve[i * i::i]))
+primes = [p for p in range(3, PRIME_BOUND) if sieve[p]]
+
+# Single-limb primorials: runs of consecutive primes whose product
+# still fits in one limb.
+primorials = []
+ends = []
+product = 1
+for idx, p in enumerate(primes):
+    if product * p >= LIMB:
+        primorials.append(product)
+        ends.append(idx)
+        product = 1
+    product *= p
+primorials.append(product)
+ends.append(len(primes))
+
+# Multi-limb primorials: products of BLOCK_LIMBS consecutive
+# single-limb primorials, stored least significant limb first.
+blocks = []
+for i in range(0, len(primorials), BLOCK_LIMBS):
+    product = 1
+    for m in primorials[i:i + BLOCK_LIMBS]:
+        product *= m
+    limbs = []
+    while product:
+        limbs.append(product % LIMB)
+        product //= LIMB
+    blocks.append(limbs)
+
+
+def emit(values, fmt, per_line):
+    for i in range(0, len(values), per_line):
+        print("    " + " ".join(fmt.format(v) + "," for v in values[i:i + per_line]))
+
+
+print("/* Generated by tests/generate_small_primes.py; do not edit. */")
+print('#include "small_primes.h"')
+print()
+print("const uint16_t SMALL_PRIMES[NUM_SMALL_PRIMES] = {")
+emit(primes, "{:5d}", 12)
+print("};")
+print()
+print("const uint32_t SMALL_PRIME_BARRETT[NUM_SMALL_PRIMES] = {")
+emit([(1 << 32) // p for p in primes], "0x{:08x}", 6)
+print("};")
+print()
+print("const big_uint PRIMORIALS[NUM_PRIMORIALS] = {")
+emit(primorials, "0x{:016x}", 3)
+print("};")
+print()
+print("const uint16_t PRIMORIAL_END[NUM_PRIMORIALS] = {")
+emit(ends, "{:5d}", 12)
+print("};")
+print()
+offsets = [0]
+for b in blocks:
+    offsets.append(offsets[-1] + len(b))
+print("const big_uint PRIMORIAL_BLOCK_DATA[] = {")
+emit([limb for b in blocks for limb in b], "0x{:016x}", 3)
+print("};")
+print()
+print("const uint16_t PRIMORIAL_BLOCK_OFFSET[NUM_PRIMORIAL_BLOCKS + 1] = {")
+emit(offsets, "{:5d}", 12)
+print("};")
+
+import sys
+print("NUM_SMALL_PRIMES", len(primes), "NUM_PRIMORIALS", len(primorials),
+      "NUM_PRIMORIAL_BLOCKS", len(blocks), file=sys.stderr)
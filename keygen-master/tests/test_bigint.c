@@ -20,6 +20,35 @@ int main() {
     
     // run_tests("test_cases/big_shr.csv", big_shr_tester, 500, 3);
     run_tests("test_cases/div_by_3.csv", big_div_by_3_tester, 500, 2);
+    run_tests("test_cases/big_divexact.csv", big_divexact_tester, 300, 3);
+    run_tests("test_cases/big_mod_limb.csv", big_mod_limb_tester, 200, 3);
+    run_tests("test_cases/big_exp2_mod.csv", big_exp2_mod_tester, 200, 3);
+    run_tests("test_cases/chacha20_blocks.csv", chacha20_blocks_tester, 20, 4);
+    run_tests("test_cases/big_fill_random.csv", big_fill_random_tester, 20, 1);
+    run_tests("test_cases/drbg_seeded.csv", drbg_seeded_tester, 8, 3);
+    run_tests("test_cases/u64_primes.csv", big_is_prime_tester, 500, 2);
+    run_tests("test_cases/first_primes.csv", big_is_prime_bpsw_tester, 9998, 2);
+    run_tests("test_cases/random_primes.csv", big_is_prime_bpsw_tester, 3600, 2);
+    run_tests("test_cases/gen_prime_ctx.csv", big_gen_prime_ctx_tester, 16, 3);
+    run_tests("test_cases/gen_prime_seeded.csv", big_gen_prime_seeded_tester, 14, 4);
+    run_tests("test_cases/big_mod.csv", big_mod_tester, 60, 3);
+    run_tests("test_cases/big_inv_mod_odd.csv", big_inv_mod_odd_tester, 60, 3);
+    run_tests("test_cases/big_exp_mod_limb.csv", big_exp_mod_limb_tester, 60, 4);
+    run_tests("test_cases/rsa_private.csv", rsa_private_tester, 42, 5);
+    run_tests("test_cases/rsa_gen_key_multi.csv", rsa_gen_key_multi_tester, 10, 3);
+    // seeds whose first primes leave N short of nbits by more than the
+    // smallest prime can make up; these used to redraw it forever
+    run_tests("test_cases/rsa_gen_key_multi_redraw.csv", rsa_gen_key_multi_tester, 6, 3);
+    run_tests("test_cases/rsa_private_batch.csv", rsa_private_batch_tester, 16, 4);
+    run_tests("test_cases/big_exp_mod_x4.csv", big_exp_mod_x4_tester, 24, 4);
+    run_tests("test_cases/limb_kernels.csv", limb_kernels_tester, 12, 3);
+    // the portable limb kernels on earlier cases, then back to the fastest
+    int kernels_result = big_select_kernels(BIG_KERNELS_PORTABLE);
+    assert(kernels_result == 0);
+    run_tests("test_cases/long_mul.csv", big_karatsuba_mul_tester, 500, 3);
+    run_tests("test_cases/big_exp_mod_limb.csv", big_exp_mod_limb_tester, 60, 4);
+    kernels_result = big_select_kernels(BIG_KERNELS_AUTO);
+    assert(kernels_result == 0);
     
     // run_tests("test_cases/big_read_binary.csv", big_read_binary_tester, 1, 3);
     run_tests("test_cases/big_read_write_binary.csv", big_read_write_binary_tester, 16, 3);
@@ -60,8 +89,8 @@ int main() {
 
     run_tests("test_cases/stress_test_exp_mod.csv", big_exp_mod_tester, 50, 4);
 
-    run_tests("test_cases/first_primes.csv", big_is_prime_tester, 9998, 4);
-    run_tests("test_cases/random_primes.csv", big_is_prime_tester, 3600, 4);
+    run_tests("test_cases/first_primes.csv", big_is_prime_tester, 9998, 2);
+    run_tests("test_cases/random_primes.csv", big_is_prime_tester, 3600, 2);
 
 
     printf("All test cases passed!\n");
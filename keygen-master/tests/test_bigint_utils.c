@@ -6,6 +6,8 @@
 #include <math.h>
 
 #include "bigint.h"
+#include "drbg.h"
+#include "rsa.h"
 #include "test_utils.h"
 
 void test_big_init_free() {
@@ -385,7 +387,7 @@ void big_div_by_3_tester(int idx, char **params) {
     size_t olen;
     big_init(&num1);
     big_read_string(&num1, params[0]);
-    big_fast_divide_by_3(&num1, &num1);
+    big_divexact_limb(&num1, &num1, 3);
 
     char out[4096];
     big_write_string(&num1, out, 4096, &olen);
@@ -396,6 +398,46 @@ void big_div_by_3_tester(int idx, char **params) {
     big_free(&num1);
 }
 
+void big_divexact_tester(int idx, char **params) {
+    (void)idx;
+    bigint num1, num2, result;
+    size_t olen;
+    big_init(&num1);
+    big_read_string(&num1, params[0]);
+    big_init(&num2);
+    big_read_string(&num2, params[1]);
+    big_init(&result);
+    big_divexact(&result, &num1, &num2);
+
+    char out[1024];
+    big_write_string(&result, out, 1024, &olen);
+    if (strcmp(out, params[2]) != 0) {
+        printf("case #%d %s / %s = %s, %s\n", idx, params[0], params[1], out, params[2]);
+        assert(strcmp(out, params[2]) == 0);
+    }
+    big_free(&num1);
+    big_free(&num2);
+    big_free(&result);
+}
+
+void big_mod_limb_tester(int idx, char **params) {
+    (void)idx;
+    bigint num1;
+    big_init(&num1);
+    big_read_string(&num1, params[0]);
+    big_uint b = strtoull(params[1], NULL, 16);
+    big_uint expected = strtoull(params[2], NULL, 16);
+
+    big_uint r;
+    big_mod_limb(&r, &num1, b);
+    if (r != expected) {
+        printf("case #%d %s mod %s = %llx, %s\n", idx, params[0], params[1],
+               (unsigned long long)r, params[2]);
+        assert(r == expected);
+    }
+    big_free(&num1);
+}
+
 void big_cmp_tester(int idx, char **params) {
     bigint num1, num2;
     size_t olen;
@@ -488,25 +530,343 @@ void big_inv_mod_tester(int idx, char **params) {
 }
 
 
+void big_exp2_mod_tester(int idx, char **params) {
+    bigint exp, mod, result, RR;
+    size_t olen;
+    big_init(&exp);
+    big_read_string(&exp, params[0]);
+    big_init(&mod);
+    big_read_string(&mod, params[1]);
+    big_init(&result);
+    big_init(&RR);
+    big_exp2_mod(&result, &exp, &mod, &RR);
+    char out[1024];
+    big_write_string(&result, out, 1024, &olen);
+    if (strcmp(out, params[2]) != 0) {
+        printf("case #%d exp2_mod(%s, %s) = %s, %s \n", idx, params[0], params[1], out, params[2]);
+        assert(strcmp(out, params[2]) == 0);
+    }
+    big_free(&exp);
+    big_free(&mod);
+    big_free(&result);
+    big_free(&RR);
+}
+
 void big_is_prime_tester(int idx, char **params) {
     bigint num;
-    size_t olen;
     big_init(&num);
     big_read_string(&num, params[0]);
 
     int result = big_is_prime(&num);
 
-    if (!((result == 0 && params[1] == "0") || (result == 1 && params[1] == "1"))) {
+    if (!((result == 0 && strcmp(params[1], "0") == 0) ||
+          (result == ERR_BIGINT_NOT_ACCEPTABLE && strcmp(params[1], "1") == 0))) {
         printf("case #%d is_prime(%s) = %d, %s \n", idx, params[0], result, params[1]);
         assert(false);
     }
+    big_free(&num);
+}
 
-    // char out[128];
-    // big_write_string(&gcd, out, 128, &olen);
-    // assert(strcmp(out, params[2]) == 0);
+void big_is_prime_bpsw_tester(int idx, char **params) {
+    bigint num;
+    big_init(&num);
+    big_read_string(&num, params[0]);
+
+    int result = big_is_prime_ext(&num, BIG_PRIMALITY_BPSW);
+
+    if (!((result == 0 && strcmp(params[1], "0") == 0) ||
+          (result == ERR_BIGINT_NOT_ACCEPTABLE && strcmp(params[1], "1") == 0))) {
+        printf("case #%d is_prime_bpsw(%s) = %d, %s \n", idx, params[0], result, params[1]);
+        assert(false);
+    }
     big_free(&num);
 }
 
+void big_gen_prime_ctx_tester(int idx, char **params) {
+    bigint prime;
+    big_init(&prime);
+    big_prime_ctx ctx;
+    big_prime_ctx_init(&ctx);
+    size_t nbits = strtoul(params[0], NULL, 10);
+    ctx.num_workers = strtoul(params[1], NULL, 10);
+    ctx.e = strtoull(params[2], NULL, 10);
+
+    int result = big_gen_prime_ctx(&prime, nbits, &ctx);
+    big_uint x_mod_e = 0;
+    if (result == 0 && ctx.e != 0) {
+        big_mod_limb(&x_mod_e, &prime, ctx.e);
+    }
+
+    if (result != 0 || big_bitlen(&prime) != nbits ||
+        big_is_prime_ext(&prime, BIG_PRIMALITY_BPSW) != 0 ||
+        (ctx.e != 0 && x_mod_e == 1)) {
+        printf("case #%d gen_prime_ctx(%s, %s workers, e = %s) = %d, %zu bits \n",
+               idx, params[0], params[1], params[2], result, big_bitlen(&prime));
+        assert(false);
+    }
+    big_free(&prime);
+}
+
+void big_gen_prime_seeded_tester(int idx, char **params) {
+    bigint prime;
+    big_init(&prime);
+    big_prime_ctx ctx;
+    big_prime_ctx_init(&ctx);
+    size_t nbits = strtoul(params[0], NULL, 10);
+    ctx.seeded = 1;
+    ctx.seed = strtoull(params[1], NULL, 10);
+    ctx.e = strtoull(params[2], NULL, 10);
+
+    // the result must not depend on the number of workers
+    size_t workers[] = {1, 3, 8};
+    for (size_t i = 0; i < sizeof(workers) / sizeof(*workers); i++) {
+        ctx.num_workers = workers[i];
+        int result = big_gen_prime_ctx(&prime, nbits, &ctx);
+        char out[1024];
+        size_t olen;
+        big_write_string(&prime, out, 1024, &olen);
+        if (result != 0 || strcmp(out, params[3]) != 0) {
+            printf("case #%d gen_prime_seeded(%s, seed = %s, %zu workers) = %d, %s, %s \n",
+                   idx, params[0], params[1], workers[i], result, out, params[3]);
+            assert(false);
+        }
+    }
+    big_free(&prime);
+}
+
+void drbg_seeded_tester(int idx, char **params) {
+    uint8_t seed[DRBG_KEY_SIZE];
+    for (size_t i = 0; i < DRBG_KEY_SIZE; i++) {
+        sscanf(&params[0][2 * i], "%2hhx", &seed[i]);
+    }
+    size_t len = strtoul(params[1], NULL, 10);
+
+    // drawn in two uneven parts, which must not change the stream
+    drbg_context ctx;
+    drbg_init(&ctx);
+    drbg_seed_deterministic(&ctx, seed);
+    uint8_t *out = malloc(len);
+    drbg_random(&ctx, out, len / 3);
+    drbg_random(&ctx, out + len / 3, len - len / 3);
+    drbg_free(&ctx);
+
+    char *hex = malloc(2 * len + 1);
+    for (size_t i = 0; i < len; i++) {
+        sprintf(&hex[2 * i], "%02x", out[i]);
+    }
+    if (strcmp(hex, params[2]) != 0) {
+        printf("case #%d drbg_seeded(%s, %s) = %s, %s \n", idx, params[0], params[1], hex, params[2]);
+        assert(false);
+    }
+    free(out);
+    free(hex);
+}
+
+void big_fill_random_tester(int idx, char **params) {
+    bigint num;
+    big_init(&num);
+    size_t size = strtoul(params[0], NULL, 10);
+
+    // X < 2^(8 size) in canonical form, and over 32 draws the top byte
+    // must be nonzero at least once (fails with probability 2^-256)
+    bool top_byte_set = size == 0;
+    for (int i = 0; i < 32; i++) {
+        int result = big_fill_random(&num, size);
+        size_t bits = big_bitlen(&num);
+        if (result != 0 || bits > 8 * size ||
+            (num.num_limbs > 0 && num.data[0] == 0) ||
+            (num.num_limbs == 0 && num.signum != 0)) {
+            printf("case #%d fill_random(%s) = %d, %zu bits \n", idx, params[0], result, bits);
+            assert(false);
+        }
+        top_byte_set |= bits > 8 * size - 8;
+    }
+    if (!top_byte_set) {
+        printf("case #%d fill_random(%s) never set the top byte \n", idx, params[0]);
+        assert(false);
+    }
+    big_free(&num);
+}
+
+void chacha20_blocks_tester(int idx, char **params) {
+    uint8_t key_bytes[32];
+    for (size_t i = 0; i < 32; i++) {
+        sscanf(&params[0][2 * i], "%2hhx", &key_bytes[i]);
+    }
+    uint32_t key[8];
+    for (size_t i = 0; i < 8; i++) {
+        key[i] = (uint32_t)key_bytes[4 * i] | (uint32_t)key_bytes[4 * i + 1] << 8 |
+                 (uint32_t)key_bytes[4 * i + 2] << 16 | (uint32_t)key_bytes[4 * i + 3] << 24;
+    }
+    uint64_t nonce = strtoull(params[1], NULL, 16);
+    uint64_t counter = strtoull(params[2], NULL, 16);
+
+    uint8_t out[DRBG_BUFFER_SIZE];
+    chacha20_blocks(out, key, nonce, counter);
+    char hex[2 * DRBG_BUFFER_SIZE + 1];
+    for (size_t i = 0; i < DRBG_BUFFER_SIZE; i++) {
+        sprintf(&hex[2 * i], "%02x", out[i]);
+    }
+    if (strcmp(hex, params[3]) != 0) {
+        printf("case #%d chacha20_blocks(%s, %s, %s) = %s, %s \n",
+               idx, params[0], params[1], params[2], hex, params[3]);
+        assert(false);
+    }
+}
+
+void big_exp_mod_limb_tester(int idx, char **params) {
+    bigint num1, num3, mod, RR;
+    size_t olen;
+    big_init(&num1);
+    big_read_string(&num1, params[0]);
+    big_uint e = strtoull(params[1], NULL, 16);
+    big_init(&num3);
+    big_read_string(&num3, params[2]);
+    big_init(&mod);
+    big_init(&RR);
+
+    // the second call reuses the RR filled by the first
+    char out[2048], out_rr[2048];
+    int result = big_exp_mod_limb(&mod, &num1, e, &num3, &RR);
+    big_write_string(&mod, out, 2048, &olen);
+    int result_rr = big_exp_mod_limb(&mod, &num1, e, &num3, &RR);
+    big_write_string(&mod, out_rr, 2048, &olen);
+    if (result != 0 || result_rr != 0 ||
+        strcmp(out, params[3]) != 0 || strcmp(out_rr, params[3]) != 0) {
+        printf("case #%d exp_mod_limb(%s, %s, %s) = %s, %s, %s \n", idx, params[0], params[1], params[2], out, out_rr, params[3]);
+        assert(false);
+    }
+    big_free(&num1);
+    big_free(&num3);
+    big_free(&mod);
+    big_free(&RR);
+}
+
+void big_mod_tester(int idx, char **params) {
+    bigint num1, num2, mod;
+    size_t olen;
+    big_init(&num1);
+    big_read_string(&num1, params[0]);
+    big_init(&num2);
+    big_read_string(&num2, params[1]);
+    big_init(&mod);
+
+    // once into a separate bigint, once in place over A
+    int result = big_mod(&mod, &num1, &num2);
+    char out[1024];
+    big_write_string(&mod, out, 1024, &olen);
+    int result_inplace = big_mod(&num1, &num1, &num2);
+    char out_inplace[1024];
+    big_write_string(&num1, out_inplace, 1024, &olen);
+    if (result != 0 || result_inplace != 0 ||
+        strcmp(out, params[2]) != 0 || strcmp(out_inplace, params[2]) != 0) {
+        printf("case #%d mod(%s, %s) = %s, %s, %s \n", idx, params[0], params[1], out, out_inplace, params[2]);
+        assert(false);
+    }
+    big_free(&num1);
+    big_free(&num2);
+    big_free(&mod);
+}
+
+void big_inv_mod_odd_tester(int idx, char **params) {
+    bigint num1, num2, inv;
+    size_t olen;
+    big_init(&num1);
+    big_read_string(&num1, params[0]);
+    big_init(&num2);
+    big_read_string(&num2, params[1]);
+    big_init(&inv);
+
+    // "none" where gcd(A, N) != 1
+    int result = big_inv_mod(&inv, &num1, &num2);
+    char out[1024] = "none";
+    if (result == 0) {
+        big_write_string(&inv, out, 1024, &olen);
+    }
+    if ((result != 0 && result != ERR_BIGINT_NOT_ACCEPTABLE) ||
+        strcmp(out, params[2]) != 0) {
+        printf("case #%d inv_mod(%s, %s) = %d, %s, %s \n", idx, params[0], params[1], result, out, params[2]);
+        assert(false);
+    }
+    big_free(&num1);
+    big_free(&num2);
+    big_free(&inv);
+}
+
+void rsa_private_tester(int idx, char **params) {
+    rsa_context rsa;
+    rsa_init(&rsa);
+    bigint one, p1, q1, g, l, m, s;
+    big_init(&one);
+    big_init(&p1);
+    big_init(&q1);
+    big_init(&g);
+    big_init(&l);
+    big_init(&m);
+    big_init(&s);
+    big_read_string(&rsa.P, params[0]);
+    big_read_string(&rsa.Q, params[1]);
+    big_read_string(&rsa.E, params[2]);
+    big_read_string(&m, params[3]);
+
+    // the key is completed the way rsa_gen_key does it
+    big_set_nonzero(&one, 1);
+    big_mul(&rsa.N, &rsa.P, &rsa.Q);
+    rsa.len = big_size(&rsa.N);
+    big_sub(&p1, &rsa.P, &one);
+    big_sub(&q1, &rsa.Q, &one);
+    big_gcd(&g, &p1, &q1);
+    big_divexact(&l, &p1, &g);
+    big_mul(&l, &l, &q1);
+    big_inv_mod(&rsa.D, &rsa.E, &l);
+    big_mod(&rsa.DP, &rsa.D, &p1);
+    big_mod(&rsa.DQ, &rsa.D, &q1);
+    big_inv_mod(&rsa.QP, &rsa.Q, &rsa.P);
+
+    // the caches hold 2^(128 n) mod N, P and Q for moduli of n limbs
+    int result_precompute = rsa_precompute(&rsa);
+    assert(result_precompute == 0);
+    const bigint *moduli[] = {&rsa.N, &rsa.P, &rsa.Q};
+    const bigint *caches[] = {&rsa.RN, &rsa.RP, &rsa.RQ};
+    for (size_t i = 0; i < 3; i++) {
+        big_two_to_pwr(&g, 128 * moduli[i]->num_limbs);
+        big_mod(&g, &g, moduli[i]);
+        if (big_cmp(&g, caches[i]) != 0) {
+            printf("case #%d rsa_precompute: wrong cache %zu \n", idx, i);
+            assert(false);
+        }
+    }
+
+    // blinded twice with different values, the second time in place
+    char out[1024], out_inplace[1024];
+    size_t olen;
+    int result = rsa_private(&rsa, &m, &s);
+    big_write_string(&s, out, 1024, &olen);
+    int result_inplace = rsa_private(&rsa, &m, &m);
+    big_write_string(&m, out_inplace, 1024, &olen);
+    int result_range = rsa_private(&rsa, &rsa.N, &s);
+
+    // and back with the public key
+    int result_public = rsa_public(&rsa, &m, &m);
+    char out_public[1024];
+    big_write_string(&m, out_public, 1024, &olen);
+    if (result != 0 || result_inplace != 0 || result_public != 0 ||
+        result_range != ERR_BIGINT_BAD_INPUT_DATA ||
+        strcmp(out, params[4]) != 0 || strcmp(out_inplace, params[4]) != 0 ||
+        strcmp(out_public, params[3]) != 0) {
+        printf("case #%d rsa_private(%s) = %d, %s, %s \n", idx, params[3], result, out, params[4]);
+        assert(false);
+    }
+    rsa_free(&rsa);
+    big_free(&one);
+    big_free(&p1);
+    big_free(&q1);
+    big_free(&g);
+    big_free(&l);
+    big_free(&m);
+    big_free(&s);
+}
+
 void big_exp_mod_tester(int idx, char **params) {
     bigint num1, num2, num3, mod, RR;
     size_t olen;
@@ -576,4 +936,275 @@ void run_tests(const char *filename, test_func_t *tester,
     test_cases_t *tc = read_test_cases(filename, n_params, n_cases);
     run_test_cases(tc, tester);
     free_test_cases(tc);
-}
\ No newline at end of file
+}void rsa_gen_key_multi_tester(int idx, char **params) {
+    size_t nbits = strtoul(params[0], NULL, 10);
+    size_t nprimes = strtoul(params[1], NULL, 10);
+    uint8_t seed[DRBG_KEY_SIZE] = {0};
+    seed[0] = (uint8_t)strtoul(params[2], NULL, 10);
+
+    // the same seed gives the same key
+    rsa_context rsa, again;
+    rsa_init(&rsa);
+    rsa_init(&again);
+    drbg_thread_seed(seed);
+    int result = rsa_gen_key_multi(&rsa, nbits, nprimes, 65537);
+    drbg_thread_seed(seed);
+    int result_again = rsa_gen_key_multi(&again, nbits, nprimes, 65537);
+    drbg_thread_seed(NULL);
+    if (result != 0 || result_again != 0 || big_cmp(&rsa.N, &again.N) != 0 ||
+        big_bitlen(&rsa.N) != nbits || rsa.num_other != nprimes - 2 ||
+        rsa.ver != (nprimes > 2)) {
+        printf("case #%d rsa_gen_key_multi(%s, %s) = %d, %d \n",
+               idx, params[0], params[1], result, result_again);
+        assert(false);
+    }
+
+    // N is the product of the primes; for each prime r, D_r = D mod (r - 1)
+    // inverts E and T_r inverts the product of the primes before it
+    bigint one, n, r1, g;
+    big_init(&one);
+    big_init(&n);
+    big_init(&r1);
+    big_init(&g);
+    big_set_nonzero(&one, 1);
+    big_mul(&n, &rsa.P, &rsa.Q);
+    for (size_t i = 0; i < rsa.num_other; i++) {
+        rsa_prime_info *info = &rsa.other[i];
+        big_sub(&r1, &info->R, &one);
+        big_mod(&g, &rsa.D, &r1);
+        bool ok = big_is_prime(&info->R) == 0 && big_cmp(&g, &info->D) == 0;
+        big_mul(&g, &info->D, &rsa.E);
+        big_mod(&g, &g, &r1);
+        ok = ok && big_cmp(&g, &one) == 0;
+        big_mul(&g, &info->T, &n);
+        big_mod(&g, &g, &info->R);
+        if (!ok || big_cmp(&g, &one) != 0) {
+            printf("case #%d rsa_gen_key_multi(%s, %s): bad prime %zu \n",
+                   idx, params[0], params[1], i + 3);
+            assert(false);
+        }
+        big_mul(&n, &n, &info->R);
+    }
+    if (big_cmp(&n, &rsa.N) != 0) {
+        printf("case #%d rsa_gen_key_multi(%s, %s): N is not the product \n",
+               idx, params[0], params[1]);
+        assert(false);
+    }
+
+    // a round trip through rsa_private and rsa_public
+    big_sub(&n, &rsa.N, &one);
+    rsa_private(&rsa, &n, &g);
+    rsa_public(&rsa, &g, &g);
+    if (big_cmp(&g, &n) != 0) {
+        printf("case #%d rsa_gen_key_multi(%s, %s): no round trip \n",
+               idx, params[0], params[1]);
+        assert(false);
+    }
+
+    // too many primes or primes below 64 bits are refused
+    int result_too_many = rsa_gen_key_multi(&again, nbits, RSA_MAX_PRIMES + 1,
+                                            65537);
+    int result_too_short = rsa_gen_key_multi(&again, 64 * nprimes - 1, nprimes,
+                                             65537);
+    assert(result_too_many == ERR_BIGINT_BAD_INPUT_DATA);
+    assert(result_too_short == ERR_BIGINT_BAD_INPUT_DATA);
+
+    rsa_free(&rsa);
+    rsa_free(&again);
+    big_free(&one);
+    big_free(&n);
+    big_free(&r1);
+    big_free(&g);
+}
+void rsa_private_batch_tester(int idx, char **params) {
+    size_t nbits = strtoul(params[0], NULL, 10);
+    size_t nprimes = strtoul(params[1], NULL, 10);
+    uint8_t seed[DRBG_KEY_SIZE] = {0};
+    seed[0] = (uint8_t)strtoul(params[2], NULL, 10);
+    big_uint exponents[16];
+    size_t count = 0;
+    for (char *s = params[3]; count < 16; s++) {
+        exponents[count++] = strtoull(s, &s, 10);
+        if (*s != ':') {
+            break;
+        }
+    }
+
+    rsa_context rsa;
+    rsa_init(&rsa);
+    drbg_thread_seed(seed);
+    int result_gen = rsa_gen_key_multi(&rsa, nbits, nprimes, 65537);
+    assert(result_gen == 0);
+    bigint in[16], out[16], one, e, r1, g;
+    big_init(&one);
+    big_init(&e);
+    big_init(&r1);
+    big_init(&g);
+    big_set_nonzero(&one, 1);
+    for (size_t i = 0; i < count; i++) {
+        big_init(&in[i]);
+        big_init(&out[i]);
+        big_fill_random(&in[i], rsa.len);
+        big_mod(&in[i], &in[i], &rsa.N);
+    }
+    drbg_thread_seed(NULL);
+
+    // the batch is refused unless the exponents are pairwise coprime and
+    // coprime to r - 1 for every prime r
+    bool acceptable = true;
+    for (size_t i = 0; i < count; i++) {
+        big_set_nonzero(&e, exponents[i]);
+        for (size_t j = 0; j < i; j++) {
+            big_set_nonzero(&g, exponents[j]);
+            big_gcd(&g, &g, &e);
+            acceptable = acceptable && big_cmp(&g, &one) == 0;
+        }
+        for (size_t j = 0; j < nprimes; j++) {
+            big_sub(&r1, j == 0 ? &rsa.P : j == 1 ? &rsa.Q : &rsa.other[j - 2].R, &one);
+            big_gcd(&g, &r1, &e);
+            acceptable = acceptable && big_cmp(&g, &one) == 0;
+        }
+    }
+
+    // out[i]^e_i must give in[i] back, also when computed in place
+    int result = rsa_private_batch(&rsa, exponents, in, out, count);
+    if (result != (acceptable ? 0 : ERR_BIGINT_BAD_INPUT_DATA)) {
+        printf("case #%d rsa_private_batch(%s) = %d \n", idx, params[3], result);
+        assert(false);
+    }
+    for (size_t i = 0; acceptable && i < count; i++) {
+        big_exp_mod_limb(&e, &out[i], exponents[i], &rsa.N, NULL);
+        if (big_cmp(&e, &in[i]) != 0) {
+            printf("case #%d rsa_private_batch(%s): wrong root %zu \n",
+                   idx, params[3], i);
+            assert(false);
+        }
+    }
+    if (acceptable) {
+        int result_inplace = rsa_private_batch(&rsa, exponents, in, in, count);
+        assert(result_inplace == 0);
+        for (size_t i = 0; i < count; i++) {
+            assert(big_cmp(&in[i], &out[i]) == 0);
+        }
+    }
+
+    rsa_free(&rsa);
+    for (size_t i = 0; i < count; i++) {
+        big_free(&in[i]);
+        big_free(&out[i]);
+    }
+    big_free(&one);
+    big_free(&e);
+    big_free(&r1);
+    big_free(&g);
+}
+
+// Reads four colon-separated hex values into lanes
+static void read_lanes(bigint lanes[4], const char *s) {
+    for (size_t l = 0; l < 4; l++) {
+        size_t len = strcspn(s, ":");
+        char value[len + 1];
+        memcpy(value, s, len);
+        value[len] = '\0';
+        big_init(&lanes[l]);
+        int result = big_read_string(&lanes[l], value);
+        assert(result == 0);
+        s += len + (s[len] == ':');
+    }
+}
+
+void big_exp_mod_x4_tester(int idx, char **params) {
+    bigint A[4], E[4], N[4], X[4], Y[4];
+    read_lanes(A, params[0]);
+    read_lanes(E, params[1]);
+    read_lanes(N, params[2]);
+    read_lanes(X, params[3]);
+    bigint *y[4], *a[4];
+    const bigint *ca[4], *e[4], *n[4];
+    for (size_t l = 0; l < 4; l++) {
+        big_init(&Y[l]);
+        y[l] = &Y[l];
+        a[l] = &A[l];
+        ca[l] = &A[l];
+        e[l] = &E[l];
+        n[l] = &N[l];
+    }
+
+    // once into separate bigints, once in place over A
+    int result = big_exp_mod_x4(y, ca, e, n);
+    int result_inplace = big_exp_mod_x4(a, ca, e, n);
+    for (size_t l = 0; l < 4; l++) {
+        if (result != 0 || result_inplace != 0 || big_cmp(&Y[l], &X[l]) != 0 ||
+            big_cmp(&A[l], &X[l]) != 0) {
+            printf("case #%d exp_mod_x4 lane %zu = %d, %d \n", idx, l, result,
+                   result_inplace);
+            assert(false);
+        }
+    }
+
+    // an even modulus in any lane is refused
+    big_set_nonzero(&N[idx % 4], 4);
+    int result_even = big_exp_mod_x4(y, ca, e, n);
+    assert(result_even == ERR_BIGINT_BAD_INPUT_DATA);
+
+    for (size_t l = 0; l < 4; l++) {
+        big_free(&A[l]);
+        big_free(&E[l]);
+        big_free(&N[l]);
+        big_free(&X[l]);
+        big_free(&Y[l]);
+    }
+}
+
+void limb_kernels_tester(int idx, char **params) {
+    size_t size_a = strtoul(params[0], NULL, 10);
+    size_t size_b = strtoul(params[1], NULL, 10);
+    uint8_t seed[DRBG_KEY_SIZE] = {0};
+    seed[0] = (uint8_t)strtoul(params[2], NULL, 10);
+
+    bigint A, B, N, P[2], X[2], Q;
+    big_init(&A);
+    big_init(&B);
+    big_init(&N);
+    big_init(&Q);
+    drbg_thread_seed(seed);
+    big_fill_random(&A, size_a);
+    big_fill_random(&B, size_b);
+    drbg_thread_seed(NULL);
+    if (seed[0] & 1) {
+        A.signum = -A.signum;
+    }
+    big_copy(&N, &A);
+    N.signum = 1;
+    N.data[N.num_limbs - 1] |= 1;
+
+    // the portable kernels are the reference for the fastest ones
+    for (size_t k = 0; k < 2; k++) {
+        int result_select = big_select_kernels(k == 0 ? BIG_KERNELS_PORTABLE
+                                                      : BIG_KERNELS_AUTO);
+        big_init(&P[k]);
+        big_init(&X[k]);
+        int result_mul = big_mul(&P[k], &A, &B);
+        int result_exp = big_exp_mod(&X[k], &A, &B, &N, NULL);
+        assert(result_select == 0 && result_mul == 0 && result_exp == 0);
+    }
+    int result_div = big_divexact(&Q, &P[1], &B);
+    assert(result_div == 0);
+    if (big_cmp(&P[0], &P[1]) != 0 || big_cmp(&X[0], &X[1]) != 0 ||
+        big_cmp(&Q, &A) != 0) {
+        printf("case #%d limb kernels (%s, %s, %s) differ \n", idx, params[0],
+               params[1], params[2]);
+        assert(false);
+    }
+    int result_unknown = big_select_kernels(-1);
+    assert(result_unknown == ERR_BIGINT_BAD_INPUT_DATA);
+
+    big_free(&A);
+    big_free(&B);
+    big_free(&N);
+    big_free(&Q);
+    for (size_t k = 0; k < 2; k++) {
+        big_free(&P[k]);
+        big_free(&X[k]);
+    }
+}